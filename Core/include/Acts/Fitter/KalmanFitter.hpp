@@ -29,6 +29,7 @@
 #include "Acts/Propagator/detail/PointwiseMaterialInteraction.hpp"
 #include "Acts/Utilities/CalibrationContext.hpp"
 #include "Acts/Utilities/Definitions.hpp"
+#include "Acts/Utilities/Instrumentation.hpp"
 #include "Acts/Utilities/Logger.hpp"
 #include "Acts/Utilities/Result.hpp"
 
@@ -942,6 +943,7 @@ class KalmanFitter {
                      typename kalman_fitter_options_t::OutlierFinder>::value,
         "Inconsistent type of outlier finder between kalman fitter and "
         "kalman fitter options");
+    ACTS_INSTRUMENT_SCOPE("KalmanFitter::fit");
 
     // To be able to find measurements later, we put them into a map
     // We need to copy input SourceLinks anyways, so the map can own them.
@@ -1040,6 +1042,7 @@ class KalmanFitter {
                      typename kalman_fitter_options_t::OutlierFinder>::value,
         "Inconsistent type of outlier finder between kalman fitter and "
         "kalman fitter options");
+    ACTS_INSTRUMENT_SCOPE("KalmanFitter::fit");
 
     // To be able to find measurements later, we put them into a map
     // We need to copy input SourceLinks anyways, so the map can own them.
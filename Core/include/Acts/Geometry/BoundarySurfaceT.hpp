@@ -124,6 +124,21 @@ class BoundarySurfaceT {
   /// The Surface Representation of this
   virtual const Surface& surfaceRepresentation() const;
 
+  /// The volume attached on one side of this BoundarySurfaceT
+  ///
+  /// @param inout The boundary orientation
+  ///
+  /// @return The attached volume, nullptr if a volume array is attached
+  const T* attachedVolume(BoundaryOrientation inout) const;
+
+  /// The volume array attached on one side of this BoundarySurfaceT
+  ///
+  /// @param inout The boundary orientation
+  ///
+  /// @return The attached volume array, nullptr if there is none
+  std::shared_ptr<const VolumeArray> attachedVolumeArray(
+      BoundaryOrientation inout) const;
+
   /// Virtual Destructor
   virtual ~BoundarySurfaceT() = default;
 
@@ -161,6 +176,18 @@ inline const Surface& BoundarySurfaceT<T>::surfaceRepresentation() const {
   return (*(m_surface.get()));
 }
 
+template <class T>
+inline const T* BoundarySurfaceT<T>::attachedVolume(
+    BoundaryOrientation inout) const {
+  return inout == insideVolume ? m_insideVolume : m_outsideVolume;
+}
+
+template <class T>
+inline std::shared_ptr<const typename BoundarySurfaceT<T>::VolumeArray>
+BoundarySurfaceT<T>::attachedVolumeArray(BoundaryOrientation inout) const {
+  return inout == insideVolume ? m_insideVolumeArray : m_outsideVolumeArray;
+}
+
 template <class T>
 void BoundarySurfaceT<T>::attachVolume(const T* volume,
                                        BoundaryOrientation inout) {
@@ -516,6 +516,16 @@ class CylinderVolumeBuilder : public ITrackingVolumeBuilder {
                         std::unique_ptr<const Logger> logger = getDefaultLogger(
                             "CylinderVolumeBuilder", Logging::INFO));
 
+  /// @struct VolumeContent
+  /// The layers and confined volumes of the volume, they do not depend on
+  /// the volumes built around or inside of it
+  struct VolumeContent {
+    LayerVector negativeLayers;
+    LayerVector centralLayers;
+    LayerVector positiveLayers;
+    MutableTrackingVolumeVector centralVolumes;
+  };
+
   /// Destructor
   ~CylinderVolumeBuilder() override;
 
@@ -532,6 +542,28 @@ class CylinderVolumeBuilder : public ITrackingVolumeBuilder {
       const GeometryContext& gctx, TrackingVolumePtr existingVolume = nullptr,
       VolumeBoundsPtr externalBounds = nullptr) const override;
 
+  /// Build the layers and confined volumes with the configured builders
+  ///
+  /// This is the part of the volume building that is independent of the
+  /// other volumes, it can therefore run concurrently for several builders.
+  ///
+  /// @param [in] gctx geometry context for which the content is built
+  /// @return the content to be handed to the trackingVolume call
+  VolumeContent buildContent(const GeometryContext& gctx) const;
+
+  /// CylinderVolumeBuilder call method with previously built content
+  ///
+  /// @param [in] gctx geometry context for which this cylinder volume is built
+  /// @param [in] content are the layers and confined volumes of the volume
+  /// @param [in] existingVolume is an (optional) volume to be included
+  /// @param [in] externalBounds are (optional) external confinement
+  ///             constraints
+  /// @return a mutable pointer to a new TrackingVolume
+  MutableTrackingVolumePtr trackingVolume(
+      const GeometryContext& gctx, VolumeContent content,
+      TrackingVolumePtr existingVolume = nullptr,
+      VolumeBoundsPtr externalBounds = nullptr) const;
+
   /// Set configuration method
   ///
   /// @param [in] cvbConfig is the new configuration to be set
@@ -355,6 +355,25 @@ class SurfaceArrayCreator {
   static std::unique_ptr<SurfaceArray::ISurfaceGridLookup>
   makeSurfaceGridLookup2D(F1 globalToLocal, F2 localToGlobal, ProtoAxis pAxisA,
                           ProtoAxis pAxisB) {
+    return makeSurfaceGridLookup2D<bdtA, bdtB>(
+        detail::FunctionGridTransform<Vector2D>(std::move(globalToLocal),
+                                                std::move(localToGlobal)),
+        std::move(pAxisA), std::move(pAxisB));
+  }
+
+  /// SurfaceArrayCreator internal method
+  /// @brief Creates a statically typed grid lookup within an any
+  /// @tparam bdtA AxisBoundaryType of axis A
+  /// @tparam bdtB AxisBoundaryType of axis B
+  /// @tparam transform_t coordinate transform policy of the lookup
+  /// @param transform coordinate transform policy instance
+  /// @param pAxisA ProtoAxis object for axis A
+  /// @param pAxisB ProtoAxis object for axis B
+  template <detail::AxisBoundaryType bdtA, detail::AxisBoundaryType bdtB,
+            typename transform_t>
+  static std::unique_ptr<SurfaceArray::ISurfaceGridLookup>
+  makeSurfaceGridLookup2D(transform_t transform, ProtoAxis pAxisA,
+                          ProtoAxis pAxisB) {
     using ISGL = SurfaceArray::ISurfaceGridLookup;
     std::unique_ptr<ISGL> ptr;
 
@@ -365,36 +384,36 @@ class SurfaceArrayCreator {
       detail::Axis<detail::AxisType::Equidistant, bdtA> axisA(pAxisA.min, pAxisA.max, pAxisA.nBins);
       detail::Axis<detail::AxisType::Equidistant, bdtB> axisB(pAxisB.min, pAxisB.max, pAxisB.nBins);
 
-      using SGL = SurfaceArray::SurfaceGridLookup<decltype(axisA), decltype(axisB)>;
+      using SGL = SurfaceArray::TransformedSurfaceGridLookup<transform_t, decltype(axisA), decltype(axisB)>;
       ptr = std::unique_ptr<ISGL>(static_cast<ISGL*>(
-            new SGL(globalToLocal, localToGlobal, std::make_tuple(axisA, axisB))));
+            new SGL(transform, std::make_tuple(axisA, axisB))));
 
     } else if (pAxisA.bType == equidistant && pAxisB.bType == arbitrary) {
 
       detail::Axis<detail::AxisType::Equidistant, bdtA> axisA(pAxisA.min, pAxisA.max, pAxisA.nBins);
       detail::Axis<detail::AxisType::Variable, bdtB> axisB(pAxisB.binEdges);
 
-      using SGL = SurfaceArray::SurfaceGridLookup<decltype(axisA), decltype(axisB)>;
+      using SGL = SurfaceArray::TransformedSurfaceGridLookup<transform_t, decltype(axisA), decltype(axisB)>;
       ptr = std::unique_ptr<ISGL>(static_cast<ISGL*>(
-            new SGL(globalToLocal, localToGlobal, std::make_tuple(axisA, axisB))));
+            new SGL(transform, std::make_tuple(axisA, axisB))));
 
     } else if (pAxisA.bType == arbitrary && pAxisB.bType == equidistant) {
 
       detail::Axis<detail::AxisType::Variable, bdtA> axisA(pAxisA.binEdges);
       detail::Axis<detail::AxisType::Equidistant, bdtB> axisB(pAxisB.min, pAxisB.max, pAxisB.nBins);
 
-      using SGL = SurfaceArray::SurfaceGridLookup<decltype(axisA), decltype(axisB)>;
+      using SGL = SurfaceArray::TransformedSurfaceGridLookup<transform_t, decltype(axisA), decltype(axisB)>;
       ptr = std::unique_ptr<ISGL>(static_cast<ISGL*>(
-            new SGL(globalToLocal, localToGlobal, std::make_tuple(axisA, axisB))));
+            new SGL(transform, std::make_tuple(axisA, axisB))));
 
     } else /*if (pAxisA.bType == arbitrary && pAxisB.bType == arbitrary)*/ {
 
       detail::Axis<detail::AxisType::Variable, bdtA> axisA(pAxisA.binEdges);
       detail::Axis<detail::AxisType::Variable, bdtB> axisB(pAxisB.binEdges);
 
-      using SGL = SurfaceArray::SurfaceGridLookup<decltype(axisA), decltype(axisB)>;
+      using SGL = SurfaceArray::TransformedSurfaceGridLookup<transform_t, decltype(axisA), decltype(axisB)>;
       ptr = std::unique_ptr<ISGL>(static_cast<ISGL*>(
-            new SGL(globalToLocal, localToGlobal, std::make_tuple(axisA, axisB))));
+            new SGL(transform, std::make_tuple(axisA, axisB))));
     }
     // clang-format on
 
@@ -20,6 +20,7 @@
 #include "Acts/Geometry/ITrackingVolumeHelper.hpp"
 #include "Acts/Utilities/Definitions.hpp"
 #include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/TaskPool.hpp"
 
 namespace Acts {
 
@@ -40,14 +41,31 @@ class IMaterialDecorator;
 /// The returned volume of each step must be processable by the previous step
 class TrackingGeometryBuilder : public ITrackingGeometryBuilder {
  public:
+  /// Builds a volume around the given inner volume
+  using VolumeBuilder = std::function<std::shared_ptr<TrackingVolume>(
+      const GeometryContext& gctx, const TrackingVolumePtr&,
+      const VolumeBoundsPtr&)>;
+
+  /// Builds the independent content of a volume and returns the builder for
+  /// the volume itself
+  using StagedVolumeBuilder =
+      std::function<VolumeBuilder(const GeometryContext& gctx)>;
+
   /// @struct Config
   /// Nested Configuration for the CylinderVolumeBuilder
   struct Config {
     /// The list of tracking volume builders
-    std::vector<std::function<std::shared_ptr<TrackingVolume>(
-        const GeometryContext& gctx, const TrackingVolumePtr&,
-        const VolumeBoundsPtr&)>>
-        trackingVolumeBuilders;
+    std::vector<VolumeBuilder> trackingVolumeBuilders;
+
+    /// The list of staged tracking volume builders, alternative to the
+    /// trackingVolumeBuilders. The first stage builds the content of a volume
+    /// that is independent of the other volumes, e.g. its layers and surface
+    /// arrays, and returns the second stage that builds the volume itself.
+    std::vector<StagedVolumeBuilder> stagedVolumeBuilders;
+
+    /// Optional pool to run the first stage of the staged builders
+    /// concurrently, the second stages are always run in sequence
+    std::shared_ptr<TaskPool> taskPool = nullptr;
 
     /// The tracking volume helper for detector construction
     std::shared_ptr<const ITrackingVolumeHelper> trackingVolumeHelper = nullptr;
@@ -79,6 +97,9 @@ class TrackingGeometryBuilder : public ITrackingGeometryBuilder {
   /// Set configuration method
   ///
   /// @param cgbConfig is the new configuration struct
+  ///
+  /// @throws std::invalid_argument if both plain and staged volume builders
+  ///         are configured
   void setConfiguration(const Config& cgbConfig);
 
   /// Get configuration method
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <utility>
+#include <vector>
 
 #include "Acts/Material/MaterialProperties.hpp"
 #include "Acts/Utilities/Units.hpp"
@@ -137,4 +138,76 @@ float computeMultipleScatteringTheta0(const MaterialProperties& slab, int pdg,
                                       float m, float qOverP,
                                       float q = UnitConstants::e);
 
+/// Material slab properties in struct-of-arrays layout.
+///
+/// Stores only the slab quantities required by the batched interaction
+/// computations. Vacuum slabs are stored with zero thickness.
+struct MaterialPropertiesBatch {
+  std::vector<float> thickness;
+  std::vector<float> thicknessInX0;
+  std::vector<float> meanExcitationEnergy;
+  std::vector<float> molarElectronDensity;
+
+  /// Number of stored slabs.
+  size_t size() const { return thickness.size(); }
+  /// Reserve space for the given number of slabs.
+  void reserve(size_t n);
+  /// Remove all stored slabs while keeping the allocated memory.
+  void clear();
+  /// Append a slab.
+  void push_back(const MaterialProperties& slab);
+};
+
+/// Particle kinematics in struct-of-arrays layout.
+struct ParticleKinematicsBatch {
+  std::vector<int> pdg;
+  std::vector<float> mass;
+  std::vector<float> qOverP;
+  std::vector<float> charge;
+
+  /// Number of stored particles.
+  size_t size() const { return pdg.size(); }
+  /// Reserve space for the given number of particles.
+  void reserve(size_t n);
+  /// Remove all stored particles while keeping the allocated memory.
+  void clear();
+  /// Append a particle.
+  ///
+  /// @see computeEnergyLossBethe for parameters description
+  void push_back(int pdg_, float m, float qOverP_,
+                 float q = UnitConstants::e);
+};
+
+/// Results of the batched interaction computations.
+///
+/// Each entry corresponds to the scalar function of the same name.
+struct InteractionsBatchResult {
+  std::vector<float> energyLossBethe;
+  std::vector<float> energyLossLandau;
+  std::vector<float> energyLossLandauSigma;
+  std::vector<float> energyLossLandauSigmaQOverP;
+  std::vector<float> multipleScatteringTheta0;
+
+  /// Resize all result arrays.
+  void resize(size_t n);
+};
+
+/// Compute energy loss and multiple scattering for a batch of particles.
+///
+/// @param slabs     The traversed material slab for each particle
+/// @param particles The particle kinematics
+/// @param result    Output arrays, resized to the batch size
+///
+/// The i-th particle traverses the i-th slab and both batches must have the
+/// same size. The relativistic quantities are computed only once per particle
+/// and shared between all results. The computation is a branch-free loop
+/// over contiguous arrays without library calls except for the square root,
+/// which the compiler vectorizes when the square root does not set errno
+/// (the default build compiles it with -fno-math-errno). Vacuum entries are
+/// evaluated with finite dummy values and masked. The results agree with the
+/// corresponding scalar functions within float precision.
+void computeInteractions(const MaterialPropertiesBatch& slabs,
+                         const ParticleKinematicsBatch& particles,
+                         InteractionsBatchResult& result);
+
 }  // namespace Acts
@@ -34,6 +34,8 @@ struct DefaultExtension {
   ///
   /// @tparam propagator_state_t Type of the state of the propagator
   /// @tparam stepper_t Type of the stepper
+  /// @tparam vector3_t Vector type of the Runge-Kutta stages
+  /// @tparam scalar_t Scalar type of the Runge-Kutta stages
   /// @param [in] state State of the propagator
   /// @param [in] stepper Stepper of the propagation
   /// @param [out] knew Next k_i that is evaluated
@@ -43,20 +45,22 @@ struct DefaultExtension {
   /// @param [in] h Step size (= 0. ^ 0.5 * StepSize ^ StepSize)
   /// @param [in] kprev Evaluated k_{i - 1}
   /// @return Boolean flag if the calculation is valid
-  template <typename propagator_state_t, typename stepper_t>
+  template <typename propagator_state_t, typename stepper_t,
+            typename vector3_t, typename scalar_t>
   bool k(const propagator_state_t& state, const stepper_t& stepper,
-         Vector3D& knew, const Vector3D& bField, std::array<double, 4>& kQoP,
-         const int i = 0, const double h = 0.,
-         const Vector3D& kprev = Vector3D()) {
-    auto qop =
+         vector3_t& knew, const vector3_t& bField,
+         std::array<scalar_t, 4>& kQoP, const int i = 0, const double h = 0.,
+         const vector3_t& kprev = vector3_t()) {
+    scalar_t qop =
         stepper.charge(state.stepping) / stepper.momentum(state.stepping);
+    const vector3_t dir =
+        stepper.direction(state.stepping).template cast<scalar_t>();
     // First step does not rely on previous data
     if (i == 0) {
-      knew = qop * stepper.direction(state.stepping).cross(bField);
+      knew = qop * dir.cross(bField);
       kQoP = {0., 0., 0., 0.};
     } else {
-      knew =
-          qop * (stepper.direction(state.stepping) + h * kprev).cross(bField);
+      knew = qop * (dir + scalar_t(h) * kprev).cross(bField);
     }
     return true;
   }
@@ -87,11 +91,12 @@ struct DefaultExtension {
   /// @param [in] state State of the propagator
   /// @param [in] stepper Stepper of the propagation
   /// @param [in] h Step size
-  /// @param [out] D Transport matrix
+  /// @param [out] D Transport matrix, in the precision of the stages
   /// @return Boolean flag if the calculation is valid
-  template <typename propagator_state_t, typename stepper_t>
+  template <typename propagator_state_t, typename stepper_t,
+            typename matrix_t>
   bool finalize(propagator_state_t& state, const stepper_t& stepper,
-                const double h, FreeMatrix& D) const {
+                const double h, matrix_t& D) const {
     propagateTime(state, stepper, h);
     return transportMatrix(state, stepper, h, D);
   }
@@ -127,9 +132,10 @@ struct DefaultExtension {
   /// @param [in] h Step size
   /// @param [out] D Transport matrix
   /// @return Boolean flag if evaluation is valid
-  template <typename propagator_state_t, typename stepper_t>
+  template <typename propagator_state_t, typename stepper_t,
+            typename matrix_t>
   bool transportMatrix(propagator_state_t& state, const stepper_t& stepper,
-                       const double h, FreeMatrix& D) const {
+                       const double h, matrix_t& D) const {
     /// The calculations are based on ATL-SOFT-PUB-2009-002. The update of the
     /// Jacobian matrix is requires only the calculation of eq. 17 and 18.
     /// Since the terms of eq. 18 are currently 0, this matrix is not needed
@@ -149,31 +155,37 @@ struct DefaultExtension {
     /// constant offset does not exist for rectangular matrix dGdu' (due to the
     /// missing Lambda part) and only exists for dFdu' in dlambda/dlambda.
 
+    using scalar_t = typename matrix_t::Scalar;
+    using matrix3_t = ActsMatrix<scalar_t, 3, 3>;
+    using vector3_t = ActsVector<scalar_t, 3>;
+
     auto& sd = state.stepping.stepData;
-    auto dir = stepper.direction(state.stepping);
-    auto qop =
+    const vector3_t dir =
+        stepper.direction(state.stepping).template cast<scalar_t>();
+    scalar_t qop =
         stepper.charge(state.stepping) / stepper.momentum(state.stepping);
 
-    D = FreeMatrix::Identity();
+    D = matrix_t::Identity();
 
-    double half_h = h * 0.5;
+    scalar_t hs = h;
+    scalar_t half_h = h * 0.5;
     // This sets the reference to the sub matrices
     // dFdx is already initialised as (3x3) idendity
-    auto dFdT = D.block<3, 3>(0, 4);
-    auto dFdL = D.block<3, 1>(0, 7);
+    auto dFdT = D.template block<3, 3>(0, 4);
+    auto dFdL = D.template block<3, 1>(0, 7);
     // dGdx is already initialised as (3x3) zero
-    auto dGdT = D.block<3, 3>(4, 4);
-    auto dGdL = D.block<3, 1>(4, 7);
+    auto dGdT = D.template block<3, 3>(4, 4);
+    auto dGdL = D.template block<3, 1>(4, 7);
 
-    ActsMatrixD<3, 3> dk1dT = ActsMatrixD<3, 3>::Zero();
-    ActsMatrixD<3, 3> dk2dT = ActsMatrixD<3, 3>::Identity();
-    ActsMatrixD<3, 3> dk3dT = ActsMatrixD<3, 3>::Identity();
-    ActsMatrixD<3, 3> dk4dT = ActsMatrixD<3, 3>::Identity();
+    matrix3_t dk1dT = matrix3_t::Zero();
+    matrix3_t dk2dT = matrix3_t::Identity();
+    matrix3_t dk3dT = matrix3_t::Identity();
+    matrix3_t dk4dT = matrix3_t::Identity();
 
-    ActsVectorD<3> dk1dL = ActsVectorD<3>::Zero();
-    ActsVectorD<3> dk2dL = ActsVectorD<3>::Zero();
-    ActsVectorD<3> dk3dL = ActsVectorD<3>::Zero();
-    ActsVectorD<3> dk4dL = ActsVectorD<3>::Zero();
+    vector3_t dk1dL = vector3_t::Zero();
+    vector3_t dk2dL = vector3_t::Zero();
+    vector3_t dk3dL = vector3_t::Zero();
+    vector3_t dk4dL = vector3_t::Zero();
 
     // For the case without energy loss
     dk1dL = dir.cross(sd.B_first);
@@ -181,8 +193,8 @@ struct DefaultExtension {
             qop * half_h * dk1dL.cross(sd.B_middle);
     dk3dL = (dir + half_h * sd.k2).cross(sd.B_middle) +
             qop * half_h * dk2dL.cross(sd.B_middle);
-    dk4dL =
-        (dir + h * sd.k3).cross(sd.B_last) + qop * h * dk3dL.cross(sd.B_last);
+    dk4dL = (dir + hs * sd.k3).cross(sd.B_last) +
+            qop * hs * dk3dL.cross(sd.B_last);
 
     dk1dT(0, 1) = sd.B_first.z();
     dk1dT(0, 2) = -sd.B_first.y();
@@ -198,18 +210,18 @@ struct DefaultExtension {
     dk3dT += half_h * dk2dT;
     dk3dT = qop * VectorHelpers::cross(dk3dT, sd.B_middle);
 
-    dk4dT += h * dk3dT;
+    dk4dT += hs * dk3dT;
     dk4dT = qop * VectorHelpers::cross(dk4dT, sd.B_last);
 
     dFdT.setIdentity();
-    dFdT += h / 6. * (dk1dT + dk2dT + dk3dT);
-    dFdT *= h;
+    dFdT += hs / 6 * (dk1dT + dk2dT + dk3dT);
+    dFdT *= hs;
 
-    dFdL = (h * h) / 6. * (dk1dL + dk2dL + dk3dL);
+    dFdL = (hs * hs) / 6 * (dk1dL + dk2dL + dk3dL);
 
-    dGdT += h / 6. * (dk1dT + 2. * (dk2dT + dk3dT) + dk4dT);
+    dGdT += hs / 6 * (dk1dT + 2 * (dk2dT + dk3dT) + dk4dT);
 
-    dGdL = h / 6. * (dk1dL + 2. * (dk2dL + dk3dL) + dk4dL);
+    dGdL = hs / 6 * (dk1dL + 2 * (dk2dL + dk3dL) + dk4dL);
 
     D(3, 7) =
         h * state.options.mass * state.options.mass *
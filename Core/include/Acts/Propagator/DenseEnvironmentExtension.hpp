@@ -23,6 +23,8 @@ namespace Acts {
 /// ioninisation, bremsstrahlung, pair production and photonuclear interaction
 /// in the propagation and the jacobian. These effects will only occur if the
 /// propagation is in a TrackingVolume with attached material.
+///
+/// @note The extension requires Runge-Kutta stages in double precision.
 struct DenseEnvironmentExtension {
   /// Momentum at a certain point
   double currentMomentum = 0.;
@@ -16,6 +16,7 @@
 #include "Acts/Propagator/DefaultExtension.hpp"
 #include "Acts/Propagator/DenseEnvironmentExtension.hpp"
 #include "Acts/Propagator/EigenStepperError.hpp"
+#include "Acts/Propagator/StepSizePredictor.hpp"
 #include "Acts/Propagator/StepperExtensionList.hpp"
 #include "Acts/Propagator/detail/Auctioneer.hpp"
 #include "Acts/Propagator/detail/SteppingHelper.hpp"
@@ -39,9 +40,15 @@ using namespace Acts::UnitLiterals;
 /// with s being the arc length of the track, q the charge of the particle,
 /// p its momentum and B the magnetic field
 ///
+/// The scalar type sets the precision of the Runge-Kutta stages and of the
+/// transport matrix of a single step. Position, direction, the accumulated
+/// jacobian and the covariance are always kept in double precision, i.e. a
+/// `float` stepper only rounds the per-step increments.
+///
 template <typename bfield_t,
           typename extensionlist_t = StepperExtensionList<DefaultExtension>,
-          typename auctioneer_t = detail::VoidAuctioneer>
+          typename auctioneer_t = detail::VoidAuctioneer,
+          typename scalar_t = double>
 class EigenStepper {
  public:
   /// Jacobian, Covariance and State defintions
@@ -51,6 +58,12 @@ class EigenStepper {
   using CurvilinearState = std::tuple<CurvilinearParameters, Jacobian, double>;
   using BField = bfield_t;
 
+  /// Scalar, vector and transport matrix types of the Runge-Kutta stages
+  using StageScalar = scalar_t;
+  using StageVector = ActsVector<scalar_t, 3>;
+  using StageMatrix =
+      ActsMatrix<scalar_t, eFreeParametersSize, eFreeParametersSize>;
+
   /// @brief State for track parameter propagation
   ///
   /// It contains the stepping information and is provided thread local
@@ -158,14 +171,17 @@ class EigenStepper {
     /// Auctioneer for choosing the extension
     auctioneer_t auctioneer;
 
+    /// Volume of the last step size prediction
+    const TrackingVolume* predictionVolume = nullptr;
+
     /// @brief Storage of magnetic field and the sub steps during a RKN4 step
     struct {
       /// Magnetic field evaulations
-      Vector3D B_first, B_middle, B_last;
+      StageVector B_first, B_middle, B_last;
       /// k_i of the RKN4 algorithm
-      Vector3D k1, k2, k3, k4;
+      StageVector k1, k2, k3, k4;
       /// k_i elements of the momenta
-      std::array<double, 4> kQoP;
+      std::array<StageScalar, 4> kQoP;
     } stepData;
   };
 
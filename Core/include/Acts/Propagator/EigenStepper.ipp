@@ -6,14 +6,14 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
-template <typename B, typename E, typename A>
-Acts::EigenStepper<B, E, A>::EigenStepper(B bField)
+template <typename B, typename E, typename A, typename S>
+Acts::EigenStepper<B, E, A, S>::EigenStepper(B bField)
     : m_bField(std::move(bField)) {}
 
-template <typename B, typename E, typename A>
-auto Acts::EigenStepper<B, E, A>::boundState(State& state,
-                                             const Surface& surface,
-                                             bool reinitialize) const
+template <typename B, typename E, typename A, typename S>
+auto Acts::EigenStepper<B, E, A, S>::boundState(State& state,
+                                                const Surface& surface,
+                                                bool reinitialize) const
     -> BoundState {
   // Transport the covariance to here
   std::optional<Covariance> covOpt = std::nullopt;
@@ -36,9 +36,9 @@ auto Acts::EigenStepper<B, E, A>::boundState(State& state,
   return bState;
 }
 
-template <typename B, typename E, typename A>
-auto Acts::EigenStepper<B, E, A>::curvilinearState(State& state,
-                                                   bool reinitialize) const
+template <typename B, typename E, typename A, typename S>
+auto Acts::EigenStepper<B, E, A, S>::curvilinearState(State& state,
+                                                      bool reinitialize) const
     -> CurvilinearState {
   // Transport the covariance to here
   std::optional<Covariance> covOpt = std::nullopt;
@@ -60,9 +60,9 @@ auto Acts::EigenStepper<B, E, A>::curvilinearState(State& state,
   return curvState;
 }
 
-template <typename B, typename E, typename A>
-void Acts::EigenStepper<B, E, A>::update(State& state,
-                                         const BoundParameters& pars) const {
+template <typename B, typename E, typename A, typename S>
+void Acts::EigenStepper<B, E, A, S>::update(State& state,
+                                            const BoundParameters& pars) const {
   const auto& mom = pars.momentum();
   state.pos = pars.position();
   state.dir = mom.normalized();
@@ -73,20 +73,20 @@ void Acts::EigenStepper<B, E, A>::update(State& state,
   }
 }
 
-template <typename B, typename E, typename A>
-void Acts::EigenStepper<B, E, A>::update(State& state,
-                                         const Vector3D& uposition,
-                                         const Vector3D& udirection, double up,
-                                         double time) const {
+template <typename B, typename E, typename A, typename S>
+void Acts::EigenStepper<B, E, A, S>::update(State& state,
+                                            const Vector3D& uposition,
+                                            const Vector3D& udirection,
+                                            double up, double time) const {
   state.pos = uposition;
   state.dir = udirection;
   state.p = up;
   state.t = time;
 }
 
-template <typename B, typename E, typename A>
-void Acts::EigenStepper<B, E, A>::covarianceTransport(State& state,
-                                                      bool reinitialize) const {
+template <typename B, typename E, typename A, typename S>
+void Acts::EigenStepper<B, E, A, S>::covarianceTransport(
+    State& state, bool reinitialize) const {
   // Optimized trigonometry on the propagation direction
   const double x = state.dir(0);  // == cos(phi) * sin(theta)
   const double y = state.dir(1);  // == sin(phi) * sin(theta)
@@ -160,10 +160,9 @@ void Acts::EigenStepper<B, E, A>::covarianceTransport(State& state,
   state.jacobian = jacFull * state.jacobian;
 }
 
-template <typename B, typename E, typename A>
-void Acts::EigenStepper<B, E, A>::covarianceTransport(State& state,
-                                                      const Surface& surface,
-                                                      bool reinitialize) const {
+template <typename B, typename E, typename A, typename S>
+void Acts::EigenStepper<B, E, A, S>::covarianceTransport(
+    State& state, const Surface& surface, bool reinitialize) const {
   using VectorHelpers::phi;
   using VectorHelpers::theta;
 
@@ -203,9 +202,9 @@ void Acts::EigenStepper<B, E, A>::covarianceTransport(State& state,
   state.jacobian = jacFull * state.jacobian;
 }
 
-template <typename B, typename E, typename A>
+template <typename B, typename E, typename A, typename S>
 template <typename propagator_state_t>
-Acts::Result<double> Acts::EigenStepper<B, E, A>::step(
+Acts::Result<double> Acts::EigenStepper<B, E, A, S>::step(
     propagator_state_t& state) const {
   using namespace UnitLiterals;
 
@@ -214,8 +213,29 @@ Acts::Result<double> Acts::EigenStepper<B, E, A>::step(
   double error_estimate = 0.;
   double h2, half_h;
 
+  // Seed the accuracy step size with a prediction when starting and when
+  // entering a new volume
+  StepSizePredictor* predictor = state.options.stepSizePredictor;
+  const TrackingVolume* volume = nullptr;
+  if (predictor != nullptr) {
+    volume = detail::currentVolume(state.navigation);
+    const double accuracy =
+        state.stepping.stepSize.value(ConstrainedStep::accuracy);
+    if (std::abs(accuracy) == std::numeric_limits<double>::max() or
+        volume != state.stepping.predictionVolume) {
+      state.stepping.predictionVolume = volume;
+      const double prediction = predictor->predict(
+          volume, charge(state.stepping) / momentum(state.stepping),
+          state.stepping.dir);
+      if (prediction > 0.) {
+        state.stepping.stepSize = state.stepping.navDir * prediction;
+      }
+    }
+  }
+
   // First Runge-Kutta point (at current position)
-  sd.B_first = getField(state.stepping, state.stepping.pos);
+  sd.B_first = getField(state.stepping, state.stepping.pos)
+                   .template cast<StageScalar>();
   if (!state.stepping.extension.validExtensionForStep(state, *this) ||
       !state.stepping.extension.k1(state, *this, sd.k1, sd.B_first, sd.kQoP)) {
     return 0.;
@@ -231,9 +251,9 @@ Acts::Result<double> Acts::EigenStepper<B, E, A>::step(
     half_h = h * 0.5;
 
     // Second Runge-Kutta point
-    const Vector3D pos1 =
-        state.stepping.pos + half_h * state.stepping.dir + h2 * 0.125 * sd.k1;
-    sd.B_middle = getField(state.stepping, pos1);
+    const Vector3D pos1 = state.stepping.pos + half_h * state.stepping.dir +
+                          h2 * 0.125 * sd.k1.template cast<double>();
+    sd.B_middle = getField(state.stepping, pos1).template cast<StageScalar>();
     if (!state.stepping.extension.k2(state, *this, sd.k2, sd.B_middle, sd.kQoP,
                                      half_h, sd.k1)) {
       return false;
@@ -246,9 +266,9 @@ Acts::Result<double> Acts::EigenStepper<B, E, A>::step(
     }
 
     // Last Runge-Kutta point
-    const Vector3D pos2 =
-        state.stepping.pos + h * state.stepping.dir + h2 * 0.5 * sd.k3;
-    sd.B_last = getField(state.stepping, pos2);
+    const Vector3D pos2 = state.stepping.pos + h * state.stepping.dir +
+                          h2 * 0.5 * sd.k3.template cast<double>();
+    sd.B_last = getField(state.stepping, pos2).template cast<StageScalar>();
     if (!state.stepping.extension.k4(state, *this, sd.k4, sd.B_last, sd.kQoP, h,
                                      sd.k3)) {
       return false;
@@ -256,8 +276,9 @@ Acts::Result<double> Acts::EigenStepper<B, E, A>::step(
 
     // Compute and check the local integration error estimate
     error_estimate = std::max(
-        h2 * ((sd.k1 - sd.k2 - sd.k3 + sd.k4).template lpNorm<1>() +
-              std::abs(sd.kQoP[0] - sd.kQoP[1] - sd.kQoP[2] + sd.kQoP[3])),
+        h2 * double((sd.k1 - sd.k2 - sd.k3 + sd.k4).template lpNorm<1>() +
+                    std::abs(sd.kQoP[0] - sd.kQoP[1] - sd.kQoP[2] +
+                             sd.kQoP[3])),
         1e-20);
     return (error_estimate <= state.options.tolerance) &&
            ((h.currentType() != ConstrainedStep::accuracy) ||
@@ -299,16 +320,28 @@ Acts::Result<double> Acts::EigenStepper<B, E, A>::step(
   // use the adjusted step size
   const double h = state.stepping.stepSize;
 
+  // Remember the step size if it was limited by the accuracy
+  if (predictor != nullptr) {
+    predictor->countStep(nStepTrials + 1);
+    if (state.stepping.stepSize.currentType() == ConstrainedStep::accuracy) {
+      predictor->accept(volume,
+                        charge(state.stepping) / momentum(state.stepping),
+                        state.stepping.dir, h);
+    }
+  }
+
   // When doing error propagation, update the associated Jacobian matrix
   if (state.stepping.covTransport) {
     // The step transport matrix in global coordinates
-    FreeMatrix D;
+    StageMatrix D;
     if (!state.stepping.extension.finalize(state, *this, h, D)) {
       return EigenStepperError::StepInvalid;
     }
 
-    // for moment, only update the transport part
-    state.stepping.jacTransport = D * state.stepping.jacTransport;
+    // for moment, only update the transport part, the accumulation of the
+    // jacobian is always done in double precision
+    state.stepping.jacTransport =
+        D.template cast<double>() * state.stepping.jacTransport;
   } else {
     if (!state.stepping.extension.finalize(state, *this, h)) {
       return EigenStepperError::StepInvalid;
@@ -316,13 +349,16 @@ Acts::Result<double> Acts::EigenStepper<B, E, A>::step(
   }
 
   // Update the track parameters according to the equations of motion
-  state.stepping.pos +=
-      h * state.stepping.dir + h2 / 6. * (sd.k1 + sd.k2 + sd.k3);
-  state.stepping.dir += h / 6. * (sd.k1 + 2. * (sd.k2 + sd.k3) + sd.k4);
+  const Vector3D k1 = sd.k1.template cast<double>();
+  const Vector3D k2 = sd.k2.template cast<double>();
+  const Vector3D k3 = sd.k3.template cast<double>();
+  const Vector3D k4 = sd.k4.template cast<double>();
+  state.stepping.pos += h * state.stepping.dir + h2 / 6. * (k1 + k2 + k3);
+  state.stepping.dir += h / 6. * (k1 + 2. * (k2 + k3) + k4);
   state.stepping.dir /= state.stepping.dir.norm();
   if (state.stepping.covTransport) {
     state.stepping.derivative.template head<3>() = state.stepping.dir;
-    state.stepping.derivative.template segment<3>(4) = sd.k4;
+    state.stepping.derivative.template segment<3>(4) = k4;
   }
   state.stepping.pathAccumulated += h;
   return h;
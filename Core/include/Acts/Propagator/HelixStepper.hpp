@@ -0,0 +1,359 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cmath>
+#include <functional>
+#include <limits>
+
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/ConstrainedStep.hpp"
+#include "Acts/Propagator/detail/SteppingHelper.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Utilities/Definitions.hpp"
+#include "Acts/Utilities/Intersection.hpp"
+#include "Acts/Utilities/Result.hpp"
+#include "Acts/Utilities/Units.hpp"
+
+namespace Acts {
+
+/// @brief analytic helix stepper for a homogeneous magnetic field
+///
+/// The helix stepper moves the track along the exact solution of the
+/// equations of motion in a constant magnetic field. Each step requires a
+/// single (trivial) field lookup and the transport jacobian is computed
+/// analytically, i.e. there is no step size adaption and no step is ever
+/// rejected. The step length is only limited by the navigation and the
+/// configured maximum step size.
+///
+/// Continuous energy loss is not part of the equations of motion, material
+/// effects are only applied by the actors on surfaces.
+class HelixStepper {
+ public:
+  using Jacobian = BoundMatrix;
+  using Covariance = BoundSymMatrix;
+  using BoundState = std::tuple<BoundParameters, Jacobian, double>;
+  using CurvilinearState = std::tuple<CurvilinearParameters, Jacobian, double>;
+  using BField = ConstantBField;
+
+  /// State for track parameter propagation
+  ///
+  struct State {
+    /// Delete the default constructor
+    State() = delete;
+
+    /// Constructor from the initial track parameters
+    ///
+    /// @tparam parameters_t the Type of the track parameters
+    ///
+    /// @param [in] gctx is the context object for the geometery
+    /// @param [in] mctx is the context object for the magnetic field
+    /// @param [in] par The track parameters at start
+    /// @param [in] ndir is the navigation direction
+    /// @param [in] ssize is the (absolute) maximum step size
+    /// @param [in] stolerance is the stepping tolerance
+    template <typename parameters_t>
+    explicit State(std::reference_wrapper<const GeometryContext> gctx,
+                   std::reference_wrapper<const MagneticFieldContext> /*mctx*/,
+                   const parameters_t& par, NavigationDirection ndir = forward,
+                   double ssize = std::numeric_limits<double>::max(),
+                   double stolerance = s_onSurfaceTolerance)
+        : pos(par.position()),
+          dir(par.momentum().normalized()),
+          p(par.momentum().norm()),
+          q(par.charge()),
+          t(par.time()),
+          navDir(ndir),
+          stepSize(ndir * std::abs(ssize)),
+          tolerance(stolerance),
+          geoContext(gctx) {
+      if (par.covariance()) {
+        // Get the reference surface for navigation
+        const auto& surface = par.referenceSurface();
+        // set the covariance transport flag to true and copy
+        covTransport = true;
+        cov = BoundSymMatrix(*par.covariance());
+        surface.initJacobianToGlobal(gctx, jacToGlobal, pos, dir,
+                                     par.parameters());
+      }
+    }
+
+    /// Jacobian from local to the global frame
+    BoundToFreeMatrix jacToGlobal = BoundToFreeMatrix::Zero();
+
+    /// Pure transport jacobian part from the helix steps
+    FreeMatrix jacTransport = FreeMatrix::Identity();
+
+    /// The full jacobian of the transport entire transport
+    Jacobian jacobian = Jacobian::Identity();
+
+    /// The propagation derivative
+    FreeVector derivative = FreeVector::Zero();
+
+    /// Boolean to indiciate if you need covariance transport
+    bool covTransport = false;
+    Covariance cov = Covariance::Zero();
+
+    /// Global particle position
+    Vector3D pos = Vector3D(0., 0., 0.);
+
+    /// Momentum direction (normalized)
+    Vector3D dir = Vector3D(1., 0., 0.);
+
+    /// Momentum
+    double p = 0.;
+
+    /// The charge, neutral particles follow a straight line
+    double q = 1.;
+
+    /// Propagated time
+    double t = 0.;
+
+    /// Navigation direction, this is needed for searching
+    NavigationDirection navDir;
+
+    /// accummulated path length state
+    double pathAccumulated = 0.;
+
+    /// step size of the helix steps
+    ConstrainedStep stepSize = std::numeric_limits<double>::max();
+
+    // Previous step size for overstep estimation
+    double previousStepSize = 0.;
+
+    /// The tolerance for the stepping
+    double tolerance = s_onSurfaceTolerance;
+
+    // Cache the geometry context of this propagation
+    std::reference_wrapper<const GeometryContext> geoContext;
+  };
+
+  /// Always use the same propagation state type, independently of the initial
+  /// track parameter type and of the target surface
+  using state_type = State;
+
+  /// Constructor
+  ///
+  /// @param bField the constant magnetic field
+  HelixStepper(BField bField) : m_bField(std::move(bField)) {}
+
+  /// Get the field for the stepping
+  ///
+  /// @param [in,out] state is the propagation state associated with the track
+  /// @param [in] pos is the field position
+  Vector3D getField(State& /*state*/, const Vector3D& pos) const {
+    return m_bField.getField(pos);
+  }
+
+  /// Global particle position accessor
+  ///
+  /// @param state [in] The stepping state (thread-local cache)
+  Vector3D position(const State& state) const { return state.pos; }
+
+  /// Momentum direction accessor
+  ///
+  /// @param state [in] The stepping state (thread-local cache)
+  Vector3D direction(const State& state) const { return state.dir; }
+
+  /// Momentum accessor
+  ///
+  /// @param state [in] The stepping state (thread-local cache)
+  double momentum(const State& state) const { return state.p; }
+
+  /// Charge access
+  ///
+  /// @param state [in] The stepping state (thread-local cache)
+  double charge(const State& state) const { return state.q; }
+
+  /// Time access
+  ///
+  /// @param state [in] The stepping state (thread-local cache)
+  double time(const State& state) const { return state.t; }
+
+  /// Overstep limit
+  ///
+  /// @param state The stepping state (thread-local cache)
+  double overstepLimit(const State& /*state*/) const {
+    return -m_overstepLimit;
+  }
+
+  /// Update surface status
+  ///
+  /// This method intersect the provided surface and update the navigation
+  /// step estimation accordingly (hence it changes the state). It also
+  /// returns the status of the intersection to trigger onSurface in case
+  /// the surface is reached.
+  ///
+  /// @param state [in,out] The stepping state (thread-local cache)
+  /// @param surface [in] The surface provided
+  /// @param bcheck [in] The boundary check for this status update
+  Intersection::Status updateSurfaceStatus(State& state, const Surface& surface,
+                                           const BoundaryCheck& bcheck) const {
+    return detail::updateSingleSurfaceStatus<HelixStepper>(*this, state,
+                                                           surface, bcheck);
+  }
+
+  /// Update step size
+  ///
+  /// It checks the status to the reference surface & updates
+  /// the step size accordingly
+  ///
+  /// @param state [in,out] The stepping state (thread-local cache)
+  /// @param oIntersection [in] The ObjectIntersection to layer, boundary, etc
+  /// @param release [in] boolean to trigger step size release
+  template <typename object_intersection_t>
+  void updateStepSize(State& state, const object_intersection_t& oIntersection,
+                      bool release = true) const {
+    detail::updateSingleStepSize<HelixStepper>(state, oIntersection, release);
+  }
+
+  /// Set Step size - explicitely with a double
+  ///
+  /// @param state [in,out] The stepping state (thread-local cache)
+  /// @param stepSize [in] The step size value
+  /// @param stype [in] The step size type to be set
+  void setStepSize(State& state, double stepSize,
+                   ConstrainedStep::Type stype = ConstrainedStep::actor) const {
+    state.previousStepSize = state.stepSize;
+    state.stepSize.update(stepSize, stype, true);
+  }
+
+  /// Release the Step size
+  ///
+  /// @param state [in,out] The stepping state (thread-local cache)
+  void releaseStepSize(State& state) const {
+    state.stepSize.release(ConstrainedStep::actor);
+  }
+
+  /// Output the Step Size - single component
+  ///
+  /// @param state [in,out] The stepping state (thread-local cache)
+  std::string outputStepSize(const State& state) const {
+    return state.stepSize.toString();
+  }
+
+  /// Create and return the bound state at the current position
+  ///
+  /// @brief It does not check if the transported state is at the surface, this
+  /// needs to be guaranteed by the propagator
+  ///
+  /// @param [in] state State that will be presented as @c BoundState
+  /// @param [in] surface The surface to which we bind the state
+  /// @param [in] reinitialize Boolean flag whether reinitialization is needed,
+  /// i.e. if this is an intermediate state of a larger propagation
+  ///
+  /// @return A bound state:
+  ///   - the parameters at the surface
+  ///   - the stepwise jacobian towards it (from last bound)
+  ///   - and the path length (from start - for ordering)
+  BoundState boundState(State& state, const Surface& surface,
+                        bool reinitialize) const;
+
+  /// Create and return a curvilinear state at the current position
+  ///
+  /// @brief This creates a curvilinear state.
+  ///
+  /// @param [in] state State that will be presented as @c CurvilinearState
+  /// @param [in] reinitialize Boolean flag whether reinitialization is needed,
+  /// i.e. if this is an intermediate state of a larger propagation
+  ///
+  /// @return A curvilinear state:
+  ///   - the curvilinear parameters at given position
+  ///   - the stepweise jacobian towards it (from last bound)
+  ///   - and the path length (from start - for ordering)
+  CurvilinearState curvilinearState(State& state, bool reinitialize) const;
+
+  /// Method to update a stepper state to the some parameters
+  ///
+  /// @param [in,out] state State object that will be updated
+  /// @param [in] pars Parameters that will be written into @p state
+  void update(State& state, const BoundParameters& pars) const;
+
+  /// Method to update momentum, direction and p
+  ///
+  /// @param [in,out] state State object that will be updated
+  /// @param [in] uposition the updated position
+  /// @param [in] udirection the updated direction
+  /// @param [in] up the updated momentum value
+  /// @param [in] time the updated time value
+  void update(State& state, const Vector3D& uposition,
+              const Vector3D& udirection, double up, double time) const;
+
+  /// Method for on-demand transport of the covariance
+  /// to a new curvilinear frame at current  position,
+  /// or direction of the state
+  ///
+  /// @param [in,out] state State of the stepper
+  /// @param [in] reinitialize is a flag to steer whether the
+  ///        state should be reinitialized at the new
+  ///        position
+  void covarianceTransport(State& state, bool reinitialize = false) const;
+
+  /// Method for on-demand transport of the covariance
+  /// to a new curvilinear frame at current  position,
+  /// or direction of the state
+  ///
+  /// @param [in,out] state The stepper state
+  /// @param [in] surface is the surface to which the covariance is
+  ///        forwarded to
+  /// @param [in] reinitialize is a flag to steer whether the
+  ///        state should be reinitialized at the new
+  ///        position
+  /// @note no check is done if the position is actually on the surface
+  void covarianceTransport(State& state, const Surface& surface,
+                           bool reinitialize = false) const;
+
+  /// Perform a helix propagation step
+  ///
+  /// @param [in,out] state is the propagation state associated with the track
+  /// parameters that are being propagated.
+  ///                The state contains the desired step size,
+  ///                it can be negative during backwards track propagation.
+  ///
+  /// @return the step size taken
+  template <typename propagator_state_t>
+  Result<double> step(propagator_state_t& state) const {
+    // use the full step size, the helix is exact
+    const double h = state.stepping.stepSize;
+    advance(state.stepping, h, state.options.mass);
+    return h;
+  }
+
+  /// Move the state along the helix by a given path length
+  ///
+  /// This does not need a propagation state and can be used to transport
+  /// parameters directly, e.g. to a known point of closest approach.
+  ///
+  /// @param [in,out] state The stepping state
+  /// @param [in] pathLength The signed path length to advance
+  /// @param [in] mass The particle mass
+  void advance(State& state, double pathLength, double mass) const;
+
+ private:
+  /// Move the state along the helix and update the transport jacobian
+  ///
+  /// @param [in,out] state The stepping state
+  /// @param [in] bField The magnetic field at the start of the step
+  /// @param [in] h The (signed) step length
+  /// @param [in] dtds The derivative of the time wrt. the path length
+  /// @param [in] mass The particle mass
+  void helixStep(State& state, const Vector3D& bField, double h, double dtds,
+                 double mass) const;
+
+  /// The magnetic field
+  BField m_bField;
+
+  /// Overstep limit, same as for the EigenStepper
+  double m_overstepLimit = 100 * UnitConstants::um;
+};
+
+}  // namespace Acts
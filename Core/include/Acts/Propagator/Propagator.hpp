@@ -24,10 +24,12 @@
 #include "Acts/Propagator/ActionList.hpp"
 #include "Acts/Propagator/PropagatorError.hpp"
 #include "Acts/Propagator/StandardAborters.hpp"
+#include "Acts/Propagator/StepSizePredictor.hpp"
 #include "Acts/Propagator/StepperConcept.hpp"
 #include "Acts/Propagator/detail/LoopProtection.hpp"
 #include "Acts/Propagator/detail/VoidPropagatorComponents.hpp"
 #include "Acts/Utilities/Definitions.hpp"
+#include "Acts/Utilities/Instrumentation.hpp"
 #include "Acts/Utilities/Result.hpp"
 #include "Acts/Utilities/Units.hpp"
 
@@ -111,6 +113,7 @@ struct PropagatorOptions {
     // Stepper options
     eoptions.tolerance = tolerance;
     eoptions.stepSizeCutOff = stepSizeCutOff;
+    eoptions.stepSizePredictor = stepSizePredictor;
     // Action / abort list
     eoptions.actionList = std::move(actionList);
     eoptions.abortList = std::move(aborters);
@@ -162,6 +165,9 @@ struct PropagatorOptions {
   /// Cut-off value for the step size
   double stepSizeCutOff = 0.;
 
+  /// Optional (thread-local) cache of accepted step sizes
+  StepSizePredictor* stepSizePredictor = nullptr;
+
   /// List of actions
   action_list_t actionList;
 
@@ -93,6 +93,7 @@ auto Acts::Propagator<S, N>::propagate(
         typename propagator_options_t::action_list_type>> {
   static_assert(ParameterConcept<parameters_t>,
                 "Parameters do not fulfill parameter concept.");
+  ACTS_INSTRUMENT_SCOPE("Propagator::propagate");
 
   // Type of track parameters produced by the propagation
   using ReturnParameterType = CurvilinearParameters;
@@ -161,6 +162,7 @@ auto Acts::Propagator<S, N>::propagate(
         BoundParameters, typename propagator_options_t::action_list_type>> {
   static_assert(ParameterConcept<parameters_t>,
                 "Parameters do not fulfill parameter concept.");
+  ACTS_INSTRUMENT_SCOPE("Propagator::propagate");
 
   // Type of track parameters produced at the end of the propagation
   using return_parameter_type = BoundParameters;
@@ -8,8 +8,15 @@
 
 #pragma once
 
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <system_error>
+#include <vector>
+
 #include "Acts/Propagator/Propagator.hpp"
 #include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Utilities/TaskPool.hpp"
 
 namespace Acts {
 
@@ -30,6 +37,13 @@ namespace Acts {
 /// more time than a single propagation towards a target + a common propagation
 /// of the covariance, this class just serves to verify the results of the
 /// latter classes.
+///
+/// The propagations of the deviated start parameters are independent of each
+/// other. If a TaskPool is provided they are executed concurrently, each
+/// propagation creates its own propagator state (and therewith its own
+/// stepper and navigator state). The underlying propagator is only used
+/// through its const interface and has to be safe to use concurrently, which
+/// is the case for the steppers and navigators provided by Acts.
 template <typename propagator_t>
 class RiddersPropagator {
   using Jacobian = BoundMatrix;
@@ -61,7 +75,10 @@ class RiddersPropagator {
   /// @brief Constructor using a propagator
   ///
   /// @param [in] propagator Underlying propagator that will be used
-  RiddersPropagator(propagator_t& propagator) : m_propagator(propagator) {}
+  /// @param [in] taskPool Optional pool to run the propagations concurrently
+  RiddersPropagator(propagator_t& propagator,
+                    std::shared_ptr<TaskPool> taskPool = nullptr)
+      : m_propagator(propagator), m_taskPool(std::move(taskPool)) {}
 
   /// @brief Constructor building a propagator
   ///
@@ -70,9 +87,12 @@ class RiddersPropagator {
   ///
   /// @param [in] stepper Stepper that will be used
   /// @param [in] navigator Navigator that will be used
+  /// @param [in] taskPool Optional pool to run the propagations concurrently
   template <typename stepper_t, typename navigator_t = detail::VoidNavigator>
-  RiddersPropagator(stepper_t stepper, navigator_t navigator = navigator_t())
-      : m_propagator(Propagator(stepper, navigator)) {}
+  RiddersPropagator(stepper_t stepper, navigator_t navigator = navigator_t(),
+                    std::shared_ptr<TaskPool> taskPool = nullptr)
+      : m_propagator(Propagator(stepper, navigator)),
+        m_taskPool(std::move(taskPool)) {}
 
   /// @brief Propagation method targeting curvilinear parameters
   ///
@@ -106,7 +126,41 @@ class RiddersPropagator {
   propagate(const parameters_t& start, const Surface& target,
             const propagator_options_t& options) const;
 
+  /// @brief Batched propagation method targeting bound parameters
+  ///
+  /// @tparam parameters_t Type of the start parameters
+  /// @tparam propagator_options_t Type of the propagator options
+  ///
+  /// @param [in] starts Start parameters of all propagations
+  /// @param [in] target Target surface
+  /// @param [in] options Options of the propagations
+  ///
+  /// @return Result of each propagation, in the order of the start parameters
+  ///
+  /// All nominal propagations and afterwards all propagations of the deviated
+  /// start parameters are scheduled at once. This keeps the task pool busy
+  /// even if the number of deviations per request is small. A failed nominal
+  /// propagation, or a failed propagation of its deviated start parameters,
+  /// is reported in the corresponding result only.
+  template <typename parameters_t, typename propagator_options_t>
+  std::vector<Result<action_list_t_result_t<
+      BoundParameters, typename propagator_options_t::action_list_type>>>
+  propagate(const std::vector<parameters_t>& starts, const Surface& target,
+            const propagator_options_t& options) const;
+
  private:
+  /// Derivatives of the end parameters wrt. each start parameter
+  using Derivatives =
+      std::array<std::vector<BoundVector>, eBoundParametersSize>;
+
+  /// @brief Run a number of independent tasks, concurrently if a task pool
+  /// is available
+  ///
+  /// @param [in] n Number of tasks
+  /// @param [in] func Function to be called with each task index
+  template <typename function_t>
+  void runTasks(size_t n, function_t&& func) const;
+
   /// @brief This function tests whether the variations on a disc as target
   /// surface lead to results on different sides wrt the center of the disc.
   /// This would lead to a flip of the phi value on the surface and therewith to
@@ -119,25 +173,65 @@ class RiddersPropagator {
   bool inconsistentDerivativesOnDisc(
       const std::vector<BoundVector>& derivatives) const;
 
-  /// @brief This function wiggles one dimension of the starting parameters,
-  /// performs the propagation to a surface and collects for each change of the
-  /// start parameters the slope
+  /// @brief This function wiggles each dimension of the starting parameters,
+  /// performs the propagations to a surface and collects for each change of
+  /// the start parameters the slope
   ///
   /// @tparam options_t PropagatorOptions object
-  /// @tparam parameters+t Type of the parameters to start the propagation with
+  /// @tparam parameters_t Type of the parameters to start the propagation with
   ///
   /// @param [in] options Options do define how to wiggle
-  /// @param [in] startPart Start parameters that are modified
-  /// @param [in] param Index to get the parameter that will be modified
+  /// @param [in] startPars Start parameters that are modified
   /// @param [in] target Target surface
   /// @param [in] nominal Nominal end parameters
+  /// @param [in] deviations Deviations applied to each parameter
   ///
-  /// @return Vector containing each slope
+  /// @return Slopes for each parameter and deviation, or the error of the
+  /// first failed propagation
   template <typename options_t, typename parameters_t>
-  std::vector<BoundVector> wiggleDimension(
+  Result<Derivatives> wiggleParameters(
       const options_t& options, const parameters_t& startPars,
-      const unsigned int param, const Surface& target,
-      const BoundVector& nominal, const std::vector<double>& deviations) const;
+      const Surface& target, const BoundVector& nominal,
+      const std::vector<double>& deviations) const;
+
+  /// @brief This function wiggles one dimension of the starting parameters
+  /// by a single deviation, performs the propagation to a surface and returns
+  /// the slope
+  ///
+  /// @tparam options_t PropagatorOptions object
+  /// @tparam parameters_t Type of the parameters to start the propagation with
+  ///
+  /// @param [in] options Options do define how to wiggle
+  /// @param [in] startPars Start parameters that are modified
+  /// @param [in] param Index to get the parameter that will be modified
+  /// @param [in] h Deviation of the parameter
+  /// @param [in] target Target surface
+  /// @param [in] nominal Nominal end parameters
+  ///
+  /// @return The slope, or the error of the failed propagation
+  template <typename options_t, typename parameters_t>
+  Result<BoundVector> wiggleParameter(const options_t& options,
+                                      const parameters_t& startPars,
+                                      const unsigned int param, double h,
+                                      const Surface& target,
+                                      const BoundVector& nominal) const;
+
+  /// @brief Replace the covariance of the nominal end parameters by the
+  /// Ridders covariance
+  ///
+  /// @param [in, out] nominalResult Result of the nominal propagation
+  /// @param [in] start Start parameters
+  /// @param [in] target Target surface
+  /// @param [in] derivatives Slopes of each modification of the parameters
+  /// @param [in] deviations Deviations applied to each parameter
+  template <typename result_t, typename parameters_t>
+  void setRiddersCovariance(result_t& nominalResult, const parameters_t& start,
+                            const Surface& target,
+                            const Derivatives& derivatives,
+                            const std::vector<double>& deviations) const;
+
+  /// @brief The deviations used for the propagations to a given surface
+  std::vector<double> targetDeviations(const Surface& target) const;
 
   /// @brief This function propagates the covariance matrix
   ///
@@ -146,9 +240,8 @@ class RiddersPropagator {
   ///
   /// @return Propagated covariance matrix
   const Covariance calculateCovariance(
-      const std::array<std::vector<BoundVector>, eBoundParametersSize>&
-          derivatives,
-      const Covariance& startCov, const std::vector<double>& deviations) const;
+      const Derivatives& derivatives, const Covariance& startCov,
+      const std::vector<double>& deviations) const;
 
   /// @brief This function fits a linear function through the final state
   /// parametrisations
@@ -161,6 +254,9 @@ class RiddersPropagator {
 
   /// Propagator
   propagator_t m_propagator;
+
+  /// Optional pool to run the propagations concurrently
+  std::shared_ptr<TaskPool> m_taskPool;
 };
 }  // namespace Acts
 
@@ -28,12 +28,10 @@ auto Acts::RiddersPropagator<propagator_t>::propagate(
   opts.pathLimit *= 2.;
 
   // Derivations of each parameter around the nominal parameters
-  std::array<std::vector<BoundVector>, eBoundParametersSize> derivatives;
-
-  // Wiggle each dimension individually
-  for (unsigned int i = 0; i < eBoundParametersSize; i++) {
-    derivatives[i] =
-        wiggleDimension(opts, start, i, surface, nominalParameters, deviations);
+  auto derivatives =
+      wiggleParameters(opts, start, surface, nominalParameters, deviations);
+  if (not derivatives.ok()) {
+    return derivatives.error();
   }
   // Exchange the result by Ridders Covariance
   const FullParameterSet& parSet =
@@ -41,7 +39,7 @@ auto Acts::RiddersPropagator<propagator_t>::propagate(
   FullParameterSet* mParSet = const_cast<FullParameterSet*>(&parSet);
   if (start.covariance()) {
     mParSet->setCovariance(
-        calculateCovariance(derivatives, *start.covariance(), deviations));
+        calculateCovariance(*derivatives, *start.covariance(), deviations));
   }
 
   return std::move(nominalResult);
@@ -60,11 +58,117 @@ auto Acts::RiddersPropagator<propagator_t>::propagate(
       nominalResult.endParameters->parameters();
 
   // Steps for estimating derivatives
-  std::vector<double> deviations = {-4e-4, -2e-4, 2e-4, 4e-4};
-  if (target.type() == Surface::Disc) {
-    deviations = {{-3e-5, -1e-5, 1e-5, 3e-5}};
+  std::vector<double> deviations = targetDeviations(target);
+
+  // Allow larger distances for the oscillation
+  propagator_options_t opts = options;
+  opts.pathLimit *= 2.;
+
+  // Derivations of each parameter around the nominal parameters
+  auto derivatives =
+      wiggleParameters(opts, start, target, nominalParameters, deviations);
+  if (not derivatives.ok()) {
+    return derivatives.error();
   }
 
+  // Exchange the result by Ridders Covariance
+  setRiddersCovariance(nominalResult, start, target, *derivatives,
+                       deviations);
+  return std::move(nominalResult);
+}
+
+template <typename propagator_t>
+template <typename parameters_t, typename propagator_options_t>
+auto Acts::RiddersPropagator<propagator_t>::propagate(
+    const std::vector<parameters_t>& starts, const Surface& target,
+    const propagator_options_t& options) const
+    -> std::vector<Result<action_list_t_result_t<
+        BoundParameters, typename propagator_options_t::action_list_type>>> {
+  using ResultType = Result<action_list_t_result_t<
+      BoundParameters, typename propagator_options_t::action_list_type>>;
+
+  // Launch all nominal propagations
+  std::vector<std::optional<ResultType>> nominalResults(starts.size());
+  runTasks(starts.size(), [&](size_t is) {
+    nominalResults[is].emplace(
+        m_propagator.propagate(starts[is], target, options));
+  });
+
+  // Steps for estimating derivatives
+  std::vector<double> deviations = targetDeviations(target);
+  const size_t nDeviations = deviations.size();
+  const size_t nWiggles = eBoundParametersSize * nDeviations;
+
+  // Allow larger distances for the oscillation
+  propagator_options_t opts = options;
+  opts.pathLimit *= 2.;
+
+  // Wiggle all dimensions of all successful propagations at once
+  std::vector<size_t> wiggled;
+  std::vector<Derivatives> derivatives;
+  for (size_t is = 0; is < starts.size(); ++is) {
+    if (nominalResults[is]->ok()) {
+      wiggled.push_back(is);
+      derivatives.emplace_back();
+      for (auto& deriv : derivatives.back()) {
+        deriv.resize(nDeviations);
+      }
+    }
+  }
+  // A failed wiggle is only recorded, it invalidates just its own track
+  std::vector<std::error_code> wiggleErrors(wiggled.size() * nWiggles);
+  runTasks(wiggled.size() * nWiggles, [&](size_t it) {
+    const size_t iw = it / nWiggles;
+    const unsigned int param = (it % nWiggles) / nDeviations;
+    const size_t id = it % nDeviations;
+    const BoundVector& nominal =
+        (**nominalResults[wiggled[iw]]).endParameters->parameters();
+    auto derivative = wiggleParameter(opts, starts[wiggled[iw]], param,
+                                      deviations[id], target, nominal);
+    if (derivative.ok()) {
+      derivatives[iw][param][id] = *derivative;
+    } else {
+      wiggleErrors[it] = derivative.error();
+    }
+  });
+
+  // Exchange the results by Ridders Covariance
+  for (size_t iw = 0; iw < wiggled.size(); ++iw) {
+    auto firstError = wiggleErrors.begin() + iw * nWiggles;
+    auto failed = std::find_if(firstError, firstError + nWiggles,
+                               [](const auto& error) { return bool(error); });
+    if (failed != firstError + nWiggles) {
+      nominalResults[wiggled[iw]].emplace(*failed);
+      continue;
+    }
+    setRiddersCovariance(**nominalResults[wiggled[iw]], starts[wiggled[iw]],
+                         target, derivatives[iw], deviations);
+  }
+
+  std::vector<ResultType> results;
+  results.reserve(starts.size());
+  for (auto& nominalResult : nominalResults) {
+    results.push_back(std::move(*nominalResult));
+  }
+  return results;
+}
+
+template <typename propagator_t>
+template <typename function_t>
+void Acts::RiddersPropagator<propagator_t>::runTasks(
+    size_t n, function_t&& func) const {
+  if (m_taskPool) {
+    m_taskPool->parallelFor(n, std::forward<function_t>(func));
+  } else {
+    for (size_t i = 0; i < n; ++i) {
+      func(i);
+    }
+  }
+}
+
+template <typename propagator_t>
+std::vector<double> Acts::RiddersPropagator<propagator_t>::targetDeviations(
+    const Surface& target) const {
   // - for planar surfaces the dest surface is a perfect destination
   // surface for the numerical propagation, as reference frame
   // aligns with the referenceSurface.transform().rotation() at
@@ -73,40 +177,38 @@ auto Acts::RiddersPropagator<propagator_t>::propagate(
   // - for straw & cylinder, where the error is given
   // in the reference frame that re-aligns with a slightly different
   // intersection solution
+  if (target.type() == Surface::Disc) {
+    return {-3e-5, -1e-5, 1e-5, 3e-5};
+  }
+  return {-4e-4, -2e-4, 2e-4, 4e-4};
+}
 
-  // Allow larger distances for the oscillation
-  propagator_options_t opts = options;
-  opts.pathLimit *= 2.;
-
-  // Derivations of each parameter around the nominal parameters
-  std::array<std::vector<BoundVector>, eBoundParametersSize> derivatives;
-
-  // Wiggle each dimension individually
-  for (unsigned int i = 0; i < eBoundParametersSize; i++) {
-    derivatives[i] =
-        wiggleDimension(opts, start, i, target, nominalParameters, deviations);
+template <typename propagator_t>
+template <typename result_t, typename parameters_t>
+void Acts::RiddersPropagator<propagator_t>::setRiddersCovariance(
+    result_t& nominalResult, const parameters_t& start, const Surface& target,
+    const Derivatives& derivatives,
+    const std::vector<double>& deviations) const {
+  if (!start.covariance()) {
+    return;
   }
-  // Exchange the result by Ridders Covariance
   const FullParameterSet& parSet =
       nominalResult.endParameters->getParameterSet();
   FullParameterSet* mParSet = const_cast<FullParameterSet*>(&parSet);
-  if (start.covariance()) {
-    // Test if target is disc - this may lead to inconsistent results
-    if (target.type() == Surface::Disc) {
-      for (const std::vector<BoundVector>& deriv : derivatives) {
-        if (inconsistentDerivativesOnDisc(deriv)) {
-          // Set covariance to zero and return
-          // TODO: This should be changed to indicate that something went
-          // wrong
-          mParSet->setCovariance(Covariance::Zero());
-          return std::move(nominalResult);
-        }
+  // Test if target is disc - this may lead to inconsistent results
+  if (target.type() == Surface::Disc) {
+    for (const std::vector<BoundVector>& deriv : derivatives) {
+      if (inconsistentDerivativesOnDisc(deriv)) {
+        // Set covariance to zero and return
+        // TODO: This should be changed to indicate that something went
+        // wrong
+        mParSet->setCovariance(Covariance::Zero());
+        return;
       }
     }
-    mParSet->setCovariance(
-        calculateCovariance(derivatives, *start.covariance(), deviations));
   }
-  return std::move(nominalResult);
+  mParSet->setCovariance(
+      calculateCovariance(derivatives, *start.covariance(), deviations));
 }
 
 template <typename propagator_t>
@@ -134,83 +236,111 @@ bool Acts::RiddersPropagator<propagator_t>::inconsistentDerivativesOnDisc(
 
 template <typename propagator_t>
 template <typename options_t, typename parameters_t>
-std::vector<Acts::BoundVector>
-Acts::RiddersPropagator<propagator_t>::wiggleDimension(
+auto Acts::RiddersPropagator<propagator_t>::wiggleParameters(
     const options_t& options, const parameters_t& startPars,
-    const unsigned int param, const Surface& target,
-    const Acts::BoundVector& nominal,
-    const std::vector<double>& deviations) const {
+    const Surface& target, const Acts::BoundVector& nominal,
+    const std::vector<double>& deviations) const -> Result<Derivatives> {
   // Storage of the results
-  std::vector<BoundVector> derivatives;
-  derivatives.reserve(deviations.size());
-  for (double h : deviations) {
-    parameters_t tp = startPars;
-
-    // Treatment for theta
-    if (param == eTHETA) {
-      const double current_theta = tp.template get<eTHETA>();
-      if (current_theta + h > M_PI) {
-        h = M_PI - current_theta;
-      }
-      if (current_theta + h < 0) {
-        h = -current_theta;
-      }
+  Derivatives derivatives;
+  for (auto& deriv : derivatives) {
+    deriv.resize(deviations.size());
+  }
+  // Each dimension and deviation is propagated individually
+  const size_t nDeviations = deviations.size();
+  std::vector<std::error_code> errors(eBoundParametersSize * nDeviations);
+  runTasks(eBoundParametersSize * nDeviations, [&](size_t it) {
+    const unsigned int param = it / nDeviations;
+    const size_t id = it % nDeviations;
+    auto derivative = wiggleParameter(options, startPars, param,
+                                      deviations[id], target, nominal);
+    if (derivative.ok()) {
+      derivatives[param][id] = *derivative;
+    } else {
+      errors[it] = derivative.error();
     }
+  });
+  for (const auto& error : errors) {
+    if (error) {
+      return error;
+    }
+  }
+  return derivatives;
+}
 
-    // Modify start parameter and propagate
-    switch (param) {
-      case 0: {
-        tp.template set<eLOC_0>(options.geoContext,
-                                tp.template get<eLOC_0>() + h);
-        break;
-      }
-      case 1: {
-        tp.template set<eLOC_1>(options.geoContext,
-                                tp.template get<eLOC_1>() + h);
-        break;
-      }
-      case 2: {
-        tp.template set<ePHI>(options.geoContext, tp.template get<ePHI>() + h);
-        break;
-      }
-      case 3: {
-        tp.template set<eTHETA>(options.geoContext,
-                                tp.template get<eTHETA>() + h);
-        break;
-      }
-      case 4: {
-        tp.template set<eQOP>(options.geoContext, tp.template get<eQOP>() + h);
-        break;
-      }
-      case 5: {
-        tp.template set<eT>(options.geoContext, tp.template get<eT>() + h);
-        break;
-      }
-      default:
-        return {};
+template <typename propagator_t>
+template <typename options_t, typename parameters_t>
+auto Acts::RiddersPropagator<propagator_t>::wiggleParameter(
+    const options_t& options, const parameters_t& startPars,
+    const unsigned int param, double h, const Surface& target,
+    const Acts::BoundVector& nominal) const -> Result<BoundVector> {
+  parameters_t tp = startPars;
+
+  // Treatment for theta
+  if (param == eTHETA) {
+    const double current_theta = tp.template get<eTHETA>();
+    if (current_theta + h > M_PI) {
+      h = M_PI - current_theta;
     }
-    const auto& r = m_propagator.propagate(tp, target, options).value();
-    // Collect the slope
-    derivatives.push_back((r.endParameters->parameters() - nominal) / h);
+    if (current_theta + h < 0) {
+      h = -current_theta;
+    }
+  }
 
-    // Correct for a possible variation of phi around
-    if (param == 2) {
-      double phi0 = nominal(Acts::ePHI);
-      double phi1 = r.endParameters->parameters()(Acts::ePHI);
-      if (std::abs(phi1 + 2. * M_PI - phi0) < std::abs(phi1 - phi0))
-        derivatives.back()[Acts::ePHI] = (phi1 + 2. * M_PI - phi0) / h;
-      else if (std::abs(phi1 - 2. * M_PI - phi0) < std::abs(phi1 - phi0))
-        derivatives.back()[Acts::ePHI] = (phi1 - 2. * M_PI - phi0) / h;
+  // Modify start parameter and propagate
+  switch (param) {
+    case 0: {
+      tp.template set<eLOC_0>(options.geoContext,
+                              tp.template get<eLOC_0>() + h);
+      break;
+    }
+    case 1: {
+      tp.template set<eLOC_1>(options.geoContext,
+                              tp.template get<eLOC_1>() + h);
+      break;
+    }
+    case 2: {
+      tp.template set<ePHI>(options.geoContext, tp.template get<ePHI>() + h);
+      break;
+    }
+    case 3: {
+      tp.template set<eTHETA>(options.geoContext,
+                              tp.template get<eTHETA>() + h);
+      break;
+    }
+    case 4: {
+      tp.template set<eQOP>(options.geoContext, tp.template get<eQOP>() + h);
+      break;
     }
+    case 5: {
+      tp.template set<eT>(options.geoContext, tp.template get<eT>() + h);
+      break;
+    }
+    default:
+      return Result<BoundVector>::success(BoundVector::Zero());
   }
-  return derivatives;
+  auto result = m_propagator.propagate(tp, target, options);
+  if (not result.ok()) {
+    return Result<BoundVector>::failure(result.error());
+  }
+  const auto& r = *result;
+  // Collect the slope
+  BoundVector derivative = (r.endParameters->parameters() - nominal) / h;
+
+  // Correct for a possible variation of phi around
+  if (param == 2) {
+    double phi0 = nominal(Acts::ePHI);
+    double phi1 = r.endParameters->parameters()(Acts::ePHI);
+    if (std::abs(phi1 + 2. * M_PI - phi0) < std::abs(phi1 - phi0))
+      derivative[Acts::ePHI] = (phi1 + 2. * M_PI - phi0) / h;
+    else if (std::abs(phi1 - 2. * M_PI - phi0) < std::abs(phi1 - phi0))
+      derivative[Acts::ePHI] = (phi1 - 2. * M_PI - phi0) / h;
+  }
+  return Result<BoundVector>::success(std::move(derivative));
 }
 
 template <typename propagator_t>
 auto Acts::RiddersPropagator<propagator_t>::calculateCovariance(
-    const std::array<std::vector<Acts::BoundVector>,
-                     Acts::eBoundParametersSize>& derivatives,
-    const Acts::BoundSymMatrix& startCov,
+    const Derivatives& derivatives, const Acts::BoundSymMatrix& startCov,
     const std::vector<double>& deviations) const -> const Covariance {
   Jacobian jacobian;
   jacobian.setIdentity();
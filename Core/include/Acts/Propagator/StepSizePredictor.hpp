@@ -0,0 +1,176 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+
+#include "Acts/Utilities/Definitions.hpp"
+#include "Acts/Utilities/TypeTraits.hpp"
+#include "Acts/Utilities/Units.hpp"
+
+namespace Acts {
+
+class TrackingVolume;
+
+/// @class StepSizePredictor
+///
+/// @brief Cache of accepted step sizes for the adaptive Runge-Kutta stepping
+///
+/// The predictor remembers the last step size that was accepted while the
+/// accuracy constraint was limiting, keyed on the tracking volume, the
+/// |q/p| bin and the eta bin of the track. A propagation that starts, or
+/// enters a new volume, is seeded with the remembered value instead of the
+/// maximum step size, which avoids most of the rejected trial steps.
+///
+/// It also counts the trial and the rejected steps, which can be used to
+/// judge the stepping performance with and without prediction.
+///
+/// @note The predictor is not thread-safe, every thread needs its own
+/// instance, e.g. one per event-processing thread. It is attached to the
+/// propagation through `PropagatorOptions::stepSizePredictor`.
+class StepSizePredictor {
+ public:
+  /// @brief Configuration of the binning
+  struct Config {
+    /// Number of |q/p| bins
+    size_t nQopBins = 20;
+    /// Upper edge of the |q/p| binning, larger values go into the last bin
+    double maxAbsQop = 1 / (100 * UnitConstants::MeV);
+    /// Number of eta bins
+    size_t nEtaBins = 20;
+    /// Eta range (symmetric), values outside go into the first/last bin
+    double maxAbsEta = 4.;
+    /// Seed the steps with predictions, if false only statistics are filled
+    bool predict = true;
+  };
+
+  /// @brief Stepping statistics
+  struct Statistics {
+    /// Number of accepted steps
+    size_t nSteps = 0;
+    /// Number of trial steps, including the accepted ones
+    size_t nTrials = 0;
+    /// Number of rejected trial steps
+    size_t nRejected = 0;
+    /// Number of steps that were seeded with a prediction
+    size_t nPredictions = 0;
+
+    /// Fraction of rejected trial steps
+    double rejectionFraction() const {
+      return nTrials > 0 ? double(nRejected) / nTrials : 0.;
+    }
+  };
+
+  /// Default constructor with the default configuration
+  StepSizePredictor();
+
+  /// Constructor
+  ///
+  /// @param cfg The binning configuration
+  explicit StepSizePredictor(const Config& cfg);
+
+  /// Predict the step size for a track
+  ///
+  /// @param volume The current tracking volume, can be nullptr
+  /// @param qop The charge over momentum of the track
+  /// @param dir The direction of the track
+  ///
+  /// @return the (absolute) predicted step size or zero if there is none
+  double predict(const TrackingVolume* volume, double qop,
+                 const Vector3D& dir);
+
+  /// Remember an accepted step size
+  ///
+  /// @param volume The current tracking volume, can be nullptr
+  /// @param qop The charge over momentum of the track
+  /// @param dir The direction of the track
+  /// @param stepSize The accepted (signed) step size
+  void accept(const TrackingVolume* volume, double qop, const Vector3D& dir,
+              double stepSize);
+
+  /// Count an accepted step
+  ///
+  /// @param nTrials The number of trials for this step, including the
+  ///        accepted one
+  void countStep(size_t nTrials) {
+    m_statistics.nSteps += 1;
+    m_statistics.nTrials += nTrials;
+    m_statistics.nRejected += nTrials - 1;
+  }
+
+  /// Access to the statistics
+  const Statistics& statistics() const { return m_statistics; }
+
+  /// Reset the statistics, the remembered step sizes are kept
+  void resetStatistics() { m_statistics = Statistics(); }
+
+  /// Forget all remembered step sizes
+  void clear() { m_stepSizes.clear(); }
+
+  /// Number of remembered step sizes
+  size_t size() const { return m_stepSizes.size(); }
+
+  /// Access to the configuration
+  const Config& config() const { return m_cfg; }
+
+ private:
+  /// Key of the remembered step sizes
+  struct Key {
+    const TrackingVolume* volume;
+    size_t qopBin;
+    size_t etaBin;
+
+    bool operator==(const Key& other) const {
+      return volume == other.volume and qopBin == other.qopBin and
+             etaBin == other.etaBin;
+    }
+  };
+
+  /// Hash combining the volume and the bins
+  struct KeyHash {
+    size_t operator()(const Key& key) const {
+      size_t hash = std::hash<const TrackingVolume*>()(key.volume);
+      hash ^= key.qopBin + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+      hash ^= key.etaBin + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+      return hash;
+    }
+  };
+
+  /// Build the key for a track
+  Key key(const TrackingVolume* volume, double qop, const Vector3D& dir) const;
+
+  Config m_cfg;
+  std::unordered_map<Key, double, KeyHash> m_stepSizes;
+  Statistics m_statistics;
+};
+
+namespace detail {
+
+template <typename navigation_state_t>
+using current_volume_t =
+    decltype(std::declval<navigation_state_t>().currentVolume);
+
+/// Current volume of the navigation, nullptr for navigators without volumes
+///
+/// @tparam navigation_state_t Type of the navigation state
+/// @param [in] navState The navigation state
+template <typename navigation_state_t>
+const TrackingVolume* currentVolume(const navigation_state_t& navState) {
+  if constexpr (concept ::exists<current_volume_t, navigation_state_t>) {
+    return navState.currentVolume;
+  } else {
+    return nullptr;
+  }
+}
+
+}  // namespace detail
+}  // namespace Acts
@@ -77,9 +77,11 @@ struct StepperExtensionList : private detail::Extendable<extensions...> {
   /// all arguments and extensions, test their validity for the evaluation and
   /// passes them forward for evaluation and returns a boolean as indicator if
   /// the evaluation is valid.
-  template <typename propagator_state_t, typename stepper_t>
+  template <typename propagator_state_t, typename stepper_t,
+            typename vector3_t, typename scalar_t>
   bool k1(const propagator_state_t& state, const stepper_t& stepper,
-          Vector3D& knew, const Vector3D& bField, std::array<double, 4>& kQoP) {
+          vector3_t& knew, const vector3_t& bField,
+          std::array<scalar_t, 4>& kQoP) {
     return impl::k(tuple(), state, stepper, knew, bField, kQoP,
                    validExtensions);
   }
@@ -87,10 +89,12 @@ struct StepperExtensionList : private detail::Extendable<extensions...> {
   /// @brief This functions broadcasts the call for evaluating k2. It collects
   /// all arguments and extensions and passes them forward for evaluation and
   /// returns a boolean as indicator if the evaluation is valid.
-  template <typename propagator_state_t, typename stepper_t>
+  template <typename propagator_state_t, typename stepper_t,
+            typename vector3_t, typename scalar_t>
   bool k2(const propagator_state_t& state, const stepper_t& stepper,
-          Vector3D& knew, const Vector3D& bField, std::array<double, 4>& kQoP,
-          const double h, const Vector3D& kprev) {
+          vector3_t& knew, const vector3_t& bField,
+          std::array<scalar_t, 4>& kQoP, const double h,
+          const vector3_t& kprev) {
     return impl::k(tuple(), state, stepper, knew, bField, kQoP, validExtensions,
                    1, h, kprev);
   }
@@ -98,10 +102,12 @@ struct StepperExtensionList : private detail::Extendable<extensions...> {
   /// @brief This functions broadcasts the call for evaluating k3. It collects
   /// all arguments and extensions and passes them forward for evaluation and
   /// returns a boolean as indicator if the evaluation is valid.
-  template <typename propagator_state_t, typename stepper_t>
+  template <typename propagator_state_t, typename stepper_t,
+            typename vector3_t, typename scalar_t>
   bool k3(const propagator_state_t& state, const stepper_t& stepper,
-          Vector3D& knew, const Vector3D& bField, std::array<double, 4>& kQoP,
-          const double h, const Vector3D& kprev) {
+          vector3_t& knew, const vector3_t& bField,
+          std::array<scalar_t, 4>& kQoP, const double h,
+          const vector3_t& kprev) {
     return impl::k(tuple(), state, stepper, knew, bField, kQoP, validExtensions,
                    2, h, kprev);
   }
@@ -109,10 +115,12 @@ struct StepperExtensionList : private detail::Extendable<extensions...> {
   /// @brief This functions broadcasts the call for evaluating k4. It collects
   /// all arguments and extensions and passes them forward for evaluation and
   /// returns a boolean as indicator if the evaluation is valid.
-  template <typename propagator_state_t, typename stepper_t>
+  template <typename propagator_state_t, typename stepper_t,
+            typename vector3_t, typename scalar_t>
   bool k4(const propagator_state_t& state, const stepper_t& stepper,
-          Vector3D& knew, const Vector3D& bField, std::array<double, 4>& kQoP,
-          const double h, const Vector3D& kprev) {
+          vector3_t& knew, const vector3_t& bField,
+          std::array<scalar_t, 4>& kQoP, const double h,
+          const vector3_t& kprev) {
     return impl::k(tuple(), state, stepper, knew, bField, kQoP, validExtensions,
                    3, h, kprev);
   }
@@ -120,9 +128,10 @@ struct StepperExtensionList : private detail::Extendable<extensions...> {
   /// @brief This functions broadcasts the call of the method finalize(). It
   /// collects all extensions and arguments and passes them forward for
   /// evaluation and returns a boolean.
-  template <typename propagator_state_t, typename stepper_t>
+  template <typename propagator_state_t, typename stepper_t,
+            typename matrix_t>
   bool finalize(propagator_state_t& state, const stepper_t& stepper,
-                const double h, FreeMatrix& D) {
+                const double h, matrix_t& D) {
     return impl::finalize(tuple(), state, stepper, h, D, validExtensions);
   }
 
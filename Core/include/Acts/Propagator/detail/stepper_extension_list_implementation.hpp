@@ -52,13 +52,14 @@ struct stepper_extension_list_impl {
   /// The extension list call implementation
   /// - it calls 'k()' on the current entry of the tuple
   /// - then broadcasts the extension call to the remaining tuple
-  template <typename propagator_state_t, typename stepper_t, typename... T>
+  template <typename propagator_state_t, typename stepper_t,
+            typename vector3_t, typename scalar_t, typename... T>
   static bool k(std::tuple<T...>& obs_tuple, const propagator_state_t& state,
-                const stepper_t& stepper, Vector3D& knew,
-                const Vector3D& bField, std::array<double, 4>& kQoP,
+                const stepper_t& stepper, vector3_t& knew,
+                const vector3_t& bField, std::array<scalar_t, 4>& kQoP,
                 const std::array<bool, sizeof...(T)>& validExtensions,
                 const int i = 0, const double h = 0,
-                const Vector3D& kprev = Vector3D()) {
+                const vector3_t& kprev = vector3_t()) {
     // If element is invalid: continue
     if (!std::get<N - 1>(validExtensions)) {
       return stepper_extension_list_impl<N - 1>::k(
@@ -81,10 +82,11 @@ struct stepper_extension_list_impl {
   /// The extension list call implementation
   /// - it calls 'finalize()' on the current entry of the tuple
   /// - then broadcasts the extension call to the remaining tuple
-  template <typename propagator_state_t, typename stepper_t, typename... T>
+  template <typename propagator_state_t, typename stepper_t,
+            typename matrix_t, typename... T>
   static bool finalize(const std::tuple<T...>& obs_tuple,
                        propagator_state_t& state, const stepper_t& stepper,
-                       const double h, FreeMatrix& D,
+                       const double h, matrix_t& D,
                        const std::array<bool, sizeof...(T)>& validExtensions) {
     // If element is invalid: continue
     if (!std::get<N - 1>(validExtensions)) {
@@ -138,23 +140,26 @@ struct stepper_extension_list_impl<0u> {
                   std::array<int, sizeof...(T)>& /*unused*/) {}
 
   /// The empty extension list call implementation
-  template <typename propagator_state_t, typename stepper_t, typename... T>
+  template <typename propagator_state_t, typename stepper_t,
+            typename vector3_t, typename scalar_t, typename... T>
   static bool k(std::tuple<T...>& /*unused*/,
                 const propagator_state_t& /*unused*/,
-                const stepper_t& /*unused*/, Vector3D& /*unused*/,
-                const Vector3D& /*unused*/, std::array<double, 4>& /*unused*/,
+                const stepper_t& /*unused*/, vector3_t& /*unused*/,
+                const vector3_t& /*unused*/,
+                std::array<scalar_t, 4>& /*unused*/,
                 const std::array<bool, sizeof...(T)>& /*unused*/,
                 const int /*unused*/, const double /*unused*/,
-                const Vector3D& /*unused*/) {
+                const vector3_t& /*unused*/) {
     return true;
   }
 
   /// The empty extension list call implementation
-  template <typename propagator_state_t, typename stepper_t, typename... T>
+  template <typename propagator_state_t, typename stepper_t,
+            typename matrix_t, typename... T>
   static bool finalize(const std::tuple<T...>& /*unused*/,
                        propagator_state_t& /*unused*/,
                        const stepper_t& /*unused*/, const double /*unused*/,
-                       FreeMatrix& /*unused*/,
+                       matrix_t& /*unused*/,
                        const std::array<bool, sizeof...(T)>& /*unused*/) {
     return true;
   }
@@ -12,6 +12,7 @@
 #include <vector>
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Surfaces/detail/SurfaceGridTransforms.hpp"
 #include "Acts/Utilities/BinningType.hpp"
 #include "Acts/Utilities/Definitions.hpp"
 #include "Acts/Utilities/IAxis.hpp"
@@ -109,9 +110,15 @@ class SurfaceArray {
   };
 
   /// @brief Lookup helper which encapsulates a @c Grid
+  ///
+  /// The coordinate transform is a compile-time policy, so the conversion
+  /// and the bin lookup can be inlined together.
+  ///
+  /// @tparam transform_t Policy providing @c globalToLocal and
+  ///         @c localToGlobal for the grid's local point type
   /// @tparam Axes The axes used for the grid
-  template <class... Axes>
-  struct SurfaceGridLookup : ISurfaceGridLookup {
+  template <class transform_t, class... Axes>
+  struct TransformedSurfaceGridLookup : ISurfaceGridLookup {
     static constexpr size_t DIM = sizeof...(Axes);
 
    public:
@@ -124,18 +131,11 @@ class SurfaceArray {
 
     /// @brief Default constructor
     ///
-    /// @param globalToLocal Callable that converts from global to local
-    /// @param localToGlobal Callable that converts from local to global
-    /// @param grid The grid data structure.
-    /// @note Signature of localToGlobal and globalToLocal depends on @c DIM.
-    ///       If DIM > 1, local coords are @c ActsVectorD<DIM> else
-    ///       @c std::array<double, 1>.
-    SurfaceGridLookup(std::function<point_t(const Vector3D&)> globalToLocal,
-                      std::function<Vector3D(const point_t&)> localToGlobal,
-                      std::tuple<Axes...> axes)
-        : m_globalToLocal(std::move(globalToLocal)),
-          m_localToGlobal(std::move(localToGlobal)),
-          m_grid(std::move(axes)) {
+    /// @param transform The coordinate transform policy
+    /// @param axes The axes of the grid data structure
+    TransformedSurfaceGridLookup(transform_t transform,
+                                 std::tuple<Axes...> axes)
+        : m_transform(std::move(transform)), m_grid(std::move(axes)) {
       m_neighborMap.resize(m_grid.size());
     }
 
@@ -207,7 +207,7 @@ class SurfaceArray {
     /// @param position Lookup position
     /// @return @c SurfaceVector at given bin
     SurfaceVector& lookup(const Vector3D& position) override {
-      return m_grid.atPosition(m_globalToLocal(position));
+      return m_grid.atPosition(m_transform.globalToLocal(position));
     }
 
     /// @brief Performs lookup at @c pos and returns bin content as const
@@ -215,7 +215,7 @@ class SurfaceArray {
     /// @param position Lookup position
     /// @return @c SurfaceVector at given bin
     const SurfaceVector& lookup(const Vector3D& position) const override {
-      return m_grid.atPosition(m_globalToLocal(position));
+      return m_grid.atPosition(m_transform.globalToLocal(position));
     }
 
     /// @brief Performs lookup at global bin and returns bin content as
@@ -237,7 +237,7 @@ class SurfaceArray {
     /// @param position Lookup position
     /// @return @c SurfaceVector at given bin. Copy of all bins selected
     const SurfaceVector& neighbors(const Vector3D& position) const override {
-      auto lposition = m_globalToLocal(position);
+      auto lposition = m_transform.globalToLocal(position);
       return m_neighborMap.at(m_grid.globalBinFromPosition(lposition));
     }
 
@@ -305,7 +305,7 @@ class SurfaceArray {
 
     /// Internal method.
     /// This is here, because apparently Eigen doesn't like Vector1D.
-    /// So SurfaceGridLookup internally uses std::array<double, 1> instead
+    /// So the grid lookup internally uses std::array<double, 1> instead
     /// of Vector1D (see the point_t typedef). This needs to be switched here,
     /// so as not to
     /// attempt an initialization of Vector1D that Eigen will complain about.
@@ -315,7 +315,7 @@ class SurfaceArray {
     /// This is the version for DIM>1
     template <size_t D = DIM, std::enable_if_t<D != 1, int> = 0>
     Vector3D getBinCenterImpl(size_t bin) const {
-      return m_localToGlobal(ActsVectorD<DIM>(
+      return m_transform.localToGlobal(ActsVectorD<DIM>(
           m_grid.binCenter(m_grid.localBinsFromGlobalBin(bin)).data()));
     }
 
@@ -324,15 +324,60 @@ class SurfaceArray {
     template <size_t D = DIM, std::enable_if_t<D == 1, int> = 0>
     Vector3D getBinCenterImpl(size_t bin) const {
       point_t pos = m_grid.binCenter(m_grid.localBinsFromGlobalBin(bin));
-      return m_localToGlobal(pos);
+      return m_transform.localToGlobal(pos);
     }
 
-    std::function<point_t(const Vector3D&)> m_globalToLocal;
-    std::function<Vector3D(const point_t&)> m_localToGlobal;
+    transform_t m_transform;
     Grid_t m_grid;
     std::vector<SurfaceVector> m_neighborMap;
   };
 
+  /// @brief Lookup helper with type-erased coordinate transforms
+  /// @tparam Axes The axes used for the grid
+  template <class... Axes>
+  struct SurfaceGridLookup
+      : TransformedSurfaceGridLookup<
+            detail::FunctionGridTransform<std::conditional_t<
+                sizeof...(Axes) == 1, std::array<double, 1>,
+                ActsVectorD<sizeof...(Axes)>>>,
+            Axes...> {
+    using Base = TransformedSurfaceGridLookup<
+        detail::FunctionGridTransform<
+            std::conditional_t<sizeof...(Axes) == 1, std::array<double, 1>,
+                               ActsVectorD<sizeof...(Axes)>>>,
+        Axes...>;
+    using typename Base::point_t;
+
+    /// @brief Default constructor
+    ///
+    /// @param globalToLocal Callable that converts from global to local
+    /// @param localToGlobal Callable that converts from local to global
+    /// @param axes The axes of the grid data structure
+    /// @note Signature of localToGlobal and globalToLocal depends on @c DIM.
+    ///       If DIM > 1, local coords are @c ActsVectorD<DIM> else
+    ///       @c std::array<double, 1>.
+    SurfaceGridLookup(std::function<point_t(const Vector3D&)> globalToLocal,
+                      std::function<Vector3D(const point_t&)> localToGlobal,
+                      std::tuple<Axes...> axes)
+        : Base({std::move(globalToLocal), std::move(localToGlobal)},
+               std::move(axes)) {}
+  };
+
+  /// @brief Lookup on the (phi, z) grid of a cylinder
+  template <class... Axes>
+  using CylinderSurfaceGridLookup =
+      TransformedSurfaceGridLookup<detail::CylinderGridTransform, Axes...>;
+
+  /// @brief Lookup on the (r, phi) grid of a disc
+  template <class... Axes>
+  using DiscSurfaceGridLookup =
+      TransformedSurfaceGridLookup<detail::DiscGridTransform, Axes...>;
+
+  /// @brief Lookup on the local (x, y) grid of a plane
+  template <class... Axes>
+  using PlaneSurfaceGridLookup =
+      TransformedSurfaceGridLookup<detail::PlaneGridTransform, Axes...>;
+
   /// @brief Lookup implementation which wraps one element and always returns
   ///        this element when lookup is called
   struct SingleElementLookup : ISurfaceGridLookup {
@@ -469,10 +514,9 @@ class SurfaceArray {
   /// @param position The position to lookup as nominal
   /// @param size How many neighbors we want in each direction. (default: 1)
   /// @return Merged @c SurfaceVector of neighbors and nominal
-  /// @note The @c SurfaceVector will be combined. For technical reasons, the
-  ///       different bin content vectors have to be copied, so the resulting
-  ///       vector contains copies.
-  SurfaceVector neighbors(const Vector3D& position) const {
+  /// @note The combined @c SurfaceVector is cached per bin when the grid is
+  ///       filled, so this returns a reference to that cache.
+  const SurfaceVector& neighbors(const Vector3D& position) const {
     return p_gridLookup->neighbors(position);
   }
 
@@ -484,7 +528,9 @@ class SurfaceArray {
   /// @brief Get the center of the bin identified by global bin index @p bin
   /// @param bin the global bin index
   /// @return Center position of the bin in global coordinates
-  Vector3D getBinCenter(size_t bin) { return p_gridLookup->getBinCenter(bin); }
+  Vector3D getBinCenter(size_t bin) const {
+    return p_gridLookup->getBinCenter(bin);
+  }
 
   /// @brief Get all surfaces attached to this @c SurfaceArray
   /// @return Reference to @c SurfaceVector containing all surfaces
@@ -0,0 +1,142 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+#include <cmath>
+#include <functional>
+#include <utility>
+#include "Acts/Utilities/Definitions.hpp"
+#include "Acts/Utilities/Helpers.hpp"
+
+namespace Acts {
+namespace detail {
+
+/// @brief Coordinate transform policy for a cylinder surface grid
+///
+/// Maps global positions onto the (phi, z) grid coordinates of a cylinder
+/// with radius @c R, and grid points back onto the cylinder.
+class CylinderGridTransform {
+ public:
+  using point_t = Vector2D;
+
+  /// @param transform Global to local transform of the grid
+  /// @param R Radius used to place bin centers in global coordinates
+  CylinderGridTransform(const Transform3D& transform, double R)
+      : m_transform(transform), m_itransform(transform.inverse()), m_R(R) {}
+
+  /// @brief Convert a global position to (phi, z)
+  point_t globalToLocal(const Vector3D& pos) const {
+    Vector3D loc = m_transform * pos;
+    return Vector2D(VectorHelpers::phi(loc), loc.z());
+  }
+
+  /// @brief Convert (phi, z) to a global position on the cylinder
+  Vector3D localToGlobal(const point_t& loc) const {
+    return m_itransform *
+           Vector3D(m_R * std::cos(loc[0]), m_R * std::sin(loc[0]), loc[1]);
+  }
+
+ private:
+  Transform3D m_transform;
+  Transform3D m_itransform;
+  double m_R;
+};
+
+/// @brief Coordinate transform policy for a disc surface grid
+///
+/// Maps global positions onto the (r, phi) grid coordinates of a disc at
+/// position @c Z, and grid points back onto the disc.
+class DiscGridTransform {
+ public:
+  using point_t = Vector2D;
+
+  /// @param transform Global to local transform of the grid
+  /// @param Z Position used to place bin centers in global coordinates
+  DiscGridTransform(const Transform3D& transform, double Z)
+      : m_transform(transform), m_itransform(transform.inverse()), m_Z(Z) {}
+
+  /// @brief Convert a global position to (r, phi)
+  point_t globalToLocal(const Vector3D& pos) const {
+    Vector3D loc = m_transform * pos;
+    return Vector2D(VectorHelpers::perp(loc), VectorHelpers::phi(loc));
+  }
+
+  /// @brief Convert (r, phi) to a global position on the disc
+  Vector3D localToGlobal(const point_t& loc) const {
+    return m_itransform *
+           Vector3D(loc[0] * std::cos(loc[1]), loc[0] * std::sin(loc[1]), m_Z);
+  }
+
+ private:
+  Transform3D m_transform;
+  Transform3D m_itransform;
+  double m_Z;
+};
+
+/// @brief Coordinate transform policy for a plane surface grid
+///
+/// Maps global positions onto the local (x, y) grid coordinates of a plane.
+class PlaneGridTransform {
+ public:
+  using point_t = Vector2D;
+
+  /// @param transform Global to local transform of the grid
+  PlaneGridTransform(const Transform3D& transform)
+      : m_transform(transform), m_itransform(transform.inverse()) {}
+
+  /// @brief Convert a global position to (x, y)
+  point_t globalToLocal(const Vector3D& pos) const {
+    Vector3D loc = m_transform * pos;
+    return Vector2D(loc.x(), loc.y());
+  }
+
+  /// @brief Convert (x, y) to a global position on the plane
+  Vector3D localToGlobal(const point_t& loc) const {
+    return m_itransform * Vector3D(loc.x(), loc.y(), 0.);
+  }
+
+ private:
+  Transform3D m_transform;
+  Transform3D m_itransform;
+};
+
+/// @brief Coordinate transform policy wrapping two type-erased callables
+///
+/// This keeps arbitrary user-provided conversions working, at the cost of
+/// an indirect call per conversion.
+///
+/// @tparam point_type The local grid point type
+template <typename point_type>
+class FunctionGridTransform {
+ public:
+  using point_t = point_type;
+
+  /// @param globalToLocal Callable that converts from global to local
+  /// @param localToGlobal Callable that converts from local to global
+  FunctionGridTransform(std::function<point_t(const Vector3D&)> globalToLocal,
+                        std::function<Vector3D(const point_t&)> localToGlobal)
+      : m_globalToLocal(std::move(globalToLocal)),
+        m_localToGlobal(std::move(localToGlobal)) {}
+
+  /// @brief Convert a global position to a local grid point
+  point_t globalToLocal(const Vector3D& pos) const {
+    return m_globalToLocal(pos);
+  }
+
+  /// @brief Convert a local grid point to a global position
+  Vector3D localToGlobal(const point_t& loc) const {
+    return m_localToGlobal(loc);
+  }
+
+ private:
+  std::function<point_t(const Vector3D&)> m_globalToLocal;
+  std::function<Vector3D(const point_t&)> m_localToGlobal;
+};
+
+}  // namespace detail
+}  // namespace Acts
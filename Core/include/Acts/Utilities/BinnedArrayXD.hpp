@@ -112,6 +112,20 @@ class BinnedArrayXD : public BinnedArray<T> {
     }
   }
 
+  /// Constructor with a grid, its unique objects and a BinUtility
+  ///
+  /// @param grid is the prepared object grid
+  /// @param arrayObjects are the unique objects in the grid, in the order
+  ///        they are to be returned by arrayObjects()
+  /// @param bu is the unique bin utility for this binned array
+  BinnedArrayXD(const std::vector<std::vector<std::vector<T>>>& grid,
+                std::vector<T> arrayObjects,
+                std::unique_ptr<const BinUtility> bu)
+      : BinnedArray<T>(),
+        m_objectGrid(grid),
+        m_arrayObjects(std::move(arrayObjects)),
+        m_binUtility(std::move(bu)) {}
+
   /// Copy constructor
   /// - not allowed, use the same array
   BinnedArrayXD(const BinnedArrayXD<T>& barr) = delete;
@@ -206,6 +206,24 @@ inline ActsMatrixD<3, 3> cross(const ActsMatrixD<3, 3>& m, const Vector3D& v) {
   return r;
 }
 
+/// @brief Calculates column-wise cross products of a matrix and a vector for
+/// any fixed-size scalar type, e.g. single precision stepping.
+///
+/// @tparam T The scalar type
+/// @param [in] m Matrix that will be used for cross products
+/// @param [in] v Vector for cross products
+/// @return Constructed matrix
+template <typename T>
+inline ActsMatrix<T, 3, 3> cross(const ActsMatrix<T, 3, 3>& m,
+                                 const ActsVector<T, 3>& v) {
+  ActsMatrix<T, 3, 3> r;
+  r.col(0) = m.col(0).cross(v);
+  r.col(1) = m.col(1).cross(v);
+  r.col(2) = m.col(2).cross(v);
+
+  return r;
+}
+
 /// @brief Access to the time component of input parameter
 ///
 /// @param spacePointVec The SpacePointVector
@@ -0,0 +1,166 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace Acts {
+namespace Instrumentation {
+
+/// Heap allocations made by one thread
+struct AllocationCount {
+  size_t allocations = 0;
+  size_t allocatedBytes = 0;
+};
+
+/// Heap allocations made by the calling thread since its start
+///
+/// Allocations are only counted if the library was compiled with
+/// `ACTS_ENABLE_INSTRUMENTATION`, which replaces the global `operator new`
+/// including its aligned overloads. Otherwise, the returned counts are always
+/// zero. This is the only counting hook; executables that replace the global
+/// `operator new` themselves take precedence and disable the counting.
+AllocationCount threadAllocations();
+
+/// Accumulated resource usage of an instrumented scope
+struct Counters {
+  /// number of times the scope was entered
+  size_t calls = 0;
+  /// heap allocations and allocated bytes within the scope
+  size_t allocations = 0;
+  size_t allocatedBytes = 0;
+  /// wall time spent within the scope
+  std::chrono::nanoseconds time{0};
+};
+
+/// Thread-safe accumulator for one instrumented scope
+class Entry {
+ public:
+  /// Add the usage of one call
+  void add(const AllocationCount& allocations, std::chrono::nanoseconds time) {
+    m_calls.fetch_add(1, std::memory_order_relaxed);
+    m_allocations.fetch_add(allocations.allocations,
+                            std::memory_order_relaxed);
+    m_allocatedBytes.fetch_add(allocations.allocatedBytes,
+                               std::memory_order_relaxed);
+    m_time.fetch_add(time.count(), std::memory_order_relaxed);
+  }
+
+  /// Current value of the accumulated counters
+  Counters counters() const {
+    Counters counters;
+    counters.calls = m_calls.load(std::memory_order_relaxed);
+    counters.allocations = m_allocations.load(std::memory_order_relaxed);
+    counters.allocatedBytes = m_allocatedBytes.load(std::memory_order_relaxed);
+    counters.time =
+        std::chrono::nanoseconds(m_time.load(std::memory_order_relaxed));
+    return counters;
+  }
+
+  /// Set all counters to zero
+  void reset() {
+    m_calls = 0;
+    m_allocations = 0;
+    m_allocatedBytes = 0;
+    m_time = 0;
+  }
+
+ private:
+  std::atomic<size_t> m_calls{0};
+  std::atomic<size_t> m_allocations{0};
+  std::atomic<size_t> m_allocatedBytes{0};
+  std::atomic<int64_t> m_time{0};
+};
+
+/// @class Registry
+///
+/// @brief Process-wide collection of the instrumented scopes
+///
+/// Entries are created on first use and live until the end of the process;
+/// references to them stay valid, `reset` only zeroes the counters.
+class Registry {
+ public:
+  /// The single registry instance
+  static Registry& instance();
+
+  Registry(const Registry&) = delete;
+  Registry& operator=(const Registry&) = delete;
+
+  /// Get the entry with the given name, create it if it does not exist
+  Entry& entry(const std::string& name);
+
+  /// Counters of the entry with the given name, zero if it does not exist
+  Counters counters(const std::string& name) const;
+
+  /// Counters of all entries, sorted by name
+  std::map<std::string, Counters> counters() const;
+
+  /// Set the counters of all entries to zero
+  void reset();
+
+ private:
+  Registry() = default;
+
+  std::map<std::string, std::unique_ptr<Entry>> m_entries;
+  mutable std::mutex m_mutex;
+};
+
+/// @class ScopedCounter
+///
+/// @brief Accounts the allocations and the wall time of its own lifetime
+///
+/// Nested scopes are inclusive, i.e. the usage of an inner scope is also
+/// accounted to all enclosing ones.
+class ScopedCounter {
+ public:
+  explicit ScopedCounter(Entry& entry)
+      : m_entry(entry),
+        m_allocations(threadAllocations()),
+        m_start(std::chrono::steady_clock::now()) {}
+
+  ~ScopedCounter() {
+    const auto time = std::chrono::steady_clock::now() - m_start;
+    const auto allocations = threadAllocations();
+    m_entry.add({allocations.allocations - m_allocations.allocations,
+                 allocations.allocatedBytes - m_allocations.allocatedBytes},
+                std::chrono::duration_cast<std::chrono::nanoseconds>(time));
+  }
+
+  ScopedCounter(const ScopedCounter&) = delete;
+  ScopedCounter& operator=(const ScopedCounter&) = delete;
+
+ private:
+  Entry& m_entry;
+  AllocationCount m_allocations;
+  std::chrono::steady_clock::time_point m_start;
+};
+
+}  // namespace Instrumentation
+}  // namespace Acts
+
+/// Instrument the enclosing scope under the given name
+///
+/// The macro expands to nothing unless `ACTS_ENABLE_INSTRUMENTATION` is
+/// defined, instrumented code has no overhead in regular builds.
+#ifdef ACTS_ENABLE_INSTRUMENTATION
+#define ACTS_INSTRUMENT_SCOPE(name)                                 \
+  static auto& _actsInstrumentationEntry =                          \
+      ::Acts::Instrumentation::Registry::instance().entry(name);    \
+  ::Acts::Instrumentation::ScopedCounter _actsInstrumentationScope( \
+      _actsInstrumentationEntry)
+#else
+#define ACTS_INSTRUMENT_SCOPE(name) static_cast<void>(0)
+#endif
@@ -8,6 +8,7 @@
 
 #pragma once
 // STL include(s)
+#include <atomic>
 #include <ctime>
 #include <functional>
 #include <iomanip>
@@ -478,6 +479,92 @@ class DefaultPrintPolicy final : public OutputPrintPolicy {
   /// pointer to destination output stream
   std::ostream* m_out;
 };
+
+/// @brief asynchronous print policy for debug messages
+///
+/// Debug messages are pushed into a bounded, lock-free multi-producer
+/// single-consumer ring buffer and handed over to the wrapped print policy by
+/// a dedicated background thread. Threads emitting debug messages therefore
+/// never wait for the destination stream or for each other.
+///
+/// If the ring buffer is full, new messages are either dropped (and counted)
+/// or the emitting thread waits until the background thread has made space
+/// available. All pending messages are written when this object is destroyed.
+///
+/// @note Decorators wrapped by this policy are executed on the background
+///       thread, e.g. time stamps and thread IDs then refer to the moment and
+///       the thread of writing. Decorators wrapping this policy are executed
+///       on the calling thread.
+class AsyncPrintPolicy final : public OutputPrintPolicy {
+ public:
+  /// @brief constructor
+  ///
+  /// @param [in] wrappee    output print policy object executed on the
+  ///                        background thread
+  /// @param [in] capacity   maximum number of pending messages (rounded up to
+  ///                        the next power of two)
+  /// @param [in] dropOnFull drop messages if the buffer is full instead of
+  ///                        waiting for free space
+  explicit AsyncPrintPolicy(std::unique_ptr<OutputPrintPolicy> wrappee,
+                            size_t capacity = 4096, bool dropOnFull = false);
+
+  /// @brief destructor
+  ///
+  /// Stops the background thread after all pending messages were written.
+  ~AsyncPrintPolicy() override;
+
+  AsyncPrintPolicy(const AsyncPrintPolicy&) = delete;
+  AsyncPrintPolicy& operator=(const AsyncPrintPolicy&) = delete;
+
+  /// @brief queue the debug message for writing
+  ///
+  /// @param [in] lvl   debug level of debug message
+  /// @param [in] input text of debug message
+  void flush(const Level& lvl, const std::ostringstream& input) override;
+
+  /// @brief number of messages dropped because the buffer was full
+  size_t droppedMessages() const {
+    return m_dropped.load(std::memory_order_relaxed);
+  }
+
+ private:
+  /// @brief single entry of the ring buffer
+  ///
+  /// The sequence number encodes whether the slot is ready to be written by
+  /// a producer or to be read by the consumer.
+  struct alignas(64) Slot {
+    std::atomic<size_t> sequence{0};
+    Level level = VERBOSE;
+    std::string message;
+  };
+
+  /// @brief take the next message from the ring buffer
+  ///
+  /// @return @c false if no message is available
+  bool pop(Level& lvl, std::string& message);
+
+  /// main loop of the background thread
+  void run();
+
+  /// print policy executed on the background thread
+  std::unique_ptr<OutputPrintPolicy> m_wrappee;
+  /// ring buffer storage
+  std::unique_ptr<Slot[]> m_slots;
+  /// capacity - 1 used for fast index wrapping
+  size_t m_mask;
+  /// drop messages instead of waiting for free space
+  bool m_dropOnFull;
+  /// next position to be claimed by a producer
+  alignas(64) std::atomic<size_t> m_enqueuePos{0};
+  /// next position to be read by the consumer
+  alignas(64) size_t m_dequeuePos = 0;
+  /// number of dropped messages
+  std::atomic<size_t> m_dropped{0};
+  /// signal the background thread to finish
+  std::atomic<bool> m_stop{false};
+  /// background thread writing the messages
+  std::thread m_worker;
+};
 }  // namespace Logging
 
 /// @brief class for printing debug output
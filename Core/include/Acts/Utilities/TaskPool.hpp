@@ -0,0 +1,131 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Acts {
+
+/// @class TaskPool
+///
+/// @brief Fixed set of worker threads to run independent tasks
+///
+/// The pool is intended for coarse grained, independent work items, e.g.
+/// full propagations. Work is distributed with `parallelFor`, which blocks
+/// until all items are processed. The calling thread participates in the
+/// processing, nested calls from within a task can therefore not dead-lock
+/// even if all workers are busy.
+class TaskPool {
+ public:
+  /// Constructor
+  ///
+  /// @param nThreads the number of worker threads, with zero workers all
+  ///        tasks are executed by the calling thread
+  explicit TaskPool(size_t nThreads = std::thread::hardware_concurrency());
+
+  /// Destructor, finishes all queued tasks and joins the workers
+  ~TaskPool();
+
+  TaskPool(const TaskPool&) = delete;
+  TaskPool& operator=(const TaskPool&) = delete;
+
+  /// Number of worker threads
+  size_t size() const { return m_workers.size(); }
+
+  /// Call a function for each index in [0, n) and wait for completion
+  ///
+  /// @tparam function_t callable with signature void(size_t)
+  ///
+  /// @param n the number of work items
+  /// @param func the function to be called for each work item
+  ///
+  /// The order of the calls is unspecified. If any call throws, the
+  /// remaining items are still processed and the first exception is
+  /// re-thrown in the calling thread.
+  template <typename function_t>
+  void parallelFor(size_t n, function_t&& func);
+
+ private:
+  /// Enqueue a task to be picked up by one of the workers
+  void submit(std::function<void()> task);
+
+  /// The worker loop
+  void run();
+
+  std::vector<std::thread> m_workers;
+  std::deque<std::function<void()>> m_tasks;
+  std::mutex m_mutex;
+  std::condition_variable m_condition;
+  bool m_stop = false;
+};
+
+template <typename function_t>
+void TaskPool::parallelFor(size_t n, function_t&& func) {
+  if (n == 0) {
+    return;
+  }
+  if (m_workers.empty() or n == 1) {
+    for (size_t i = 0; i < n; ++i) {
+      func(i);
+    }
+    return;
+  }
+
+  // Shared between the caller and the helper tasks. Helpers may outlive
+  // the call, but they only touch the function while items are left.
+  struct LoopState {
+    std::atomic<size_t> next{0};
+    size_t done = 0;
+    std::exception_ptr error = nullptr;
+    std::mutex mutex;
+    std::condition_variable finished;
+  };
+  auto state = std::make_shared<LoopState>();
+  auto loop = [state, n, &func]() {
+    for (size_t i = state->next++; i < n; i = state->next++) {
+      std::exception_ptr error = nullptr;
+      try {
+        func(i);
+      } catch (...) {
+        error = std::current_exception();
+      }
+      std::lock_guard<std::mutex> lock(state->mutex);
+      if (error and not state->error) {
+        state->error = error;
+      }
+      if (++state->done == n) {
+        state->finished.notify_all();
+      }
+    }
+  };
+
+  size_t nHelpers = std::min(m_workers.size(), n - 1);
+  for (size_t ih = 0; ih < nHelpers; ++ih) {
+    submit(loop);
+  }
+  loop();
+
+  std::unique_lock<std::mutex> lock(state->mutex);
+  state->finished.wait(lock, [&]() { return state->done == n; });
+  if (state->error) {
+    std::rethrow_exception(state->error);
+  }
+}
+
+}  // namespace Acts
@@ -10,11 +10,13 @@
 
 #include "Acts/Utilities/detail/GridFwd.hpp"
 
+#include <algorithm>
 #include <array>
 #include <numeric>
 #include <set>
 #include <tuple>
 #include <type_traits>
+#include <utility>
 #include <vector>
 #include "Acts/Utilities/IAxis.hpp"
 #include "Acts/Utilities/Interpolation.hpp"
@@ -327,6 +329,107 @@ class Grid final {
                              upperRightBinEdge(llIndices), neighbors);
   }
 
+  /// @brief interpolate grid values to a batch of positions
+  ///
+  /// @tparam Point type specifying geometric positions
+  /// @tparam U     dummy template parameter identical to @c T
+  ///
+  /// @param [in] points locations to which to interpolate grid values. All
+  ///                    positions must be within the grid dimensions and not
+  ///                    lie in an under-/overflow bin along any axis.
+  ///
+  /// @return interpolated values in the same order as the given positions
+  ///
+  /// The positions are grouped by the grid cell containing them. For each
+  /// cell the corner values and bin edges are looked up only once and the
+  /// linear interpolation is carried out for all positions of the cell
+  /// together, one dimension at a time. The inner loops run over contiguous
+  /// per-position buffers and can be auto-vectorized for arithmetic value
+  /// types. The arithmetic operations are the same as in the single-point
+  /// interpolation, i.e. the results are identical to calling
+  /// Grid::interpolate for each position separately.
+  ///
+  /// @note The same requirements as for the single-point interpolation apply.
+  template <
+      class Point, typename U = T,
+      typename = std::enable_if_t<can_interpolate<
+          Point, std::array<double, DIM>, std::array<double, DIM>, U>::value>>
+  std::vector<T> interpolate(const std::vector<Point>& points) const {
+    // there are 2^DIM corner points used during the interpolation
+    constexpr size_t nCorners = 1 << DIM;
+
+    std::vector<T> results(points.size());
+
+    // sort the positions by the global index of the bin containing them
+    std::vector<std::pair<size_t, size_t>> binsAndPoints;
+    binsAndPoints.reserve(points.size());
+    for (size_t ip = 0; ip < points.size(); ++ip) {
+      binsAndPoints.emplace_back(globalBinFromPosition(points[ip]), ip);
+    }
+    std::sort(binsAndPoints.begin(), binsAndPoints.end());
+
+    // scratch buffers re-used for all cells
+    // fractions are stored per dimension, values per corner point
+    std::vector<double> fractions;
+    std::vector<T> values;
+
+    auto groupBegin = binsAndPoints.begin();
+    while (groupBegin != binsAndPoints.end()) {
+      const size_t bin = groupBegin->first;
+      auto groupEnd =
+          std::find_if(groupBegin, binsAndPoints.end(),
+                       [bin](const std::pair<size_t, size_t>& bp) {
+                         return bp.first != bin;
+                       });
+      const size_t nPoints = std::distance(groupBegin, groupEnd);
+
+      // cell properties are shared by all positions in this group
+      const auto& llIndices = localBinsFromGlobalBin(bin);
+      const point_t lowerLeft = lowerLeftBinEdge(llIndices);
+      const point_t upperRight = upperRightBinEdge(llIndices);
+
+      // relative distances to the lower boundaries along each axis
+      fractions.resize(DIM * nPoints);
+      for (size_t d = 0; d < DIM; ++d) {
+        double* f = fractions.data() + d * nPoints;
+        const double lower = lowerLeft[d];
+        const double width = upperRight[d] - lowerLeft[d];
+        for (size_t k = 0; k < nPoints; ++k) {
+          f[k] = (points[(groupBegin + k)->second][d] - lower) / width;
+        }
+      }
+
+      // broadcast the corner values to every position of the group
+      values.resize(nCorners * nPoints);
+      size_t corner = 0;
+      for (size_t index : rawClosestPointsIndices(llIndices)) {
+        std::fill_n(values.begin() + corner * nPoints, nPoints, at(index));
+        ++corner;
+      }
+
+      // reduce the corner values one dimension at a time, starting with the
+      // last one, following the canonical order defined in Acts::interpolate
+      for (size_t n = nCorners, d = DIM; n > 1; n >>= 1) {
+        const double* f = fractions.data() + (--d) * nPoints;
+        for (size_t i = 0; i < n / 2; ++i) {
+          T* out = values.data() + i * nPoints;
+          const T* lo = values.data() + 2 * i * nPoints;
+          const T* hi = lo + nPoints;
+          for (size_t k = 0; k < nPoints; ++k) {
+            out[k] = (1 - f[k]) * lo[k] + f[k] * hi[k];
+          }
+        }
+      }
+
+      for (size_t k = 0; k < nPoints; ++k) {
+        results[(groupBegin + k)->second] = values[k];
+      }
+      groupBegin = groupEnd;
+    }
+
+    return results;
+  }
+
   /// @brief check whether given point is inside grid limits
   ///
   /// @return @c true if \f$\text{xmin_i} \le x_i < \text{xmax}_i \forall i=0,
@@ -10,11 +10,14 @@
 
 #include "Acts/EventData/TrackParameters.hpp"
 #include "Acts/Utilities/Definitions.hpp"
+#include "Acts/Utilities/Instrumentation.hpp"
 #include "Acts/Utilities/Logger.hpp"
 #include "Acts/Utilities/Result.hpp"
+#include "Acts/Utilities/TaskPool.hpp"
 #include "Acts/Utilities/Units.hpp"
 #include "Acts/Vertexing/AMVFInfo.hpp"
 #include "Acts/Vertexing/TrackToVertexIPEstimator.hpp"
+#include "Acts/Vertexing/VertexFinderConcept.hpp"
 #include "Acts/Vertexing/VertexingOptions.hpp"
 
 namespace Acts {
@@ -37,6 +40,7 @@ class AdaptiveMultiVertexFinder {
   using InputTrack_t = typename vfitter_t::InputTrack_t;
   using Linearizer_t = typename vfitter_t::Linearizer_t;
   using FitterState_t = typename vfitter_t::State;
+  using SeedFinderState_t = VertexFinderState_t<sfinder_t>;
 
  public:
   /// @struct Config Configuration struct
@@ -154,6 +158,16 @@ class AdaptiveMultiVertexFinder {
     // So definitely consider setting this to true.
     bool useVertexCovForIPEstimation = false;
 
+    // Split the tracks into clusters which are separated in z at the beam
+    // line by more than clusterMinZGap, and find the vertices of each
+    // cluster independently. Vertices of different clusters cannot share
+    // tracks if the gap is well above tracksMaxZinterval.
+    // Disabled if not positive.
+    double clusterMinZGap = 0.;
+
+    // Optional pool to find the vertices of several clusters concurrently
+    std::shared_ptr<TaskPool> taskPool = nullptr;
+
   };  // Config struct
 
   /// @brief Constructor used if InputTrack_t type == BoundParameters
@@ -187,6 +201,9 @@ class AdaptiveMultiVertexFinder {
   /// @brief Function that performs the adaptive
   /// multi-vertex finding
   ///
+  /// If cluster splitting is enabled, the vertices of each cluster are
+  /// returned consecutively, with the clusters ordered in z.
+  ///
   /// @param allTracks Input track collection
   /// @param vertexingOptions Vertexing options
   ///
@@ -212,18 +229,42 @@ class AdaptiveMultiVertexFinder {
   /// Private access to logging instance
   const Logger& logger() const { return *m_logger; }
 
+  /// @brief Performs the adaptive multi-vertex finding on one set of tracks
+  ///
+  /// @param allTracks Input track collection
+  /// @param vertexingOptions Vertexing options
+  ///
+  /// @return Vector of all reconstructed vertices
+  Result<std::vector<Vertex<InputTrack_t>>> findVertices(
+      const std::vector<const InputTrack_t*>& allTracks,
+      const VertexingOptions<InputTrack_t>& vertexingOptions) const;
+
+  /// @brief Splits the tracks into clusters separated in z by more than
+  /// clusterMinZGap at the beam line
+  ///
+  /// @param allTracks Input track collection
+  /// @param vertexingOptions Vertexing options
+  ///
+  /// @return The clusters ordered in z, the tracks of each cluster
+  /// keep their input order
+  std::vector<std::vector<const InputTrack_t*>> clusterTracks(
+      const std::vector<const InputTrack_t*>& allTracks,
+      const VertexingOptions<InputTrack_t>& vertexingOptions) const;
+
   /// @brief Calls the seed finder and sets constraints on the found seed
   /// vertex if desired
   ///
   /// @param trackVector All tracks to be used for seeding
   /// @param currentConstraint Vertex constraint
   /// @param vertexingOptions Vertexing options
+  /// @param seedFinderState The seed finder state, kept between iterations
   ///
   /// @return The seed vertex
   Result<Vertex<InputTrack_t>> doSeeding(
       const std::vector<const InputTrack_t*>& trackVector,
       Vertex<InputTrack_t>& currentConstraint,
-      const VertexingOptions<InputTrack_t>& vertexingOptions) const;
+      const VertexingOptions<InputTrack_t>& vertexingOptions,
+      SeedFinderState_t& seedFinderState) const;
 
   /// @brief Estimates delta Z between a track and a vertex position
   ///
@@ -8,14 +8,92 @@
 
 #include "Acts/Vertexing/VertexingError.hpp"
 
+#include <algorithm>
+#include <numeric>
+#include <optional>
+
 template <typename vfitter_t, typename sfinder_t>
 auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::find(
     const std::vector<const InputTrack_t*>& allTracks,
     const VertexingOptions<InputTrack_t>& vertexingOptions) const
     -> Result<std::vector<Vertex<InputTrack_t>>> {
+  ACTS_INSTRUMENT_SCOPE("AdaptiveMultiVertexFinder::find");
   if (allTracks.empty()) {
     return VertexingError::EmptyInput;
   }
+  if (m_cfg.clusterMinZGap <= 0.) {
+    return findVertices(allTracks, vertexingOptions);
+  }
+
+  auto clusters = clusterTracks(allTracks, vertexingOptions);
+  ACTS_DEBUG("Split " << allTracks.size() << " tracks into " << clusters.size()
+                      << " clusters.");
+
+  std::vector<std::optional<Result<std::vector<Vertex<InputTrack_t>>>>>
+      clusterResults(clusters.size());
+  auto findInCluster = [&](size_t ic) {
+    clusterResults[ic].emplace(findVertices(clusters[ic], vertexingOptions));
+  };
+  if (m_cfg.taskPool) {
+    m_cfg.taskPool->parallelFor(clusters.size(), findInCluster);
+  } else {
+    for (size_t ic = 0; ic < clusters.size(); ++ic) {
+      findInCluster(ic);
+    }
+  }
+
+  std::vector<Vertex<InputTrack_t>> allVertices;
+  for (auto& result : clusterResults) {
+    if (not result->ok()) {
+      return result->error();
+    }
+    auto& vertices = result->value();
+    std::move(vertices.begin(), vertices.end(),
+              std::back_inserter(allVertices));
+  }
+  return allVertices;
+}
+
+template <typename vfitter_t, typename sfinder_t>
+auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::clusterTracks(
+    const std::vector<const InputTrack_t*>& allTracks,
+    const VertexingOptions<InputTrack_t>& vertexingOptions) const
+    -> std::vector<std::vector<const InputTrack_t*>> {
+  // z of the tracks at the beam line
+  const Vector3D& beamPos = vertexingOptions.vertexConstraint.position();
+  std::vector<double> trackZ(allTracks.size());
+  for (size_t it = 0; it < allTracks.size(); ++it) {
+    trackZ[it] =
+        beamPos.z() +
+        estimateDeltaZ(m_extractParameters(*allTracks[it]), beamPos);
+  }
+  std::vector<size_t> order(allTracks.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(),
+            [&](size_t a, size_t b) { return trackZ[a] < trackZ[b]; });
+
+  // Start a new cluster at every large enough gap
+  std::vector<size_t> clusterIndex(allTracks.size());
+  size_t nClusters = 1;
+  for (size_t io = 1; io < order.size(); ++io) {
+    if (trackZ[order[io]] - trackZ[order[io - 1]] > m_cfg.clusterMinZGap) {
+      ++nClusters;
+    }
+    clusterIndex[order[io]] = nClusters - 1;
+  }
+
+  std::vector<std::vector<const InputTrack_t*>> clusters(nClusters);
+  for (size_t it = 0; it < allTracks.size(); ++it) {
+    clusters[clusterIndex[it]].push_back(allTracks[it]);
+  }
+  return clusters;
+}
+
+template <typename vfitter_t, typename sfinder_t>
+auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::findVertices(
+    const std::vector<const InputTrack_t*>& allTracks,
+    const VertexingOptions<InputTrack_t>& vertexingOptions) const
+    -> Result<std::vector<Vertex<InputTrack_t>>> {
   // Original tracks
   const std::vector<const InputTrack_t*>& origTracks = allTracks;
 
@@ -23,6 +101,7 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::find(
   std::vector<const InputTrack_t*> seedTracks = allTracks;
 
   FitterState_t fitterState;
+  SeedFinderState_t seedFinderState;
 
   std::vector<std::unique_ptr<Vertex<InputTrack_t>>> allVertices;
 
@@ -45,7 +124,8 @@ auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::find(
     Vertex<InputTrack_t> currentConstraint = vertexingOptions.vertexConstraint;
     // Retrieve seed vertex from all remaining seedTracks
     auto seedResult =
-        doSeeding(seedTracks, currentConstraint, vertexingOptions);
+        doSeeding(seedTracks, currentConstraint, vertexingOptions,
+                  seedFinderState);
     if (!seedResult.ok()) {
       return seedResult.error();
     }
@@ -130,12 +210,18 @@ template <typename vfitter_t, typename sfinder_t>
 auto Acts::AdaptiveMultiVertexFinder<vfitter_t, sfinder_t>::doSeeding(
     const std::vector<const InputTrack_t*>& trackVector,
     Vertex<InputTrack_t>& currentConstraint,
-    const VertexingOptions<InputTrack_t>& vertexingOptions) const
-    -> Result<Vertex<InputTrack_t>> {
+    const VertexingOptions<InputTrack_t>& vertexingOptions,
+    SeedFinderState_t& seedFinderState) const -> Result<Vertex<InputTrack_t>> {
   VertexingOptions<InputTrack_t> seedOptions = vertexingOptions;
   seedOptions.vertexConstraint = currentConstraint;
-  // Run seed finder
-  auto seedResult = m_cfg.seedFinder.find(trackVector, seedOptions);
+  // Run seed finder, with its state kept since the last iteration
+  auto seedResult = [&]() {
+    if constexpr (VertexFinderHasState<sfinder_t>) {
+      return m_cfg.seedFinder.find(trackVector, seedOptions, seedFinderState);
+    } else {
+      return m_cfg.seedFinder.find(trackVector, seedOptions);
+    }
+  }();
 
   if (!seedResult.ok()) {
     return seedResult.error();
@@ -263,6 +263,12 @@ Acts::Result<void> Acts::
     AdaptiveMultiVertexFitter<input_track_t, linearizer_t>::setWeightsAndUpdate(
         State& state, const linearizer_t& linearizer,
         const VertexingOptions<input_track_t>& vertexingOptions) const {
+  // Set the track weights and collect the tracks that need to be
+  // (re-)linearized. The linearization points do not change during the
+  // vertex updates, all tracks of all vertices are linearized at once.
+  std::vector<TrackAtVertex<input_track_t>*> linTracksAtVtx;
+  std::vector<BoundParameters> linParams;
+  std::vector<SpacePointVector> linPoints;
   for (auto vtx : state.vertexCollection) {
     VertexInfo<input_track_t>& currentVtxInfo = state.vtxInfoMap[vtx];
 
@@ -275,20 +281,41 @@ Acts::Result<void> Acts::
           collectTrackToVertexCompatibilities(state, trk));
       trkAtVtx.trackWeight = currentTrkWeight;
 
+      // Check if linearization state exists or need to be relinearized
+      if (trkAtVtx.trackWeight > m_cfg.minWeight and
+          (trkAtVtx.linearizedState.covarianceAtPCA ==
+               BoundSymMatrix::Zero() or
+           currentVtxInfo.relinearize)) {
+        linTracksAtVtx.push_back(&trkAtVtx);
+        linParams.push_back(m_extractParameters(*trk));
+        linPoints.push_back(currentVtxInfo.oldPosition);
+        currentVtxInfo.linPoint = currentVtxInfo.oldPosition;
+      }
+    }
+  }
+
+  std::vector<const BoundParameters*> linParamsPtrs;
+  linParamsPtrs.reserve(linParams.size());
+  for (const auto& params : linParams) {
+    linParamsPtrs.push_back(&params);
+  }
+  auto linResults = linearizer.linearizeTracks(
+      linParamsPtrs, linPoints, vertexingOptions.geoContext,
+      vertexingOptions.magFieldContext);
+  for (size_t il = 0; il < linResults.size(); ++il) {
+    if (!linResults[il].ok()) {
+      return linResults[il].error();
+    }
+    linTracksAtVtx[il]->linearizedState = *linResults[il];
+  }
+
+  for (auto vtx : state.vertexCollection) {
+    VertexInfo<input_track_t>& currentVtxInfo = state.vtxInfoMap[vtx];
+
+    for (const auto& trk : currentVtxInfo.trackLinks) {
+      auto& trkAtVtx = state.tracksAtVerticesMap.at(std::make_pair(trk, vtx));
+
       if (trkAtVtx.trackWeight > m_cfg.minWeight) {
-        // Check if linearization state exists or need to be relinearized
-        if (trkAtVtx.linearizedState.covarianceAtPCA ==
-                BoundSymMatrix::Zero() ||
-            state.vtxInfoMap[vtx].relinearize) {
-          auto result = linearizer.linearizeTrack(
-              m_extractParameters(*trk), state.vtxInfoMap[vtx].oldPosition,
-              vertexingOptions.geoContext, vertexingOptions.magFieldContext);
-          if (!result.ok()) {
-            return result.error();
-          }
-          trkAtVtx.linearizedState = *result;
-          state.vtxInfoMap[vtx].linPoint = state.vtxInfoMap[vtx].oldPosition;
-        }
         // Update the vertex with the new track
         KalmanVertexUpdater::updateVertexWithTrack<input_track_t>(*vtx,
                                                                   trkAtVtx);
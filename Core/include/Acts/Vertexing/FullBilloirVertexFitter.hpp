@@ -10,6 +10,7 @@
 
 #include "Acts/Propagator/EigenStepper.hpp"
 #include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Utilities/TaskPool.hpp"
 #include "Acts/Vertexing/HelicalTrackLinearizer.hpp"
 #include "Acts/Vertexing/LinearizerConcept.hpp"
 #include "Acts/Vertexing/Vertex.hpp"
@@ -43,6 +44,40 @@ class FullBilloirVertexFitter {
   struct Config {
     /// Maximum number of interations in fitter
     int maxIterations = 5;
+    /// Optional pool to compute the per-track blocks concurrently
+    std::shared_ptr<TaskPool> taskPool = nullptr;
+  };
+
+  /// @brief Cached per-track quantities of the fit
+  struct TrackBlock {
+    SpacePointToBoundMatrix DiMat;                   // position jacobian
+    ActsMatrixD<eBoundParametersSize, 3> EiMat;      // momentum jacobian
+    BoundSymMatrix WiMat;                            // weight at PCA
+    BoundVector deltaQ;                              // = q_i - f(V_0, p_0)
+    BoundToSpacePointMatrix DtWmat;                  // = DiMat^T * Wi
+    ActsMatrixD<3, eBoundParametersSize> EtWmat;     // = EiMat^T * Wi
+    ActsSymMatrixD<3> CiMat;                         // = EtWmat * EiMat
+    ActsMatrixD<4, 3> BiMat;                         // = DtWmat * EiMat
+    ActsSymMatrixD<3> CiInv;                         // = CiMat^-1
+    Vector3D UiVec;                                  // = EtWmat * dqi
+    ActsMatrixD<4, 3> BCiMat;                        // = BiMat * CiInv
+    Vector3D momentum;                               // (phi, theta, q/p)
+    BoundSymMatrix covDeltaP;                        // refitted covariance
+    double chi2 = 0;
+    // Refitted momentum, covariance and chi2 of the best iteration
+    Vector3D bestMomentum;
+    BoundSymMatrix bestCovDeltaP;
+    double bestChi2 = 0;
+  };
+
+  /// @brief The fitter state
+  ///
+  /// Holds the storage of all per-track quantities. It is reused between
+  /// the iterations of a fit and, if the state is kept, between fits.
+  struct State {
+    std::vector<TrackBlock> trackBlocks;
+    std::vector<BoundParameters> trackParams;
+    std::vector<const BoundParameters*> trackParamsPtrs;
   };
 
   /// @brief Constructor used if input_track_t type == BoundParameters
@@ -73,6 +108,20 @@ class FullBilloirVertexFitter {
       const linearizer_t& linearizer,
       const VertexingOptions<input_track_t>& vertexingOptions) const;
 
+  /// @brief Fit method, fitting vertex for provided tracks with constraint
+  ///
+  /// @param paramVector Vector of track objects to fit vertex to
+  /// @param linearizer The track linearizer
+  /// @param vertexingOptions Vertexing options
+  /// @param state The fitter state, its storage is reused
+  ///
+  /// @return Fitted vertex
+  Result<Vertex<input_track_t>> fit(
+      const std::vector<const input_track_t*>& paramVector,
+      const linearizer_t& linearizer,
+      const VertexingOptions<input_track_t>& vertexingOptions,
+      State& state) const;
+
  private:
   /// Configuration object
   Config m_cfg;
@@ -14,31 +14,6 @@
 
 namespace {
 
-/// @struct BilloirTrack
-///
-/// @brief Struct to cache track-specific matrix operations in Billoir fitter
-template <typename input_track_t>
-struct BilloirTrack {
-  using Jacobian = Acts::SpacePointToBoundMatrix;
-
-  BilloirTrack(const input_track_t* params, Acts::LinearizedTrack lTrack)
-      : originalTrack(params), linTrack(std::move(lTrack)) {}
-
-  BilloirTrack(const BilloirTrack& arg) = default;
-
-  const input_track_t* originalTrack;
-  Acts::LinearizedTrack linTrack;
-  double chi2;
-  Jacobian DiMat;                                          // position jacobian
-  Acts::ActsMatrixD<Acts::eBoundParametersSize, 3> EiMat;  // momentum jacobian
-  Acts::ActsSymMatrixD<3> CiMat;   //  = EtWmat * Emat (see below)
-  Acts::ActsMatrixD<4, 3> BiMat;   //  = DiMat^T * Wi * EiMat
-  Acts::ActsSymMatrixD<3> CiInv;   //  = (EiMat^T * Wi * EiMat)^-1
-  Acts::Vector3D UiVec;            //  = EiMat^T * Wi * dqi
-  Acts::ActsMatrixD<4, 3> BCiMat;  //  = BiMat * Ci^-1
-  Acts::BoundVector deltaQ;
-};
-
 /// @struct BilloirVertex
 ///
 /// @brief Struct to cache vertex-specific matrix operations in Billoir fitter
@@ -66,6 +41,17 @@ Acts::FullBilloirVertexFitter<input_track_t, linearizer_t>::fit(
     const std::vector<const input_track_t*>& paramVector,
     const linearizer_t& linearizer,
     const VertexingOptions<input_track_t>& vertexingOptions) const {
+  State state;
+  return fit(paramVector, linearizer, vertexingOptions, state);
+}
+
+template <typename input_track_t, typename linearizer_t>
+Acts::Result<Acts::Vertex<input_track_t>>
+Acts::FullBilloirVertexFitter<input_track_t, linearizer_t>::fit(
+    const std::vector<const input_track_t*>& paramVector,
+    const linearizer_t& linearizer,
+    const VertexingOptions<input_track_t>& vertexingOptions,
+    State& state) const {
   double chi2 = std::numeric_limits<double>::max();
   double newChi2 = 0;
   unsigned int nTracks = paramVector.size();
@@ -89,103 +75,93 @@ Acts::FullBilloirVertexFitter<input_track_t, linearizer_t>::fit(
     ndf += 3;
   }
 
-  std::vector<BilloirTrack<input_track_t>> billoirTracks;
-
-  std::vector<Vector3D> trackMomenta;
-
   SpacePointVector linPoint(vertexingOptions.vertexConstraint.fullPosition());
 
   Vertex<input_track_t> fittedVertex;
 
-  for (int nIter = 0; nIter < m_cfg.maxIterations; ++nIter) {
-    billoirTracks.clear();
-
-    newChi2 = 0;
+  // the track parameters do not change between iterations
+  auto& trackBlocks = state.trackBlocks;
+  auto& trackParams = state.trackParams;
+  auto& trackParamsPtrs = state.trackParamsPtrs;
+  trackBlocks.resize(nTracks);
+  trackParams.clear();
+  trackParams.reserve(nTracks);
+  trackParamsPtrs.clear();
+  for (unsigned int iTrack = 0; iTrack < nTracks; ++iTrack) {
+    trackParams.push_back(extractParameters(*paramVector[iTrack]));
+    double phi = trackParams.back().parameters()[ParID_t::ePHI];
+    double theta = trackParams.back().parameters()[ParID_t::eTHETA];
+    double qop = trackParams.back().parameters()[ParID_t::eQOP];
+    trackBlocks[iTrack].momentum = Vector3D(phi, theta, qop);
+  }
+  for (const auto& params : trackParams) {
+    trackParamsPtrs.push_back(&params);
+  }
 
-    BilloirVertex billoirVertex;
-    int iTrack = 0;
-    // iterate over all tracks
-    for (const input_track_t* trackContainer : paramVector) {
-      const auto& trackParams = extractParameters(*trackContainer);
-      if (nIter == 0) {
-        double phi = trackParams.parameters()[ParID_t::ePHI];
-        double theta = trackParams.parameters()[ParID_t::eTHETA];
-        double qop = trackParams.parameters()[ParID_t::eQOP];
-        trackMomenta.push_back(Vector3D(phi, theta, qop));
+  // the per-track blocks are independent of each other
+  auto forEachTrack = [&](auto&& func) {
+    if (m_cfg.taskPool) {
+      m_cfg.taskPool->parallelFor(nTracks, func);
+    } else {
+      for (unsigned int iTrack = 0; iTrack < nTracks; ++iTrack) {
+        func(iTrack);
       }
+    }
+  };
 
-      auto result = linearizer.linearizeTrack(trackParams, linPoint,
-                                              vertexingOptions.geoContext,
-                                              vertexingOptions.magFieldContext);
-      if (result.ok()) {
-        const auto& linTrack = *result;
-        const auto& parametersAtPCA = linTrack.parametersAtPCA;
-        double d0 = parametersAtPCA[ParID_t::eLOC_D0];
-        double z0 = parametersAtPCA[ParID_t::eLOC_Z0];
-        double phi = parametersAtPCA[ParID_t::ePHI];
-        double theta = parametersAtPCA[ParID_t::eTHETA];
-        double qOverP = parametersAtPCA[ParID_t::eQOP];
-
-        // calculate f(V_0,p_0)  f_d0 = f_z0 = 0
-        double fPhi = trackMomenta[iTrack][0];
-        double fTheta = trackMomenta[iTrack][1];
-        double fQOvP = trackMomenta[iTrack][2];
-        BilloirTrack<input_track_t> currentBilloirTrack(trackContainer,
-                                                        linTrack);
-
-        currentBilloirTrack.deltaQ << d0, z0, phi - fPhi, theta - fTheta,
-            qOverP - fQOvP, 0;
-
-        // position jacobian (D matrix)
-        SpacePointToBoundMatrix Dmat;
-        Dmat = linTrack.positionJacobian;
-
-        // momentum jacobian (E matrix)
-        ActsMatrixD<eBoundParametersSize, 3> Emat;
-        Emat = linTrack.momentumJacobian;
-        // cache some matrix multiplications
-        BoundToSpacePointMatrix DtWmat;
-        ActsMatrixD<3, eBoundParametersSize> EtWmat;
-        BoundSymMatrix Wi = linTrack.weightAtPCA;
-
-        DtWmat = Dmat.transpose() * Wi;
-        EtWmat = Emat.transpose() * Wi;
-
-        // compute billoir tracks
-        currentBilloirTrack.DiMat = Dmat;
-        currentBilloirTrack.EiMat = Emat;
-        currentBilloirTrack.CiMat = EtWmat * Emat;
-        currentBilloirTrack.BiMat = DtWmat * Emat;  // DiMat^T * Wi * EiMat
-        currentBilloirTrack.UiVec =
-            EtWmat * currentBilloirTrack.deltaQ;  // EiMat^T * Wi * dqi
-        currentBilloirTrack.CiInv =
-            (EtWmat * Emat).inverse();  // (EiMat^T * Wi * EiMat)^-1
-
-        // sum up over all tracks
-        billoirVertex.Tvec +=
-            DtWmat * currentBilloirTrack.deltaQ;  // sum{DiMat^T * Wi * dqi}
-        billoirVertex.Amat += DtWmat * Dmat;      // sum{DiMat^T * Wi * DiMat}
-
-        // remember those results for all tracks
-        currentBilloirTrack.BCiMat =
-            currentBilloirTrack.BiMat *
-            currentBilloirTrack.CiInv;  // BCi = BiMat * Ci^-1
-
-        // and some summed results
-        billoirVertex.BCUvec +=
-            currentBilloirTrack.BCiMat *
-            currentBilloirTrack.UiVec;  // sum{BiMat * Ci^-1 * UiVec}
-        billoirVertex.BCBmat +=
-            currentBilloirTrack.BCiMat *
-            currentBilloirTrack.BiMat
-                .transpose();  // sum{BiMat * Ci^-1 * BiMat^T}
-
-        billoirTracks.push_back(currentBilloirTrack);
-        ++iTrack;
-      } else {
+  for (int nIter = 0; nIter < m_cfg.maxIterations; ++nIter) {
+    newChi2 = 0;
+
+    // all tracks are linearized at the current vertex position at once
+    auto linTracks = linearizer.linearizeTracks(
+        trackParamsPtrs, linPoint, vertexingOptions.geoContext,
+        vertexingOptions.magFieldContext);
+    for (auto& result : linTracks) {
+      if (not result.ok()) {
         return result.error();
       }
-    }  // end loop tracks
+    }
+
+    // compute billoir tracks
+    forEachTrack([&](size_t iTrack) {
+      const LinearizedTrack& linTrack = *linTracks[iTrack];
+      TrackBlock& bTrack = trackBlocks[iTrack];
+
+      // calculate f(V_0,p_0)  f_d0 = f_z0 = 0
+      const auto& parametersAtPCA = linTrack.parametersAtPCA;
+      bTrack.deltaQ << parametersAtPCA[ParID_t::eLOC_D0],
+          parametersAtPCA[ParID_t::eLOC_Z0],
+          parametersAtPCA[ParID_t::ePHI] - bTrack.momentum[0],
+          parametersAtPCA[ParID_t::eTHETA] - bTrack.momentum[1],
+          parametersAtPCA[ParID_t::eQOP] - bTrack.momentum[2], 0;
+
+      // position jacobian (D matrix), momentum jacobian (E matrix)
+      bTrack.DiMat = linTrack.positionJacobian;
+      bTrack.EiMat = linTrack.momentumJacobian;
+      bTrack.WiMat = linTrack.weightAtPCA;
+
+      // cache some matrix multiplications
+      bTrack.DtWmat.noalias() = bTrack.DiMat.transpose() * bTrack.WiMat;
+      bTrack.EtWmat.noalias() = bTrack.EiMat.transpose() * bTrack.WiMat;
+      bTrack.CiMat.noalias() = bTrack.EtWmat * bTrack.EiMat;
+      bTrack.BiMat.noalias() = bTrack.DtWmat * bTrack.EiMat;
+      bTrack.UiVec.noalias() = bTrack.EtWmat * bTrack.deltaQ;
+      bTrack.CiInv = bTrack.CiMat.inverse();
+      bTrack.BCiMat.noalias() = bTrack.BiMat * bTrack.CiInv;
+    });
+
+    // sum up over all tracks, in a fixed order
+    BilloirVertex billoirVertex;
+    for (const auto& bTrack : trackBlocks) {
+      // sum{DiMat^T * Wi * dqi}
+      billoirVertex.Tvec += bTrack.DtWmat * bTrack.deltaQ;
+      // sum{DiMat^T * Wi * DiMat}
+      billoirVertex.Amat += bTrack.DtWmat * bTrack.DiMat;
+      // sum{BiMat * Ci^-1 * UiVec}
+      billoirVertex.BCUvec += bTrack.BCiMat * bTrack.UiVec;
+      // sum{BiMat * Ci^-1 * BiMat^T}
+      billoirVertex.BCBmat += bTrack.BCiMat * bTrack.BiMat.transpose();
+    }
 
     // calculate delta (billoirFrameOrigin-position), might be changed by the
     // beam-const
@@ -212,22 +188,20 @@ Acts::FullBilloirVertexFitter<input_track_t, linearizer_t>::fit(
     //--------------------------------------------------------------------------------------
     // start momentum related calculations
 
-    std::vector<std::optional<BoundSymMatrix>> covDeltaPmat(nTracks);
-
-    iTrack = 0;
-    for (auto& bTrack : billoirTracks) {
+    forEachTrack([&](size_t iTrack) {
+      TrackBlock& bTrack = trackBlocks[iTrack];
       Vector3D deltaP =
           (bTrack.CiInv) * (bTrack.UiVec - bTrack.BiMat.transpose() * deltaV);
 
       // update track momenta
-      trackMomenta[iTrack] += deltaP;
+      bTrack.momentum += deltaP;
 
       // correct for 2PI / PI periodicity
-      auto correctedPhiTheta = detail::ensureThetaBounds(
-          trackMomenta[iTrack][0], trackMomenta[iTrack][1]);
+      auto correctedPhiTheta =
+          detail::ensureThetaBounds(bTrack.momentum[0], bTrack.momentum[1]);
 
-      trackMomenta[iTrack][0] = correctedPhiTheta.first;
-      trackMomenta[iTrack][1] = correctedPhiTheta.second;
+      bTrack.momentum[0] = correctedPhiTheta.first;
+      bTrack.momentum[1] = correctedPhiTheta.second;
 
       // calculate 5x5 covdelta_P matrix
       // d(d0,z0,phi,theta,qOverP, t)/d(x,y,z,phi,theta,qOverP,
@@ -265,17 +239,15 @@ Acts::FullBilloirVertexFitter<input_track_t, linearizer_t>::fit(
       covMat.block<3, 3>(4, 4) = PPmat;
 
       // covdelta_P calculation
-      covDeltaPmat[iTrack] = transMat * covMat * transMat.transpose();
+      bTrack.covDeltaP = transMat * covMat * transMat.transpose();
       // Calculate chi2 per track.
-      bTrack.chi2 =
-          ((bTrack.deltaQ - bTrack.DiMat * deltaV - bTrack.EiMat * deltaP)
-               .transpose())
-              .dot(bTrack.linTrack.weightAtPCA *
-                   (bTrack.deltaQ - bTrack.DiMat * deltaV -
-                    bTrack.EiMat * deltaP));
-      newChi2 += bTrack.chi2;
+      BoundVector residual =
+          bTrack.deltaQ - bTrack.DiMat * deltaV - bTrack.EiMat * deltaP;
+      bTrack.chi2 = residual.dot(bTrack.WiMat * residual);
+    });
 
-      ++iTrack;
+    for (const auto& bTrack : trackBlocks) {
+      newChi2 += bTrack.chi2;
     }
 
     if (isConstraintFit) {
@@ -303,35 +275,40 @@ Acts::FullBilloirVertexFitter<input_track_t, linearizer_t>::fit(
     if (newChi2 < chi2) {
       chi2 = newChi2;
 
-      SpacePointVector vertexPos(linPoint);
-
-      fittedVertex.setFullPosition(vertexPos);
+      fittedVertex.setFullPosition(linPoint);
       fittedVertex.setFullCovariance(covDeltaVmat);
       fittedVertex.setFitQuality(chi2, ndf);
 
-      std::vector<TrackAtVertex<input_track_t>> tracksAtVertex;
+      // remember the refitted tracks, the output is only created once
+      for (auto& bTrack : trackBlocks) {
+        bTrack.bestMomentum = bTrack.momentum;
+        bTrack.bestCovDeltaP = bTrack.covDeltaP;
+        bTrack.bestChi2 = bTrack.chi2;
+      }
+    }
+  }  // end loop iterations
 
-      std::shared_ptr<PerigeeSurface> perigee =
-          Surface::makeShared<PerigeeSurface>(
-              VectorHelpers::position(vertexPos));
+  if (chi2 < std::numeric_limits<double>::max()) {
+    std::vector<TrackAtVertex<input_track_t>> tracksAtVertex;
+    tracksAtVertex.reserve(nTracks);
 
-      iTrack = 0;
-      for (auto& bTrack : billoirTracks) {
-        // new refitted trackparameters
-        BoundVector paramVec;
-        paramVec << 0., 0., trackMomenta[iTrack](0), trackMomenta[iTrack](1),
-            trackMomenta[iTrack](2), 0.;
+    std::shared_ptr<PerigeeSurface> perigee =
+        Surface::makeShared<PerigeeSurface>(fittedVertex.position());
 
-        BoundParameters refittedParams(vertexingOptions.geoContext,
-                                       covDeltaPmat[iTrack], paramVec, perigee);
+    for (unsigned int iTrack = 0; iTrack < nTracks; ++iTrack) {
+      const TrackBlock& bTrack = trackBlocks[iTrack];
+      // new refitted trackparameters
+      BoundVector paramVec;
+      paramVec << 0., 0., bTrack.bestMomentum(0), bTrack.bestMomentum(1),
+          bTrack.bestMomentum(2), 0.;
 
-        TrackAtVertex<input_track_t> trackVx(bTrack.chi2, refittedParams,
-                                             bTrack.originalTrack);
-        tracksAtVertex.push_back(std::move(trackVx));
-        ++iTrack;
-      }
-      fittedVertex.setTracksAtVertex(tracksAtVertex);
+      BoundParameters refittedParams(vertexingOptions.geoContext,
+                                     bTrack.bestCovDeltaP, paramVec, perigee);
+
+      tracksAtVertex.emplace_back(bTrack.bestChi2, refittedParams,
+                                  paramVector[iTrack]);
     }
-  }  // end loop iterations
+    fittedVertex.setTracksAtVertex(tracksAtVertex);
+  }
   return std::move(fittedVertex);
 }
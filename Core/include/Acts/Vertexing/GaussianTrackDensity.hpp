@@ -62,6 +62,29 @@ class GaussianTrackDensity {
   std::pair<double, double> globalMaximumWithWidth(
       const std::vector<Acts::BoundParameters>& trackList, State& state) const;
 
+  /// @brief Calculates the global maximum with width of the tracks
+  /// currently in the state
+  ///
+  /// Only the parts of the density which changed since the last call with
+  /// the same state are evaluated again.
+  ///
+  /// @param state The GaussianTrackDensity state
+  ///
+  /// @return The z position of the maximum and its width
+  std::pair<double, double> globalMaximumWithWidth(State& state) const;
+
+  /// @brief Adds a single track, if it passes the significance cuts
+  ///
+  /// @param trk The track
+  /// @param state The GaussianTrackDensity state
+  void addTrack(const Acts::BoundParameters& trk, State& state) const;
+
+  /// @brief Removes a single track
+  ///
+  /// @param trk The track
+  /// @param state The GaussianTrackDensity state
+  void removeTrack(const Acts::BoundParameters& trk, State& state) const;
+
  private:
   /// The configuration
   Config m_cfg;
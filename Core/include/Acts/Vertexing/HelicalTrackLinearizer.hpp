@@ -14,10 +14,16 @@
 #include "Acts/MagneticField/NullBField.hpp"
 #include "Acts/Propagator/EigenStepper.hpp"
 #include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
 #include "Acts/Utilities/Definitions.hpp"
 #include "Acts/Utilities/Result.hpp"
+#include "Acts/Utilities/TaskPool.hpp"
+#include "Acts/Utilities/detail/periodic.hpp"
 #include "Acts/Vertexing/LinearizedTrack.hpp"
 
+#include <memory>
+#include <vector>
+
 namespace Acts {
 
 /// @class HelicalTrackLinearizer
@@ -37,6 +43,12 @@ namespace Acts {
 ///
 /// Ref.(1) - CERN-THESIS-2010-027, Giacinto Piacquadio (Freiburg U.)
 ///
+/// Within the configured region around the beam line, the magnetic field
+/// is considered homogeneous. The track is then moved to the perigee of the
+/// linearization point along the helix in closed form, and the covariance
+/// is transported with the analytic derivatives of the same expansion.
+/// Elsewhere, the propagator is used.
+///
 /// @tparam propagator_t Propagator type
 /// @tparam propagator_options_t Propagator options type
 template <typename propagator_t,
@@ -72,6 +84,14 @@ class HelicalTrackLinearizer {
     double minQoP = 1e-15;
     // Maximum curvature value
     double maxRho = 1e+15;
+    // Optional pool to linearize several tracks concurrently
+    std::shared_ptr<TaskPool> taskPool = nullptr;
+    // Maximum transverse radius and absolute z of the region with a
+    // homogeneous field. Tracks with their reference position and the
+    // linearization point inside are transported analytically. The region
+    // is empty by default.
+    double analyticRMax = 0.;
+    double analyticZMax = 0.;
   };
 
   /// @brief Constructor
@@ -93,7 +113,82 @@ class HelicalTrackLinearizer {
       const Acts::GeometryContext& gctx,
       const Acts::MagneticFieldContext& mctx) const;
 
+  /// @brief Function that linearizes several BoundParameters at
+  /// a common linearization point
+  ///
+  /// All tracks are propagated to the same perigee surface. If a task pool
+  /// is configured, the tracks are linearized concurrently.
+  ///
+  /// @param params Parameters to linearize
+  /// @param linPoint Linearization point
+  /// @param gctx The geometry context
+  /// @param mctx The magnetic field context
+  ///
+  /// @return Linearized tracks, in the order of the input parameters
+  std::vector<Result<LinearizedTrack>> linearizeTracks(
+      const std::vector<const BoundParameters*>& params,
+      const SpacePointVector& linPoint, const Acts::GeometryContext& gctx,
+      const Acts::MagneticFieldContext& mctx) const;
+
+  /// @brief Function that linearizes several BoundParameters, each at
+  /// its own linearization point
+  ///
+  /// Tracks with identical linearization points, e.g. all tracks of one
+  /// vertex, share one perigee surface. If a task pool is configured, the
+  /// tracks are linearized concurrently.
+  ///
+  /// @param params Parameters to linearize
+  /// @param linPoints Linearization point for each track
+  /// @param gctx The geometry context
+  /// @param mctx The magnetic field context
+  ///
+  /// @return Linearized tracks, in the order of the input parameters
+  std::vector<Result<LinearizedTrack>> linearizeTracks(
+      const std::vector<const BoundParameters*>& params,
+      const std::vector<SpacePointVector>& linPoints,
+      const Acts::GeometryContext& gctx,
+      const Acts::MagneticFieldContext& mctx) const;
+
  private:
+  /// @brief Check if the analytic transport can be used for the track
+  bool useAnalyticTransport(const BoundParameters& params,
+                            const SpacePointVector& linPoint) const;
+
+  /// @brief Linearize at the given perigee surface, which must be
+  /// centered at the linearization point
+  Result<LinearizedTrack> linearizeAtPerigee(
+      const BoundParameters& params, const SpacePointVector& linPoint,
+      const PerigeeSurface& perigeeSurface, const Acts::GeometryContext& gctx,
+      const Acts::MagneticFieldContext& mctx) const;
+
+  /// @brief Linearize with the track moved to the perigee of the
+  /// linearization point analytically along the helix
+  Result<LinearizedTrack> linearizeAnalytic(
+      const BoundParameters& params, const SpacePointVector& linPoint,
+      const Acts::GeometryContext& gctx,
+      const Acts::MagneticFieldContext& mctx) const;
+
+  /// @brief Linearize the parameters at the point of closest approach
+  Result<LinearizedTrack> linearizeAtPCA(
+      const BoundVector& paramsAtPCA, const SpacePointVector& positionAtPCA,
+      const BoundSymMatrix& parCovarianceAtPCA,
+      const SpacePointVector& linPoint) const;
+
+  /// @brief Perigee parameters wrt. the linearization point as a function
+  /// of a point on the helix and of the momentum there, Eq. 5.33 in Ref(1)
+  ///
+  /// @param position Position (and time) of a point on the helix
+  /// @param momentum Momentum (phi, theta, q/p) at this point
+  /// @param linPointPos Position of the linearization point
+  /// @param [out] positionJacobian Derivatives wrt. the position
+  /// @param [out] momentumJacobian Derivatives wrt. the momentum
+  ///
+  /// @return The perigee parameters, with the time set to zero
+  BoundVector perigeeExpansion(
+      const SpacePointVector& position, const Vector3D& momentum,
+      const Vector3D& linPointPos, SpacePointToBoundMatrix& positionJacobian,
+      ActsMatrixD<eBoundParametersSize, 3>& momentumJacobian) const;
+
   /// Configuration object
   const Config m_cfg;
 };
@@ -6,7 +6,7 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
-#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include <optional>
 
 template <typename propagator_t, typename propagator_options_t>
 Acts::Result<Acts::LinearizedTrack> Acts::
@@ -14,18 +14,115 @@ Acts::Result<Acts::LinearizedTrack> Acts::
         const BoundParameters& params, const SpacePointVector& linPoint,
         const Acts::GeometryContext& gctx,
         const Acts::MagneticFieldContext& mctx) const {
-  Vector3D linPointPos = VectorHelpers::position(linPoint);
+  if (useAnalyticTransport(params, linPoint)) {
+    return linearizeAnalytic(params, linPoint, gctx, mctx);
+  }
 
   const std::shared_ptr<PerigeeSurface> perigeeSurface =
-      Surface::makeShared<PerigeeSurface>(linPointPos);
+      Surface::makeShared<PerigeeSurface>(VectorHelpers::position(linPoint));
+
+  return linearizeAtPerigee(params, linPoint, *perigeeSurface, gctx, mctx);
+}
+
+template <typename propagator_t, typename propagator_options_t>
+std::vector<Acts::Result<Acts::LinearizedTrack>>
+Acts::HelicalTrackLinearizer<propagator_t, propagator_options_t>::
+    linearizeTracks(const std::vector<const BoundParameters*>& params,
+                    const SpacePointVector& linPoint,
+                    const Acts::GeometryContext& gctx,
+                    const Acts::MagneticFieldContext& mctx) const {
+  return linearizeTracks(
+      params, std::vector<SpacePointVector>(params.size(), linPoint), gctx,
+      mctx);
+}
+
+template <typename propagator_t, typename propagator_options_t>
+std::vector<Acts::Result<Acts::LinearizedTrack>>
+Acts::HelicalTrackLinearizer<propagator_t, propagator_options_t>::
+    linearizeTracks(const std::vector<const BoundParameters*>& params,
+                    const std::vector<SpacePointVector>& linPoints,
+                    const Acts::GeometryContext& gctx,
+                    const Acts::MagneticFieldContext& mctx) const {
+  // One perigee surface per distinct linearization point of the tracks
+  // which need to be propagated. There are only a few distinct points,
+  // i.e. vertices, so a linear search is sufficient.
+  std::vector<Vector3D> perigeePositions;
+  std::vector<std::shared_ptr<PerigeeSurface>> perigeeSurfaces;
+  std::vector<size_t> perigeeIndices(params.size());
+  std::vector<bool> analytic(params.size());
+  for (size_t it = 0; it < params.size(); ++it) {
+    analytic[it] = useAnalyticTransport(*params[it], linPoints[it]);
+    if (analytic[it]) {
+      continue;
+    }
+    const Vector3D linPointPos = VectorHelpers::position(linPoints[it]);
+    size_t ip = 0;
+    while (ip < perigeePositions.size() and
+           perigeePositions[ip] != linPointPos) {
+      ++ip;
+    }
+    if (ip == perigeePositions.size()) {
+      perigeePositions.push_back(linPointPos);
+      perigeeSurfaces.push_back(
+          Surface::makeShared<PerigeeSurface>(linPointPos));
+    }
+    perigeeIndices[it] = ip;
+  }
 
+  std::vector<std::optional<Result<LinearizedTrack>>> results(params.size());
+  auto linearize = [&](size_t it) {
+    if (analytic[it]) {
+      results[it].emplace(
+          linearizeAnalytic(*params[it], linPoints[it], gctx, mctx));
+      return;
+    }
+    results[it].emplace(linearizeAtPerigee(*params[it], linPoints[it],
+                                           *perigeeSurfaces[perigeeIndices[it]],
+                                           gctx, mctx));
+  };
+  if (m_cfg.taskPool) {
+    m_cfg.taskPool->parallelFor(params.size(), linearize);
+  } else {
+    for (size_t it = 0; it < params.size(); ++it) {
+      linearize(it);
+    }
+  }
+
+  std::vector<Result<LinearizedTrack>> linTracks;
+  linTracks.reserve(params.size());
+  for (auto& result : results) {
+    linTracks.push_back(std::move(*result));
+  }
+  return linTracks;
+}
+
+template <typename propagator_t, typename propagator_options_t>
+bool Acts::HelicalTrackLinearizer<propagator_t, propagator_options_t>::
+    useAnalyticTransport(const BoundParameters& params,
+                         const SpacePointVector& linPoint) const {
+  auto isInside = [this](const Vector3D& pos) {
+    return VectorHelpers::perp(pos) < m_cfg.analyticRMax and
+           std::abs(pos.z()) < m_cfg.analyticZMax;
+  };
+  return params.covariance() and isInside(params.position()) and
+         isInside(VectorHelpers::position(linPoint));
+}
+
+template <typename propagator_t, typename propagator_options_t>
+Acts::Result<Acts::LinearizedTrack>
+Acts::HelicalTrackLinearizer<propagator_t, propagator_options_t>::
+    linearizeAtPerigee(const BoundParameters& params,
+                       const SpacePointVector& linPoint,
+                       const PerigeeSurface& perigeeSurface,
+                       const Acts::GeometryContext& gctx,
+                       const Acts::MagneticFieldContext& mctx) const {
   // Create propagator options
   propagator_options_t pOptions(gctx, mctx);
   pOptions.direction = backward;
 
   const BoundParameters* endParams = nullptr;
   // Do the propagation to linPointPos
-  auto result = m_cfg.propagator->propagate(params, *perigeeSurface, pOptions);
+  auto result = m_cfg.propagator->propagate(params, perigeeSurface, pOptions);
   if (result.ok()) {
     endParams = (*result).endParameters.get();
 
@@ -45,24 +142,147 @@ Acts::Result<Acts::LinearizedTrack> Acts::
     parCovarianceAtPCA = *(params.covariance());
   }
 
-  // phiV and functions
+  return linearizeAtPCA(paramsAtPCA, positionAtPCA, parCovarianceAtPCA,
+                        linPoint);
+}
+
+template <typename propagator_t, typename propagator_options_t>
+Acts::Result<Acts::LinearizedTrack>
+Acts::HelicalTrackLinearizer<propagator_t, propagator_options_t>::
+    linearizeAnalytic(const BoundParameters& params,
+                      const SpacePointVector& linPoint,
+                      const Acts::GeometryContext& gctx,
+                      const Acts::MagneticFieldContext& mctx) const {
+  Vector3D linPointPos = VectorHelpers::position(linPoint);
+
+  // Expand around the current reference position of the track, the
+  // expansion is exact along the helix
+  const Vector3D position = params.position();
+  const Vector3D direction = params.momentum().normalized();
+  SpacePointVector trackPosition = SpacePointVector::Zero();
+  VectorHelpers::position(trackPosition) = position;
+  trackPosition[3] = params.time();
+  const double phi = VectorHelpers::phi(direction);
+  const double theta = VectorHelpers::theta(direction);
+  const double qOvP = params.parameters()[ParID_t::eQOP];
+
+  SpacePointToBoundMatrix positionJacobian;
+  ActsMatrixD<eBoundParametersSize, 3> momentumJacobian;
+  BoundVector paramsAtPCA =
+      perigeeExpansion(trackPosition, Vector3D(phi, theta, qOvP), linPointPos,
+                       positionJacobian, momentumJacobian);
+
+  // Transverse path length from the reference position to the perigee
+  const double Bz = m_cfg.bField.getField(position)[eZ];
+  const double sinTh = std::sin(theta);
+  double transversePath = (paramsAtPCA[ParID_t::eLOC_Z0] + linPointPos.z() -
+                           position.z()) *
+                          std::tan(theta);
+  if (Bz != 0. and std::abs(qOvP) >= m_cfg.minQoP) {
+    const double rho = sinTh / (qOvP * Bz);
+    transversePath = rho * detail::radian_sym(
+                               phi - paramsAtPCA[ParID_t::ePHI]);
+  }
+  // Time along the path with the mass hypothesis of the propagator
+  const double mass = propagator_options_t(gctx, mctx).mass;
+  const double p = std::abs(params.charge() / qOvP);
+  paramsAtPCA[ParID_t::eT] =
+      params.time() + transversePath / sinTh * std::hypot(1., mass / p);
+
+  // Derivatives of the expansion point and momentum wrt. the bound
+  // parameters at the reference surface
+  BoundToFreeMatrix jacToGlobal = BoundToFreeMatrix::Zero();
+  params.referenceSurface().initJacobianToGlobal(
+      gctx, jacToGlobal, position, direction, params.parameters());
+  ActsMatrixD<3, eFreeParametersSize> momentumToFree =
+      ActsMatrixD<3, eFreeParametersSize>::Zero();
+  const double transverseDir2 =
+      direction.x() * direction.x() + direction.y() * direction.y();
+  momentumToFree(0, eFreeDir0) = -direction.y() / transverseDir2;
+  momentumToFree(0, eFreeDir1) = direction.x() / transverseDir2;
+  momentumToFree(1, eFreeDir2) = -1. / std::sqrt(transverseDir2);
+  momentumToFree(2, eFreeQOverP) = 1.;
+
+  // Transport the covariance to the perigee
+  const BoundMatrix transportJacobian =
+      positionJacobian * jacToGlobal.template topRows<4>() +
+      momentumJacobian * momentumToFree * jacToGlobal;
+  const BoundSymMatrix parCovarianceAtPCA = transportJacobian *
+                                            (*params.covariance()) *
+                                            transportJacobian.transpose();
+
+  // Position of the perigee, the time is not used in the linearization
+  const double phiAtPCA = paramsAtPCA[ParID_t::ePHI];
+  SpacePointVector positionAtPCA = SpacePointVector::Zero();
+  VectorHelpers::position(positionAtPCA) =
+      linPointPos +
+      Vector3D(-paramsAtPCA[ParID_t::eLOC_D0] * std::sin(phiAtPCA),
+               paramsAtPCA[ParID_t::eLOC_D0] * std::cos(phiAtPCA),
+               paramsAtPCA[ParID_t::eLOC_Z0]);
+
+  return linearizeAtPCA(paramsAtPCA, positionAtPCA, parCovarianceAtPCA,
+                        linPoint);
+}
+
+template <typename propagator_t, typename propagator_options_t>
+Acts::Result<Acts::LinearizedTrack>
+Acts::HelicalTrackLinearizer<propagator_t, propagator_options_t>::
+    linearizeAtPCA(const BoundVector& paramsAtPCA,
+                   const SpacePointVector& positionAtPCA,
+                   const BoundSymMatrix& parCovarianceAtPCA,
+                   const SpacePointVector& linPoint) const {
   double phiV = paramsAtPCA(ParID_t::ePHI);
+  double th = paramsAtPCA(ParID_t::eTHETA);
+  double qOvP = paramsAtPCA(ParID_t::eQOP);
+
+  Vector3D momentumAtPCA(phiV, th, qOvP);
+
+  SpacePointToBoundMatrix positionJacobian;
+  ActsMatrixD<eBoundParametersSize, 3> momentumJacobian;
+  BoundVector predParamsAtPCA =
+      perigeeExpansion(positionAtPCA, momentumAtPCA,
+                       VectorHelpers::position(linPoint), positionJacobian,
+                       momentumJacobian);
+
+  // const term F(V_0, p_0) in Talyor expansion
+  BoundVector constTerm = predParamsAtPCA - positionJacobian * positionAtPCA -
+                          momentumJacobian * momentumAtPCA;
+
+  // The parameter weight
+  ActsSymMatrixD<5> parWeight =
+      (parCovarianceAtPCA.block<5, 5>(0, 0)).inverse();
+
+  BoundSymMatrix weightAtPCA{BoundSymMatrix::Identity()};
+  weightAtPCA.block<5, 5>(0, 0) = parWeight;
+
+  return LinearizedTrack(paramsAtPCA, parCovarianceAtPCA, weightAtPCA, linPoint,
+                         positionJacobian, momentumJacobian, positionAtPCA,
+                         momentumAtPCA, constTerm);
+}
+
+template <typename propagator_t, typename propagator_options_t>
+Acts::BoundVector
+Acts::HelicalTrackLinearizer<propagator_t, propagator_options_t>::
+    perigeeExpansion(
+        const SpacePointVector& position, const Vector3D& momentum,
+        const Vector3D& linPointPos, SpacePointToBoundMatrix& positionJacobian,
+        ActsMatrixD<eBoundParametersSize, 3>& momentumJacobian) const {
+  // phiV and functions
+  double phiV = momentum[0];
   double sinPhiV = std::sin(phiV);
   double cosPhiV = std::cos(phiV);
 
   // theta and functions
-  double th = paramsAtPCA(ParID_t::eTHETA);
+  double th = momentum[1];
   const double sinTh = std::sin(th);
   const double tanTh = std::tan(th);
 
   // q over p
-  double qOvP = paramsAtPCA(ParID_t::eQOP);
+  double qOvP = momentum[2];
   double sgnH = (qOvP < 0.) ? -1 : 1;
 
-  Vector3D momentumAtPCA(phiV, th, qOvP);
-
   // get B-field z-component at current position
-  double Bz = m_cfg.bField.getField(VectorHelpers::position(positionAtPCA))[eZ];
+  double Bz = m_cfg.bField.getField(VectorHelpers::position(position))[eZ];
 
   double rho;
   double rho2;
@@ -76,8 +296,8 @@ Acts::Result<Acts::LinearizedTrack> Acts::
   }
 
   // Eq. 5.34 in Ref(1) (see .hpp)
-  double X = positionAtPCA(0) - linPointPos.x() + rho * sinPhiV;
-  double Y = positionAtPCA(1) - linPointPos.y() - rho * cosPhiV;
+  double X = position(0) - linPointPos.x() + rho * sinPhiV;
+  double Y = position(1) - linPointPos.y() - rho * cosPhiV;
   const double S2 = (X * X + Y * Y);
   const double S = std::sqrt(S2);
 
@@ -101,15 +321,16 @@ Acts::Result<Acts::LinearizedTrack> Acts::
 
   // Eq. 5.33 in Ref(1) (see .hpp)
   predParamsAtPCA[0] = rho - sgnH * S;
-  predParamsAtPCA[1] =
-      positionAtPCA[eZ] - linPointPos.z() + rho * (phiV - phiAtPCA) / tanTh;
+  // The phi difference has to be wrapped, the expansion point is not
+  // necessarily close to the perigee
+  predParamsAtPCA[1] = position[eZ] - linPointPos.z() +
+                       rho * detail::radian_sym(phiV - phiAtPCA) / tanTh;
   predParamsAtPCA[2] = phiAtPCA;
   predParamsAtPCA[3] = th;
   predParamsAtPCA[4] = qOvP;
   predParamsAtPCA[5] = 0.;
 
   // Fill position jacobian (D_k matrix), Eq. 5.36 in Ref(1)
-  SpacePointToBoundMatrix positionJacobian;
   positionJacobian.setZero();
   // First row
   positionJacobian(0, 0) = -sgnH * X / S;
@@ -131,12 +352,11 @@ Acts::Result<Acts::LinearizedTrack> Acts::
   positionJacobian(5, 3) = 1;
 
   // Fill momentum jacobian (E_k matrix), Eq. 5.37 in Ref(1)
-  ActsMatrixD<eBoundParametersSize, 3> momentumJacobian;
   momentumJacobian.setZero();
 
   double R = X * cosPhiV + Y * sinPhiV;
   double Q = X * sinPhiV - Y * cosPhiV;
-  double dPhi = phiAtPCA - phiV;
+  double dPhi = detail::radian_sym(phiAtPCA - phiV);
 
   // First row
   momentumJacobian(0, 0) = -sgnH * rho * R / S;
@@ -162,18 +382,5 @@ Acts::Result<Acts::LinearizedTrack> Acts::
   momentumJacobian(3, 1) = 1.;
   momentumJacobian(4, 2) = 1.;
 
-  // const term F(V_0, p_0) in Talyor expansion
-  BoundVector constTerm = predParamsAtPCA - positionJacobian * positionAtPCA -
-                          momentumJacobian * momentumAtPCA;
-
-  // The parameter weight
-  ActsSymMatrixD<5> parWeight =
-      (parCovarianceAtPCA.block<5, 5>(0, 0)).inverse();
-
-  BoundSymMatrix weightAtPCA{BoundSymMatrix::Identity()};
-  weightAtPCA.block<5, 5>(0, 0) = parWeight;
-
-  return LinearizedTrack(paramsAtPCA, parCovarianceAtPCA, weightAtPCA, linPoint,
-                         positionJacobian, momentumJacobian, positionAtPCA,
-                         momentumAtPCA, constTerm);
+  return predParamsAtPCA;
 }
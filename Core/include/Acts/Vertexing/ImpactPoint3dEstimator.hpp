@@ -57,6 +57,12 @@ class ImpactPoint3dEstimator {
     double minQoP = 1e-15;
     /// Maximum curvature value
     double maxRho = 1e+15;
+    /// Maximum transverse radius and absolute z of the region in which the
+    /// field is considered homogeneous. Within it, the track is moved to the
+    /// point of closest approach with a single helix step instead of the
+    /// propagator. The region is empty by default.
+    double analyticRMax = 0.;
+    double analyticZMax = 0.;
   };
 
   /// @brief Constructor
@@ -126,6 +132,16 @@ class ImpactPoint3dEstimator {
                                             const Vector3D& vtxPos, double phi,
                                             double theta, double r) const;
 
+  /// @brief Check if the track can be moved to the point of closest
+  /// approach with a single helix step
+  ///
+  /// @param gctx The geometry context
+  /// @param trkParams Track parameters
+  /// @param vtxPos The vertex position
+  bool useAnalyticTransport(const GeometryContext& gctx,
+                            const BoundParameters& trkParams,
+                            const Vector3D& vtxPos) const;
+
   /// @brief Helper function to calculate relative
   /// distance between track and vtxPos and the
   /// direction of the momentum
@@ -6,10 +6,13 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/Propagator/HelixStepper.hpp"
 #include "Acts/Propagator/Propagator.hpp"
 #include "Acts/Surfaces/PerigeeSurface.hpp"
 #include "Acts/Surfaces/PlaneSurface.hpp"
 #include "Acts/Utilities/Helpers.hpp"
+#include "Acts/Utilities/detail/periodic.hpp"
 #include "Acts/Vertexing/VertexingError.hpp"
 
 template <typename input_track_t, typename propagator_t,
@@ -75,6 +78,31 @@ Acts::ImpactPoint3dEstimator<input_track_t, propagator_t,
   propagator_options_t pOptions(gctx, mctx);
   pOptions.direction = backward;
 
+  if (useAnalyticTransport(gctx, trkParams, vtxPos)) {
+    // The point of closest approach is known, do a single exact helix
+    // step of the signed path length to it
+    const double bZ =
+        m_cfg.bField.getField(trkParams.referenceSurface().center(gctx))[eZ];
+    const double theta = trkParams.parameters()[ParID_t::eTHETA];
+    const double r =
+        std::sin(theta) / (trkParams.parameters()[ParID_t::eQOP] * bZ);
+    const double pathLength =
+        r *
+        detail::radian_sym(trkParams.parameters()[ParID_t::ePHI] -
+                           VectorHelpers::phi(momDir)) /
+        std::sin(theta);
+
+    HelixStepper stepper(ConstantBField(0., 0., bZ));
+    HelixStepper::State state(gctx, mctx, trkParams,
+                              pathLength < 0. ? backward : forward,
+                              std::abs(pathLength));
+    stepper.advance(state, pathLength, pOptions.mass);
+
+    auto boundState = stepper.boundState(state, *planeSurface, true);
+    return std::make_unique<const BoundParameters>(
+        std::move(std::get<BoundParameters>(boundState)));
+  }
+
   // Do the propagation to linPointPos
   auto result = m_cfg.propagator->propagate(trkParams, *planeSurface, pOptions);
   if (result.ok()) {
@@ -182,6 +210,27 @@ Acts::Result<double> Acts::ImpactPoint3dEstimator<
   return phi;
 }
 
+template <typename input_track_t, typename propagator_t,
+          typename propagator_options_t>
+bool Acts::ImpactPoint3dEstimator<input_track_t, propagator_t,
+                                  propagator_options_t>::
+    useAnalyticTransport(const GeometryContext& gctx,
+                         const BoundParameters& trkParams,
+                         const Vector3D& vtxPos) const {
+  auto isInside = [this](const Vector3D& pos) {
+    return VectorHelpers::perp(pos) < m_cfg.analyticRMax and
+           std::abs(pos.z()) < m_cfg.analyticZMax;
+  };
+  if (not isInside(trkParams.position()) or not isInside(vtxPos)) {
+    return false;
+  }
+  // A vanishing field or momentum is left to the propagator
+  const double bZ =
+      m_cfg.bField.getField(trkParams.referenceSurface().center(gctx))[eZ];
+  return bZ != 0. and
+         std::abs(trkParams.parameters()[ParID_t::eQOP]) >= m_cfg.minQoP;
+}
+
 template <typename input_track_t, typename propagator_t,
           typename propagator_options_t>
 Acts::Result<void> Acts::ImpactPoint3dEstimator<input_track_t, propagator_t,
@@ -11,6 +11,7 @@ auto Acts::IterativeVertexFinder<vfitter_t, sfinder_t>::find(
     const std::vector<const InputTrack_t*>& trackVector,
     const VertexingOptions<InputTrack_t>& vertexingOptions) const
     -> Result<std::vector<Vertex<InputTrack_t>>> {
+  ACTS_INSTRUMENT_SCOPE("IterativeVertexFinder::find");
   // Original tracks
   const std::vector<const InputTrack_t*>& origTracks = trackVector;
   // Tracks for seeding
@@ -19,11 +20,14 @@ auto Acts::IterativeVertexFinder<vfitter_t, sfinder_t>::find(
   // List of vertices to be filled below
   std::vector<Vertex<InputTrack_t>> vertexCollection;
 
+  SeedFinderState_t seedFinderState;
+
   int nInterations = 0;
   // begin iterating
   while (seedTracks.size() > 1 && nInterations < m_cfg.maxVertices) {
     /// Begin seeding
-    auto seedRes = getVertexSeed(seedTracks, vertexingOptions);
+    auto seedRes =
+        getVertexSeed(seedTracks, vertexingOptions, seedFinderState);
     if (!seedRes.ok()) {
       return seedRes.error();
     }
@@ -149,9 +153,17 @@ auto Acts::IterativeVertexFinder<vfitter_t, sfinder_t>::find(
 template <typename vfitter_t, typename sfinder_t>
 auto Acts::IterativeVertexFinder<vfitter_t, sfinder_t>::getVertexSeed(
     const std::vector<const InputTrack_t*>& seedTracks,
-    const VertexingOptions<InputTrack_t>& vertexingOptions) const
-    -> Result<Vertex<InputTrack_t>> {
-  auto res = m_cfg.seedFinder.find(seedTracks, vertexingOptions);
+    const VertexingOptions<InputTrack_t>& vertexingOptions,
+    SeedFinderState_t& seedFinderState) const -> Result<Vertex<InputTrack_t>> {
+  // Run seed finder, with its state kept since the last iteration
+  auto res = [&]() {
+    if constexpr (VertexFinderHasState<sfinder_t>) {
+      return m_cfg.seedFinder.find(seedTracks, vertexingOptions,
+                                   seedFinderState);
+    } else {
+      return m_cfg.seedFinder.find(seedTracks, vertexingOptions);
+    }
+  }();
   if (res.ok()) {
     auto vertexCollection = *res;
     if (vertexCollection.empty()) {
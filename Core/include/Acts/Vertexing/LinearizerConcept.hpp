@@ -15,6 +15,8 @@
 #include "Acts/Utilities/TypeTraits.hpp"
 #include "Acts/Vertexing/LinearizedTrack.hpp"
 
+#include <vector>
+
 namespace Acts {
 
 namespace concept {
@@ -24,6 +26,7 @@ namespace concept {
   using propagator_t = typename T::Propagator_t;
 
   METHOD_TRAIT(linTrack_t, linearizeTrack);
+  METHOD_TRAIT(linTracks_t, linearizeTracks);
 
   // clang-format off
     template <typename S>
@@ -37,10 +40,19 @@ namespace concept {
   
         static_assert(linTrack_exists, "linearizeTrack method not found");
 
+         constexpr static bool linTracks_exists = has_method<const S, std::vector<Result<LinearizedTrack>>,
+         linTracks_t, const std::vector<const BoundParameters*>&,
+                     const std::vector<SpacePointVector>&,
+                     const Acts::GeometryContext&,
+                     const Acts::MagneticFieldContext&>;
+
+        static_assert(linTracks_exists, "linearizeTracks method not found");
+
         constexpr static bool propagator_exists = exists<propagator_t, S>;
         static_assert(propagator_exists, "Propagator type not found");
 
         constexpr static bool value = require<linTrack_exists,
+                                              linTracks_exists,
                                               propagator_exists>;
       };
   // clang-format on
@@ -8,8 +8,8 @@
 
 #pragma once
 
+#include <algorithm>
 #include <map>
-#include <set>
 #include "Acts/EventData/TrackParameters.hpp"
 
 namespace Acts {
@@ -41,12 +41,32 @@ class TrackDensity {
     double upperBound = 0;
   };
 
-  /// @brief Functor to compare two z0 values
+  /// @brief Functor to order tracks by their z0 values
+  ///
+  /// Tracks with the same z0 are ordered by their remaining parameters and
+  /// their covariance, only identical tracks compare equal.
   struct predPerigee {
     bool operator()(const BoundParameters& left,
                     const BoundParameters& right) const {
-      return left.parameters()[ParID_t::eLOC_Z0] <
-             right.parameters()[ParID_t::eLOC_Z0];
+      const double leftZ0 = left.parameters()[ParID_t::eLOC_Z0];
+      const double rightZ0 = right.parameters()[ParID_t::eLOC_Z0];
+      if (leftZ0 != rightZ0) {
+        return leftZ0 < rightZ0;
+      }
+      if (left.parameters() != right.parameters()) {
+        return lexicographicalLess(left.parameters(), right.parameters());
+      }
+      // tracks in the density always have a covariance
+      return lexicographicalLess(*left.covariance(), *right.covariance());
+    }
+
+    template <typename matrix_t>
+    static bool lexicographicalLess(const matrix_t& left,
+                                    const matrix_t& right) {
+      return std::lexicographical_compare(left.data(),
+                                          left.data() + left.size(),
+                                          right.data(),
+                                          right.data() + right.size());
     }
   };
 
@@ -67,8 +87,9 @@ class TrackDensity {
   };
 
   using TrackMap = std::map<BoundParameters, TrackEntry, predPerigee>;
-  using LowerMap = std::map<TrackEntry, BoundParameters, predEntryByMax>;
-  using UpperMap = std::map<TrackEntry, BoundParameters, predEntryByMin>;
+  // Different tracks can have the same bounds
+  using LowerMap = std::multimap<TrackEntry, BoundParameters, predEntryByMax>;
+  using UpperMap = std::multimap<TrackEntry, BoundParameters, predEntryByMin>;
 
   /// @brief The Config struct
   struct Config {
@@ -77,14 +98,40 @@ class TrackDensity {
     bool isGaussianShaped = true;
   };
 
+  /// @brief Result of the maximum search started at a single track
+  struct MaximumSearch {
+    // Largest density found and its position and curvature
+    double z = 0;
+    double density = 0;
+    double curvature = 0;
+    // Range of all evaluated positions
+    double zMin = 0;
+    double zMax = 0;
+    // The search is up to date with the tracks in the state
+    bool isValid = false;
+  };
+
   /// @brief The State struct
+  ///
+  /// The state can be kept while tracks are added and removed. The maximum
+  /// searches of the tracks are cached and only repeated if a track was
+  /// added or removed in their vicinity.
   struct State {
+    // Upper bound of the half-width of the track ranges, it is not reduced
+    // when tracks are removed
     double maxZRange = 0;
+    // Upper bound of the distance of evaluated positions to the start
+    // of a maximum search
+    double maxSearchRange = 0;
 
     // Maps to cache track information
-    std::set<BoundParameters, predPerigee> trackSet;
+    TrackMap trackMap;
     LowerMap lowerMap;
     UpperMap upperMap;
+
+    // Cached maximum searches, keyed by the z0 of their start track and
+    // shared by all tracks with that z0
+    std::map<double, MaximumSearch> maximumSearches;
   };
 
   /// Default constructor
@@ -102,6 +149,15 @@ class TrackDensity {
   void addTrack(State& state, const BoundParameters& trk,
                 double d0SignificanceCut, double z0SignificanceCut) const;
 
+  /// @brief Remove a track from the set being considered
+  ///
+  /// Tracks which are not in the set, e.g. because they failed the
+  /// selection when being added, are ignored.
+  ///
+  /// @param state The track density state
+  /// @param trk Track parameters.
+  void removeTrack(State& state, const BoundParameters& trk) const;
+
   /// @brief Calculates z position of global maximum with Gaussian width
   /// for density function.
   /// Strategy:
@@ -114,6 +170,8 @@ class TrackDensity {
   /// nearest maximum, take that step and then do one final refinement. The
   /// largest density encountered in this procedure (after checking all tracks)
   /// is considered the maximum.
+  /// The searches of previous calls with the same state are reused if no
+  /// track was added or removed near the evaluated positions.
   ///
   /// @param state The track density state
   ///
@@ -152,6 +210,21 @@ class TrackDensity {
   /// The configuration
   Config m_cfg;
 
+  /// @brief Search the maximum starting at the given position
+  ///
+  /// @param state The track density state
+  /// @param z0 The start position
+  /// @param[out] search The result of the search
+  void searchMaximum(State& state, double z0, MaximumSearch& search) const;
+
+  /// @brief Invalidate the cached maximum searches which evaluated the
+  /// density within the given range
+  ///
+  /// @param state The track density state
+  /// @param zMin Lower limit of the range
+  /// @param zMax Upper limit of the range
+  void invalidateSearches(State& state, double zMin, double zMax) const;
+
   /// @brief Update the current maximum values
   ///
   /// @param newZ The new z value
@@ -10,12 +10,16 @@
 
 #include "Acts/EventData/TrackParameters.hpp"
 #include "Acts/Utilities/Definitions.hpp"
+#include "Acts/Utilities/Instrumentation.hpp"
 #include "Acts/Utilities/Result.hpp"
 #include "Acts/Vertexing/GaussianTrackDensity.hpp"
 #include "Acts/Vertexing/Vertex.hpp"
 #include "Acts/Vertexing/VertexFitterConcept.hpp"
 #include "Acts/Vertexing/VertexingOptions.hpp"
 
+#include <unordered_map>
+#include <unordered_set>
+
 namespace Acts {
 
 /// @class TrackDensityVertexFinder
@@ -48,6 +52,18 @@ class TrackDensityVertexFinder {
     track_density_t trackDensityEstimator;
   };
 
+  /// @brief The State struct
+  ///
+  /// Keeps the track density between calls, e.g. for iterative seeding on
+  /// a shrinking set of tracks.
+  struct State {
+    // The track density state
+    typename track_density_t::State densityState;
+
+    // Parameters of the tracks in the density
+    std::unordered_map<const InputTrack_t*, BoundParameters> tracks;
+  };
+
   /// @brief Function that finds single vertex candidate
   ///
   /// @param trackVector Input track collection
@@ -59,6 +75,23 @@ class TrackDensityVertexFinder {
       const std::vector<const InputTrack_t*>& trackVector,
       const VertexingOptions<InputTrack_t>& vertexingOptions) const;
 
+  /// @brief Function that finds single vertex candidate, reusing the
+  /// density of a previous call
+  ///
+  /// Only the tracks which were added to or removed from the input
+  /// collection since the last call with the same state change the density.
+  ///
+  /// @param trackVector Input track collection
+  /// @param vertexingOptions Vertexing options
+  /// @param state The finder state
+  ///
+  /// @return Vector of vertices, filled with a single
+  ///         vertex (for consistent interfaces)
+  Result<std::vector<Vertex<InputTrack_t>>> find(
+      const std::vector<const InputTrack_t*>& trackVector,
+      const VertexingOptions<InputTrack_t>& vertexingOptions,
+      State& state) const;
+
   /// @brief Constructor used if InputTrack_t type == BoundParameters
   ///
   /// @param cfg Configuration object
@@ -99,6 +132,16 @@ class TrackDensityVertexFinder {
   ///
   /// @param InputTrack_t object to extract track parameters from
   std::function<BoundParameters(InputTrack_t)> m_extractParameters;
+
+  /// @brief Creates the seed vertex from the density maximum
+  ///
+  /// @param zAndWidth Position and width of the density maximum
+  /// @param vertexingOptions Vertexing options
+  ///
+  /// @return Vector of vertices, filled with the seed vertex
+  Result<std::vector<Vertex<InputTrack_t>>> makeSeed(
+      const std::pair<double, double>& zAndWidth,
+      const VertexingOptions<InputTrack_t>& vertexingOptions) const;
 };
 
 }  // namespace Acts
@@ -11,6 +11,7 @@ auto Acts::TrackDensityVertexFinder<vfitter_t, track_density_t>::find(
     const std::vector<const InputTrack_t*>& trackVector,
     const VertexingOptions<InputTrack_t>& vertexingOptions) const
     -> Result<std::vector<Vertex<InputTrack_t>>> {
+  ACTS_INSTRUMENT_SCOPE("TrackDensityVertexFinder::find");
   typename track_density_t::State densityState;
 
   std::vector<BoundParameters> trackList;
@@ -25,6 +26,47 @@ auto Acts::TrackDensityVertexFinder<vfitter_t, track_density_t>::find(
       m_cfg.trackDensityEstimator.globalMaximumWithWidth(trackList,
                                                          densityState);
 
+  return makeSeed(zAndWidth, vertexingOptions);
+}
+
+template <typename vfitter_t, typename track_density_t>
+auto Acts::TrackDensityVertexFinder<vfitter_t, track_density_t>::find(
+    const std::vector<const InputTrack_t*>& trackVector,
+    const VertexingOptions<InputTrack_t>& vertexingOptions, State& state) const
+    -> Result<std::vector<Vertex<InputTrack_t>>> {
+  ACTS_INSTRUMENT_SCOPE("TrackDensityVertexFinder::find");
+  // Remove the tracks which are not in the input anymore
+  std::unordered_set<const InputTrack_t*> isInput(trackVector.begin(),
+                                                  trackVector.end());
+  for (auto it = state.tracks.begin(); it != state.tracks.end();) {
+    if (isInput.count(it->first) == 0) {
+      m_cfg.trackDensityEstimator.removeTrack(it->second, state.densityState);
+      it = state.tracks.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  // Add the new ones
+  for (const auto& trk : trackVector) {
+    if (state.tracks.count(trk) == 0) {
+      const auto& params =
+          state.tracks.emplace(trk, m_extractParameters(*trk)).first->second;
+      m_cfg.trackDensityEstimator.addTrack(params, state.densityState);
+    }
+  }
+
+  // Calculate z seed position
+  std::pair<double, double> zAndWidth =
+      m_cfg.trackDensityEstimator.globalMaximumWithWidth(state.densityState);
+
+  return makeSeed(zAndWidth, vertexingOptions);
+}
+
+template <typename vfitter_t, typename track_density_t>
+auto Acts::TrackDensityVertexFinder<vfitter_t, track_density_t>::makeSeed(
+    const std::pair<double, double>& zAndWidth,
+    const VertexingOptions<InputTrack_t>& vertexingOptions) const
+    -> Result<std::vector<Vertex<InputTrack_t>>> {
   double z = zAndWidth.first;
 
   // Calculate seed position
@@ -21,6 +21,9 @@ namespace concept {
 
   METHOD_TRAIT(find_t, find);
 
+  template <typename S>
+  using state_t = typename S::State;
+
   // clang-format off
     template <typename S>
       struct VertexFinderConcept {
@@ -40,4 +43,21 @@ template <typename finder>
 constexpr bool VertexFinderConcept =
     Acts::concept ::VertexFinder::VertexFinderConcept<finder>::value;
 
+namespace detail {
+/// Placeholder for vertex finders without state
+struct NoVertexFinderState {};
+}  // namespace detail
+
+/// Whether the vertex finder has a state which can be kept between calls
+template <typename finder>
+constexpr bool VertexFinderHasState =
+    Acts::concept ::exists<Acts::concept ::VertexFinder::state_t, finder>;
+
+/// The state type of the vertex finder, a placeholder if it has none
+template <typename finder>
+using VertexFinderState_t =
+    typename Acts::concept ::detected_or<detail::NoVertexFinderState,
+                                         Acts::concept ::VertexFinder::state_t,
+                                         finder>::type;
+
 }  // namespace Acts
\ No newline at end of file
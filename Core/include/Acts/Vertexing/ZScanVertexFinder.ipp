@@ -11,6 +11,7 @@ auto Acts::ZScanVertexFinder<vfitter_t>::find(
     const std::vector<const InputTrack_t*>& trackVector,
     const VertexingOptions<InputTrack_t>& vertexingOptions) const
     -> Result<std::vector<Vertex<InputTrack_t>>> {
+  ACTS_INSTRUMENT_SCOPE("ZScanVertexFinder::find");
   // Determine if we use constraint or not
   bool useConstraint = false;
   if (vertexingOptions.vertexConstraint.fullCovariance().determinant() != 0) {
@@ -48,6 +48,34 @@ std::shared_ptr<Acts::TrackingVolume>
 Acts::CylinderVolumeBuilder::trackingVolume(
     const GeometryContext& gctx, TrackingVolumePtr existingVolume,
     VolumeBoundsPtr externalBounds) const {
+  return trackingVolume(gctx, buildContent(gctx), std::move(existingVolume),
+                        std::move(externalBounds));
+}
+
+Acts::CylinderVolumeBuilder::VolumeContent
+Acts::CylinderVolumeBuilder::buildContent(const GeometryContext& gctx) const {
+  VolumeContent content;
+  // the layers are built by the layer builder
+  if (m_cfg.layerBuilder) {
+    // the negative Layers
+    content.negativeLayers = m_cfg.layerBuilder->negativeLayers(gctx);
+    // the central Layers
+    content.centralLayers = m_cfg.layerBuilder->centralLayers(gctx);
+    // the positive Layer
+    content.positiveLayers = m_cfg.layerBuilder->positiveLayers(gctx);
+  }
+
+  // Build the confined volumes
+  if (m_cfg.ctVolumeBuilder) {
+    content.centralVolumes = m_cfg.ctVolumeBuilder->centralVolumes();
+  }
+  return content;
+}
+
+std::shared_ptr<Acts::TrackingVolume>
+Acts::CylinderVolumeBuilder::trackingVolume(
+    const GeometryContext& gctx, VolumeContent content,
+    TrackingVolumePtr existingVolume, VolumeBoundsPtr externalBounds) const {
   ACTS_DEBUG("Configured to build volume : " << m_cfg.volumeName);
   if (existingVolume) {
     ACTS_DEBUG("- will wrap/enclose : " << existingVolume->volumeName());
@@ -59,29 +87,14 @@ Acts::CylinderVolumeBuilder::trackingVolume(
 
   // now analyize the layers that are provided
   // -----------------------------------------------------
-  LayerVector negativeLayers;
-  LayerVector centralLayers;
-  LayerVector positiveLayers;
+  const LayerVector& negativeLayers = content.negativeLayers;
+  const LayerVector& centralLayers = content.centralLayers;
+  const LayerVector& positiveLayers = content.positiveLayers;
+  const MutableTrackingVolumeVector& centralVolumes = content.centralVolumes;
 
   // the wrapping configuration
   WrappingConfig wConfig;
 
-  // the layers are built by the layer builder
-  if (m_cfg.layerBuilder) {
-    // the negative Layers
-    negativeLayers = m_cfg.layerBuilder->negativeLayers(gctx);
-    // the central Layers
-    centralLayers = m_cfg.layerBuilder->centralLayers(gctx);
-    // the positive Layer
-    positiveLayers = m_cfg.layerBuilder->positiveLayers(gctx);
-  }
-
-  // Build the confined volumes
-  MutableTrackingVolumeVector centralVolumes;
-  if (m_cfg.ctVolumeBuilder) {
-    centralVolumes = m_cfg.ctVolumeBuilder->centralVolumes();
-  }
-
   // (0) PREP WORK ------------------------------------------------
   //
   // a) volume config of the existing volume
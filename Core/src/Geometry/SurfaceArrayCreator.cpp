@@ -53,21 +53,13 @@ Acts::SurfaceArrayCreator::surfaceArrayOnCylinder(
 
   double R = protoLayer.maxR - protoLayer.minR;
 
-  Transform3D itransform = transform.inverse();
-  // transform lambda captures the transform matrix
-  auto globalToLocal = [transform](const Vector3D& pos) {
-    Vector3D loc = transform * pos;
-    return Vector2D(phi(loc), loc.z());
-  };
-  auto localToGlobal = [itransform, R](const Vector2D& loc) {
-    return itransform *
-           Vector3D(R * std::cos(loc[0]), R * std::sin(loc[0]), loc[1]);
-  };
+  // the grid transform policy captures the transform matrix
+  detail::CylinderGridTransform gridTransform(transform, R);
 
   std::unique_ptr<SurfaceArray::ISurfaceGridLookup> sl =
       makeSurfaceGridLookup2D<detail::AxisBoundaryType::Closed,
                               detail::AxisBoundaryType::Bound>(
-          globalToLocal, localToGlobal, pAxisPhi, pAxisZ);
+          gridTransform, pAxisPhi, pAxisZ);
 
   sl->fill(gctx, surfacesRaw);
   completeBinning(gctx, *sl, surfacesRaw);
@@ -110,20 +102,13 @@ Acts::SurfaceArrayCreator::surfaceArrayOnCylinder(
     pAxisZ = createVariableAxis(gctx, surfacesRaw, binZ, protoLayer, transform);
   }
 
-  Transform3D itransform = transform.inverse();
-  auto globalToLocal = [transform](const Vector3D& pos) {
-    Vector3D loc = transform * pos;
-    return Vector2D(phi(loc), loc.z());
-  };
-  auto localToGlobal = [itransform, R](const Vector2D& loc) {
-    return itransform *
-           Vector3D(R * std::cos(loc[0]), R * std::sin(loc[0]), loc[1]);
-  };
+  // the grid transform policy captures the transform matrix
+  detail::CylinderGridTransform gridTransform(transform, R);
 
   std::unique_ptr<SurfaceArray::ISurfaceGridLookup> sl =
       makeSurfaceGridLookup2D<detail::AxisBoundaryType::Closed,
                               detail::AxisBoundaryType::Bound>(
-          globalToLocal, localToGlobal, pAxisPhi, pAxisZ);
+          gridTransform, pAxisPhi, pAxisZ);
 
   sl->fill(gctx, surfacesRaw);
   completeBinning(gctx, *sl, surfacesRaw);
@@ -167,21 +152,13 @@ Acts::SurfaceArrayCreator::surfaceArrayOnDisc(
   double Z = 0.5 * (protoLayer.minZ + protoLayer.maxZ);
   ACTS_VERBOSE("- z-position of disk estimated as " << Z);
 
-  Transform3D itransform = transform.inverse();
-  // transform lambda captures the transform matrix
-  auto globalToLocal = [transform](const Vector3D& pos) {
-    Vector3D loc = transform * pos;
-    return Vector2D(perp(loc), phi(loc));
-  };
-  auto localToGlobal = [itransform, Z](const Vector2D& loc) {
-    return itransform *
-           Vector3D(loc[0] * std::cos(loc[1]), loc[0] * std::sin(loc[1]), Z);
-  };
+  // the grid transform policy captures the transform matrix
+  detail::DiscGridTransform gridTransform(transform, Z);
 
   std::unique_ptr<SurfaceArray::ISurfaceGridLookup> sl =
       makeSurfaceGridLookup2D<detail::AxisBoundaryType::Bound,
                               detail::AxisBoundaryType::Closed>(
-          globalToLocal, localToGlobal, pAxisR, pAxisPhi);
+          gridTransform, pAxisR, pAxisPhi);
 
   // get the number of bins
   auto axes = sl->getAxes();
@@ -274,21 +251,13 @@ Acts::SurfaceArrayCreator::surfaceArrayOnDisc(
   double Z = 0.5 * (protoLayer.minZ + protoLayer.maxZ);
   ACTS_VERBOSE("- z-position of disk estimated as " << Z);
 
-  Transform3D itransform = transform.inverse();
-  // transform lambda captures the transform matrix
-  auto globalToLocal = [transform](const Vector3D& pos) {
-    Vector3D loc = transform * pos;
-    return Vector2D(perp(loc), phi(loc));
-  };
-  auto localToGlobal = [itransform, Z](const Vector2D& loc) {
-    return itransform *
-           Vector3D(loc[0] * std::cos(loc[1]), loc[0] * std::sin(loc[1]), Z);
-  };
+  // the grid transform policy captures the transform matrix
+  detail::DiscGridTransform gridTransform(transform, Z);
 
   std::unique_ptr<SurfaceArray::ISurfaceGridLookup> sl =
       makeSurfaceGridLookup2D<detail::AxisBoundaryType::Bound,
                               detail::AxisBoundaryType::Closed>(
-          globalToLocal, localToGlobal, pAxisR, pAxisPhi);
+          gridTransform, pAxisR, pAxisPhi);
 
   // get the number of bins
   auto axes = sl->getAxes();
@@ -327,15 +296,8 @@ Acts::SurfaceArrayCreator::surfaceArrayOnPlane(
   Transform3D transform =
       transformOpt != nullptr ? *transformOpt : Transform3D::Identity();
 
-  Transform3D itransform = transform.inverse();
-  // transform lambda captures the transform matrix
-  auto globalToLocal = [transform](const Vector3D& pos) {
-    Vector3D loc = transform * pos;
-    return Vector2D(loc.x(), loc.y());
-  };
-  auto localToGlobal = [itransform](const Vector2D& loc) {
-    return itransform * Vector3D(loc.x(), loc.y(), 0.);
-  };
+  // the grid transform policy captures the transform matrix
+  detail::PlaneGridTransform gridTransform(transform);
   // Build the grid
   std::unique_ptr<SurfaceArray::ISurfaceGridLookup> sl;
 
@@ -348,7 +310,7 @@ Acts::SurfaceArrayCreator::surfaceArrayOnPlane(
                                                protoLayer, transform, bins2);
       sl = makeSurfaceGridLookup2D<detail::AxisBoundaryType::Bound,
                                    detail::AxisBoundaryType::Bound>(
-          globalToLocal, localToGlobal, pAxis1, pAxis2);
+          gridTransform, pAxis1, pAxis2);
       break;
     }
     case BinningValue::binY: {
@@ -358,7 +320,7 @@ Acts::SurfaceArrayCreator::surfaceArrayOnPlane(
                                                protoLayer, transform, bins2);
       sl = makeSurfaceGridLookup2D<detail::AxisBoundaryType::Bound,
                                    detail::AxisBoundaryType::Bound>(
-          globalToLocal, localToGlobal, pAxis1, pAxis2);
+          gridTransform, pAxis1, pAxis2);
       break;
     }
     case BinningValue::binZ: {
@@ -368,7 +330,7 @@ Acts::SurfaceArrayCreator::surfaceArrayOnPlane(
                                                protoLayer, transform, bins2);
       sl = makeSurfaceGridLookup2D<detail::AxisBoundaryType::Bound,
                                    detail::AxisBoundaryType::Bound>(
-          globalToLocal, localToGlobal, pAxis1, pAxis2);
+          gridTransform, pAxis1, pAxis2);
       break;
     }
     default: {
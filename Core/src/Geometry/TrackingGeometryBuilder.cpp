@@ -11,6 +11,7 @@
 ///////////////////////////////////////////////////////////////////
 
 #include <functional>
+#include <stdexcept>
 
 #include "Acts/Geometry/CylinderVolumeBounds.hpp"
 #include "Acts/Geometry/ITrackingVolumeBuilder.hpp"
@@ -28,7 +29,12 @@ Acts::TrackingGeometryBuilder::TrackingGeometryBuilder(
 
 void Acts::TrackingGeometryBuilder::setConfiguration(
     const Acts::TrackingGeometryBuilder::Config& cgbConfig) {
-  // @todo check consistency
+  if (not cgbConfig.trackingVolumeBuilders.empty() and
+      not cgbConfig.stagedVolumeBuilders.empty()) {
+    throw std::invalid_argument(
+        "Only one of trackingVolumeBuilders and stagedVolumeBuilders can be "
+        "set");
+  }
   // copy the configuration
   m_cfg = cgbConfig;
 }
@@ -44,9 +50,26 @@ Acts::TrackingGeometryBuilder::trackingGeometry(
   // the return geometry with the highest volume
   std::unique_ptr<const TrackingGeometry> trackingGeometry;
   MutableTrackingVolumePtr highestVolume = nullptr;
+  // run the first stage of the staged builders, they are independent
+  // -----------------------------
+  std::vector<VolumeBuilder> stagedBuilders(m_cfg.stagedVolumeBuilders.size());
+  auto buildStage = [&](size_t ib) {
+    stagedBuilders[ib] = m_cfg.stagedVolumeBuilders[ib](gctx);
+  };
+  if (m_cfg.taskPool) {
+    m_cfg.taskPool->parallelFor(stagedBuilders.size(), buildStage);
+  } else {
+    for (size_t ib = 0; ib < stagedBuilders.size(); ++ib) {
+      buildStage(ib);
+    }
+  }
+  const auto& volumeBuilders = m_cfg.stagedVolumeBuilders.empty()
+                                   ? m_cfg.trackingVolumeBuilders
+                                   : stagedBuilders;
+
   // loop over the builders and wrap one around the other
   // -----------------------------
-  for (auto& volumeBuilder : m_cfg.trackingVolumeBuilders) {
+  for (auto& volumeBuilder : volumeBuilders) {
     // assign a new highest volume (and potentially wrap around the given
     // highest volume so far)
     highestVolume = volumeBuilder(gctx, highestVolume, nullptr);
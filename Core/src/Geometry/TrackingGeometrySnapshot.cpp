@@ -0,0 +1,1172 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Geometry/TrackingGeometrySnapshot.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Acts/Geometry/BoundarySurfaceT.hpp"
+#include "Acts/Geometry/CuboidVolumeBounds.hpp"
+#include "Acts/Geometry/CutoutCylinderVolumeBounds.hpp"
+#include "Acts/Geometry/CylinderLayer.hpp"
+#include "Acts/Geometry/CylinderVolumeBounds.hpp"
+#include "Acts/Geometry/DiscLayer.hpp"
+#include "Acts/Geometry/GenericApproachDescriptor.hpp"
+#include "Acts/Geometry/GenericCuboidVolumeBounds.hpp"
+#include "Acts/Geometry/NavigationLayer.hpp"
+#include "Acts/Geometry/PlaneLayer.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Geometry/TrackingVolume.hpp"
+#include "Acts/Geometry/TrapezoidVolumeBounds.hpp"
+#include "Acts/Material/HomogeneousSurfaceMaterial.hpp"
+#include "Acts/Material/HomogeneousVolumeMaterial.hpp"
+#include "Acts/Material/IMaterialDecorator.hpp"
+#include "Acts/Material/ProtoSurfaceMaterial.hpp"
+#include "Acts/Surfaces/AnnulusBounds.hpp"
+#include "Acts/Surfaces/ConeBounds.hpp"
+#include "Acts/Surfaces/ConeSurface.hpp"
+#include "Acts/Surfaces/CylinderBounds.hpp"
+#include "Acts/Surfaces/CylinderSurface.hpp"
+#include "Acts/Surfaces/DiamondBounds.hpp"
+#include "Acts/Surfaces/DiscSurface.hpp"
+#include "Acts/Surfaces/DiscTrapezoidBounds.hpp"
+#include "Acts/Surfaces/EllipseBounds.hpp"
+#include "Acts/Surfaces/LineBounds.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/RadialBounds.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Surfaces/StrawSurface.hpp"
+#include "Acts/Surfaces/SurfaceArray.hpp"
+#include "Acts/Surfaces/TrapezoidBounds.hpp"
+#include "Acts/Utilities/BinUtility.hpp"
+#include "Acts/Utilities/BinnedArrayXD.hpp"
+#include "Acts/Utilities/Helpers.hpp"
+#include "Acts/Utilities/detail/Axis.hpp"
+
+using Acts::VectorHelpers::perp;
+
+namespace {
+
+using BoundarySurface = Acts::BoundarySurfaceT<Acts::TrackingVolume>;
+
+constexpr std::array<char, 8> s_magic = {'A', 'C', 'T', 'S',
+                                         'G', 'E', 'O', '\0'};
+constexpr uint32_t s_version = 1;
+// magic, version, reserved
+constexpr size_t s_headerSize = 8 + 4 + 4;
+// marks empty bins of a binned array
+constexpr uint32_t s_noIndex = std::numeric_limits<uint32_t>::max();
+
+/// Type of a stored layer, determines the surface array layout
+enum class LayerKind : uint8_t {
+  Navigation = 0,
+  Cylinder = 1,
+  Disc = 2,
+  Plane = 3
+};
+
+/// Type of a stored surface array
+enum class ArrayKind : uint8_t { None = 0, Single = 1, Grid = 2 };
+
+/// Type of stored surface or volume material
+enum class MaterialKind : uint8_t { None = 0, Proto = 1, Homogeneous = 2 };
+
+/// Type of a stored boundary surface attachment
+enum class AttachmentKind : uint8_t { None = 0, Volume = 1, Array = 2 };
+
+/// Append the binary representation of a trivial value to a buffer
+template <typename T>
+void append(std::vector<char>& buffer, const T& value) {
+  const char* bytes = reinterpret_cast<const char*>(&value);
+  buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+/// Append the 3x4 block of an affine transform to a buffer
+void appendTransform(std::vector<char>& buffer,
+                     const Acts::Transform3D& transform) {
+  for (size_t ic = 0; ic < 4; ++ic) {
+    for (size_t ir = 0; ir < 3; ++ir) {
+      append<double>(buffer, transform.matrix()(ir, ic));
+    }
+  }
+}
+
+/// Append a vector of bound values to a buffer
+void appendValues(std::vector<char>& buffer,
+                  const std::vector<double>& values) {
+  append<uint32_t>(buffer, values.size());
+  for (double value : values) {
+    append(buffer, value);
+  }
+}
+
+/// Append a string to a buffer
+void appendString(std::vector<char>& buffer, const std::string& value) {
+  append<uint32_t>(buffer, value.size());
+  buffer.insert(buffer.end(), value.begin(), value.end());
+}
+
+/// Append an (optional) bin utility to a buffer
+void appendBinUtility(std::vector<char>& buffer, const Acts::BinUtility* bu) {
+  append<uint8_t>(buffer, bu != nullptr);
+  if (bu == nullptr) {
+    return;
+  }
+  append<uint8_t>(buffer, bu->dimensions());
+  for (const auto& bData : bu->binningData()) {
+    if (bData.subBinningData) {
+      throw std::invalid_argument(
+          "Binning with sub structure is not supported by the snapshot");
+    }
+    append<uint8_t>(buffer, bData.type);
+    append<uint8_t>(buffer, bData.option);
+    append<uint8_t>(buffer, bData.binvalue);
+    if (bData.type == Acts::equidistant) {
+      append<uint32_t>(buffer, bData.bins());
+      append<float>(buffer, bData.min);
+      append<float>(buffer, bData.max);
+    } else {
+      const auto& boundaries = bData.boundaries();
+      append<uint32_t>(buffer, boundaries.size());
+      for (float boundary : boundaries) {
+        append(buffer, boundary);
+      }
+    }
+  }
+  append<uint8_t>(buffer, bu->transform() != nullptr);
+  if (bu->transform()) {
+    appendTransform(buffer, *bu->transform());
+  }
+}
+
+/// Append the content of a binned array to a buffer
+///
+/// The objects are stored by the indices returned from the index function,
+/// together with the order of the unique objects.
+template <typename T, typename index_function_t>
+void appendBinnedArray(std::vector<char>& buffer,
+                       const Acts::BinnedArray<T>& array,
+                       index_function_t index) {
+  appendBinUtility(buffer, array.binUtility());
+  const auto& grid = array.objectGrid();
+  append<uint32_t>(buffer, grid.size());
+  append<uint32_t>(buffer, grid.empty() ? 0 : grid.front().size());
+  append<uint32_t>(buffer, grid.empty() or grid.front().empty()
+                               ? 0
+                               : grid.front().front().size());
+  for (const auto& objects2 : grid) {
+    for (const auto& objects1 : objects2) {
+      for (const auto& object : objects1) {
+        append<uint32_t>(buffer, object ? index(*object) : s_noIndex);
+      }
+    }
+  }
+  const auto& arrayObjects = array.arrayObjects();
+  append<uint32_t>(buffer, arrayObjects.size());
+  for (const auto& object : arrayObjects) {
+    append<uint32_t>(buffer, index(*object));
+  }
+}
+
+/// Check that the surface bounds can be recreated from the snapshot
+bool isSupported(Acts::SurfaceBounds::BoundsType type) {
+  switch (type) {
+    case Acts::SurfaceBounds::eCone:
+    case Acts::SurfaceBounds::eCylinder:
+    case Acts::SurfaceBounds::eDiamond:
+    case Acts::SurfaceBounds::eDisc:
+    case Acts::SurfaceBounds::eEllipse:
+    case Acts::SurfaceBounds::eLine:
+    case Acts::SurfaceBounds::eRectangle:
+    case Acts::SurfaceBounds::eTrapezoid:
+    case Acts::SurfaceBounds::eDiscTrapezoid:
+    case Acts::SurfaceBounds::eAnnulus:
+    case Acts::SurfaceBounds::eBoundless:
+      return true;
+    default:
+      return false;
+  }
+}
+
+/// Check that the volume bounds can be recreated from the snapshot
+bool isSupported(Acts::VolumeBounds::BoundsType type) {
+  switch (type) {
+    case Acts::VolumeBounds::eCuboid:
+    case Acts::VolumeBounds::eCutoutCylinder:
+    case Acts::VolumeBounds::eCylinder:
+    case Acts::VolumeBounds::eGenericCuboid:
+    case Acts::VolumeBounds::eTrapezoid:
+      return true;
+    default:
+      return false;
+  }
+}
+
+/// Collects the objects of a closed geometry and writes their description
+class SnapshotWriter {
+ public:
+  SnapshotWriter(const Acts::GeometryContext& gctx) : m_gctx(gctx) {}
+
+  /// Write the full snapshot content into a buffer
+  std::vector<char> write(const Acts::TrackingVolume& world) {
+    // the volumes are indexed first, as the boundaries refer to them
+    collectVolumes(world);
+    for (const auto* volume : m_volumeList) {
+      appendVolume(*volume);
+    }
+    for (const auto* boundary : m_boundaryList) {
+      appendBoundary(*boundary);
+    }
+
+    std::vector<char> buffer;
+    buffer.reserve(s_headerSize + 16 + m_surfaces.size() + m_layers.size() +
+                   m_volumes.size() + m_boundaries.size());
+    buffer.insert(buffer.end(), s_magic.begin(), s_magic.end());
+    append<uint32_t>(buffer, s_version);
+    append<uint32_t>(buffer, 0);
+    append<uint32_t>(buffer, m_surfaceIndices.size());
+    buffer.insert(buffer.end(), m_surfaces.begin(), m_surfaces.end());
+    append<uint32_t>(buffer, m_layerIndices.size());
+    buffer.insert(buffer.end(), m_layers.begin(), m_layers.end());
+    append<uint32_t>(buffer, m_volumeList.size());
+    buffer.insert(buffer.end(), m_volumes.begin(), m_volumes.end());
+    append<uint32_t>(buffer, m_boundaryList.size());
+    buffer.insert(buffer.end(), m_boundaries.begin(), m_boundaries.end());
+    append<uint32_t>(buffer, volumeIndex(world));
+    return buffer;
+  }
+
+ private:
+  /// Index the volumes, the confined volumes before their mother
+  void collectVolumes(const Acts::TrackingVolume& volume) {
+    if (not volume.denseVolumes().empty() or
+        volume.hasBoundingVolumeHierarchy()) {
+      throw std::invalid_argument(
+          "Volume '" + volume.volumeName() +
+          "' has dense volumes or a bounding volume hierarchy, which are "
+          "not supported by the snapshot");
+    }
+    if (volume.confinedVolumes()) {
+      for (const auto& daughter : volume.confinedVolumes()->arrayObjects()) {
+        collectVolumes(*daughter);
+      }
+    }
+    m_volumeIndices.emplace(&volume, m_volumeList.size());
+    m_volumeList.push_back(&volume);
+  }
+
+  uint32_t volumeIndex(const Acts::TrackingVolume& volume) const {
+    auto it = m_volumeIndices.find(&volume);
+    if (it == m_volumeIndices.end()) {
+      throw std::invalid_argument("Volume '" + volume.volumeName() +
+                                  "' is not part of the tracking geometry");
+    }
+    return it->second;
+  }
+
+  uint32_t boundaryIndex(const BoundarySurface& boundary) {
+    auto it = m_boundaryIndices.find(&boundary);
+    if (it != m_boundaryIndices.end()) {
+      return it->second;
+    }
+    uint32_t index = m_boundaryList.size();
+    m_boundaryIndices.emplace(&boundary, index);
+    m_boundaryList.push_back(&boundary);
+    return index;
+  }
+
+  uint32_t surfaceIndex(const Acts::Surface& surface) {
+    auto it = m_surfaceIndices.find(&surface);
+    if (it != m_surfaceIndices.end()) {
+      return it->second;
+    }
+    uint32_t index = m_surfaceIndices.size();
+    m_surfaceIndices.emplace(&surface, index);
+    appendSurface(m_surfaces, surface);
+    return index;
+  }
+
+  uint32_t layerIndex(const Acts::Layer& layer) {
+    auto it = m_layerIndices.find(&layer);
+    if (it != m_layerIndices.end()) {
+      return it->second;
+    }
+    // the surfaces of the layer are added to the surface table on the way
+    std::vector<char> buffer;
+    appendLayer(buffer, layer);
+    uint32_t index = m_layerIndices.size();
+    m_layerIndices.emplace(&layer, index);
+    m_layers.insert(m_layers.end(), buffer.begin(), buffer.end());
+    return index;
+  }
+
+  void appendSurfaceMaterial(std::vector<char>& buffer,
+                             const Acts::ISurfaceMaterial* material) {
+    if (auto proto =
+            dynamic_cast<const Acts::ProtoSurfaceMaterial*>(material)) {
+      append(buffer, MaterialKind::Proto);
+      appendBinUtility(buffer, &proto->binUtility());
+    } else if (auto homogeneous =
+                   dynamic_cast<const Acts::HomogeneousSurfaceMaterial*>(
+                       material)) {
+      const auto& mp = homogeneous->materialProperties(Acts::Vector2D(0, 0));
+      append(buffer, MaterialKind::Homogeneous);
+      std::array<float, 6> parameters = {0, 0, 0, 0, 0, mp.thickness()};
+      if (mp) {
+        parameters = {mp.material().X0(), mp.material().L0(),
+                      mp.material().Ar(), mp.material().Z(),
+                      mp.material().massDensity(), mp.thickness()};
+      }
+      append(buffer, parameters);
+      append<double>(buffer,
+                     homogeneous->factor(Acts::forward, Acts::postUpdate));
+    } else {
+      // anything else is left to the material decorator
+      append(buffer, MaterialKind::None);
+    }
+  }
+
+  void appendSurface(std::vector<char>& buffer, const Acts::Surface& surface) {
+    const auto type = surface.type();
+    if (type == Acts::Surface::Perigee or type == Acts::Surface::Curvilinear or
+        type == Acts::Surface::Other) {
+      throw std::invalid_argument(
+          "Surface type is not supported by the snapshot");
+    }
+    const auto& bounds = surface.bounds();
+    if (not isSupported(bounds.type())) {
+      throw std::invalid_argument(
+          "Surface bounds type is not supported by the snapshot");
+    }
+    append<uint8_t>(buffer, type);
+    append<int32_t>(buffer, bounds.type());
+    appendValues(buffer, bounds.values());
+    appendTransform(buffer, surface.transform(m_gctx));
+    append<uint64_t>(buffer, surface.geoID().value());
+    appendSurfaceMaterial(buffer, surface.surfaceMaterial());
+  }
+
+  void appendSurfaceArray(std::vector<char>& buffer,
+                          const Acts::SurfaceArray* surfaceArray,
+                          LayerKind kind) {
+    if (surfaceArray == nullptr) {
+      append(buffer, ArrayKind::None);
+      return;
+    }
+    const auto& surfaces = surfaceArray->surfaces();
+    auto axes = surfaceArray->getAxes();
+    if (axes.empty()) {
+      append(buffer, ArrayKind::Single);
+      append<uint32_t>(buffer, surfaceIndex(*surfaces.front()));
+      return;
+    }
+    // the grid layout follows the one of the SurfaceArrayCreator
+    using Acts::detail::AxisBoundaryType;
+    std::array<AxisBoundaryType, 2> boundaryTypes = {AxisBoundaryType::Bound,
+                                                     AxisBoundaryType::Bound};
+    if (kind == LayerKind::Cylinder) {
+      boundaryTypes[0] = AxisBoundaryType::Closed;
+    } else if (kind == LayerKind::Disc) {
+      boundaryTypes[1] = AxisBoundaryType::Closed;
+    } else if (kind != LayerKind::Plane) {
+      throw std::invalid_argument(
+          "Navigation layers with a surface array are not supported by the "
+          "snapshot");
+    }
+    if (axes.size() != 2 or axes[0]->getBoundaryType() != boundaryTypes[0] or
+        axes[1]->getBoundaryType() != boundaryTypes[1]) {
+      throw std::invalid_argument(
+          "Surface array layout is not supported by the snapshot");
+    }
+
+    append(buffer, ArrayKind::Grid);
+    std::unordered_map<const Acts::Surface*, uint32_t> localIndices;
+    append<uint32_t>(buffer, surfaces.size());
+    for (const auto* surface : surfaces) {
+      localIndices.emplace(surface, localIndices.size());
+      append<uint32_t>(buffer, surfaceIndex(*surface));
+    }
+    const auto& transform = surfaceArray->transform();
+    appendTransform(buffer, transform);
+    // the reference radius or z position of the local to global transform
+    double reference = 0.;
+    for (size_t bin = 0; bin < surfaceArray->size(); ++bin) {
+      if (surfaceArray->isValidBin(bin)) {
+        Acts::Vector3D center = transform * surfaceArray->getBinCenter(bin);
+        reference = kind == LayerKind::Cylinder ? perp(center) : center.z();
+        break;
+      }
+    }
+    append(buffer, reference);
+    for (const auto* axis : axes) {
+      append<uint8_t>(buffer, axis->isEquidistant());
+      if (axis->isEquidistant()) {
+        append<double>(buffer, axis->getMin());
+        append<double>(buffer, axis->getMax());
+        append<uint32_t>(buffer, axis->getNBins());
+      } else {
+        appendValues(buffer, axis->getBinEdges());
+      }
+    }
+    // all bins, including the under- and overflow bins
+    append<uint32_t>(buffer, surfaceArray->size());
+    for (size_t bin = 0; bin < surfaceArray->size(); ++bin) {
+      const auto& binSurfaces = surfaceArray->at(bin);
+      append<uint32_t>(buffer, binSurfaces.size());
+      for (const auto* surface : binSurfaces) {
+        auto it = localIndices.find(surface);
+        if (it == localIndices.end()) {
+          throw std::invalid_argument(
+              "Surface array bin content is not part of the array surfaces");
+        }
+        append<uint32_t>(buffer, it->second);
+      }
+    }
+  }
+
+  void appendLayer(std::vector<char>& buffer, const Acts::Layer& layer) {
+    LayerKind kind = LayerKind::Navigation;
+    if (dynamic_cast<const Acts::CylinderLayer*>(&layer) != nullptr) {
+      kind = LayerKind::Cylinder;
+    } else if (dynamic_cast<const Acts::DiscLayer*>(&layer) != nullptr) {
+      kind = LayerKind::Disc;
+    } else if (dynamic_cast<const Acts::PlaneLayer*>(&layer) != nullptr) {
+      kind = LayerKind::Plane;
+    } else if (dynamic_cast<const Acts::NavigationLayer*>(&layer) ==
+               nullptr) {
+      throw std::invalid_argument("Layer type is not supported by the snapshot");
+    }
+    append(buffer, kind);
+    append<int8_t>(buffer, layer.layerType());
+    append<double>(buffer, layer.thickness());
+    append<uint64_t>(buffer, layer.geoID().value());
+    appendSurface(buffer, layer.surfaceRepresentation());
+    const auto* approachDescriptor = layer.approachDescriptor();
+    append<uint8_t>(buffer, approachDescriptor != nullptr);
+    if (approachDescriptor != nullptr) {
+      const auto& approachSurfaces = approachDescriptor->containedSurfaces();
+      append<uint32_t>(buffer, approachSurfaces.size());
+      for (const auto* surface : approachSurfaces) {
+        append<uint32_t>(buffer, surfaceIndex(*surface));
+      }
+    }
+    appendSurfaceArray(buffer, layer.surfaceArray(), kind);
+  }
+
+  void appendVolume(const Acts::TrackingVolume& volume) {
+    const auto& bounds = volume.volumeBounds();
+    if (not isSupported(bounds.type())) {
+      throw std::invalid_argument("Bounds of volume '" + volume.volumeName() +
+                                  "' are not supported by the snapshot");
+    }
+    std::vector<char>& buffer = m_volumes;
+    appendString(buffer, volume.volumeName());
+    appendTransform(buffer, volume.transform());
+    append<int32_t>(buffer, bounds.type());
+    appendValues(buffer, bounds.values());
+    append<uint64_t>(buffer, volume.geoID().value());
+    // anything but homogeneous material is left to the material decorator
+    auto material = dynamic_cast<const Acts::HomogeneousVolumeMaterial*>(
+        volume.volumeMaterial());
+    if (material != nullptr) {
+      const auto& m = material->material(Acts::Vector3D(0, 0, 0));
+      append(buffer, MaterialKind::Homogeneous);
+      append(buffer, std::array<float, 5>{m.X0(), m.L0(), m.Ar(), m.Z(),
+                                          m.massDensity()});
+    } else {
+      append(buffer, MaterialKind::None);
+    }
+    append<uint8_t>(buffer, volume.confinedLayers() != nullptr);
+    if (volume.confinedLayers() != nullptr) {
+      appendBinnedArray(buffer, *volume.confinedLayers(),
+                        [this](const Acts::Layer& l) { return layerIndex(l); });
+    }
+    append<uint8_t>(buffer, volume.confinedVolumes() != nullptr);
+    if (volume.confinedVolumes()) {
+      appendBinnedArray(
+          buffer, *volume.confinedVolumes(),
+          [this](const Acts::TrackingVolume& v) { return volumeIndex(v); });
+    }
+    const auto& boundaries = volume.boundarySurfaces();
+    append<uint32_t>(buffer, boundaries.size());
+    for (const auto& boundary : boundaries) {
+      append<uint32_t>(buffer, boundaryIndex(*boundary));
+    }
+  }
+
+  void appendBoundary(const BoundarySurface& boundary) {
+    std::vector<char>& buffer = m_boundaries;
+    append<uint32_t>(buffer, surfaceIndex(boundary.surfaceRepresentation()));
+    for (auto orientation : {Acts::insideVolume, Acts::outsideVolume}) {
+      auto volumeArray = boundary.attachedVolumeArray(orientation);
+      const auto* volume = boundary.attachedVolume(orientation);
+      if (volumeArray) {
+        append(buffer, AttachmentKind::Array);
+        appendBinnedArray(
+            buffer, *volumeArray,
+            [this](const Acts::TrackingVolume& v) { return volumeIndex(v); });
+      } else if (volume != nullptr) {
+        append(buffer, AttachmentKind::Volume);
+        append<uint32_t>(buffer, volumeIndex(*volume));
+      } else {
+        append(buffer, AttachmentKind::None);
+      }
+    }
+  }
+
+  const Acts::GeometryContext& m_gctx;
+
+  std::unordered_map<const Acts::Surface*, uint32_t> m_surfaceIndices;
+  std::unordered_map<const Acts::Layer*, uint32_t> m_layerIndices;
+  std::unordered_map<const Acts::TrackingVolume*, uint32_t> m_volumeIndices;
+  std::unordered_map<const BoundarySurface*, uint32_t> m_boundaryIndices;
+  std::vector<const Acts::TrackingVolume*> m_volumeList;
+  std::vector<const BoundarySurface*> m_boundaryList;
+
+  std::vector<char> m_surfaces;
+  std::vector<char> m_layers;
+  std::vector<char> m_volumes;
+  std::vector<char> m_boundaries;
+};
+
+/// Create bounds of the given type from their stored values
+template <typename bounds_t>
+std::shared_ptr<const bounds_t> makeBounds(const std::vector<double>& values) {
+  std::array<double, bounds_t::eSize> bValues{};
+  if (values.size() != bValues.size()) {
+    throw std::runtime_error("Unexpected number of bound values in snapshot");
+  }
+  std::copy(values.begin(), values.end(), bValues.begin());
+  return std::make_shared<const bounds_t>(bValues);
+}
+
+/// Cast the generic bounds to the type the surface requires
+template <typename bounds_t>
+std::shared_ptr<const bounds_t> castBounds(
+    const std::shared_ptr<const Acts::SurfaceBounds>& bounds) {
+  if (bounds == nullptr) {
+    return nullptr;
+  }
+  auto typed = std::dynamic_pointer_cast<const bounds_t>(bounds);
+  if (typed == nullptr) {
+    throw std::runtime_error("Inconsistent surface bounds in snapshot");
+  }
+  return typed;
+}
+
+/// Description of a stored surface
+struct SurfaceDescription {
+  Acts::Surface::SurfaceType type = Acts::Surface::Other;
+  std::shared_ptr<const Acts::SurfaceBounds> bounds = nullptr;
+  std::shared_ptr<const Acts::Transform3D> transform = nullptr;
+  Acts::GeometryID geoID;
+  std::shared_ptr<const Acts::ISurfaceMaterial> material = nullptr;
+};
+
+/// Axis of a stored surface array grid
+struct AxisDescription {
+  bool equidistant = true;
+  double min = 0.;
+  double max = 0.;
+  size_t nBins = 0;
+  std::vector<double> edges;
+};
+
+/// Create the surface grid lookup for the given boundary types
+template <Acts::detail::AxisBoundaryType bdtA,
+          Acts::detail::AxisBoundaryType bdtB, typename transform_t>
+std::unique_ptr<Acts::SurfaceArray::ISurfaceGridLookup> makeGridLookup(
+    transform_t transform, const AxisDescription& descA,
+    const AxisDescription& descB) {
+  using namespace Acts::detail;
+  using ISGL = Acts::SurfaceArray::ISurfaceGridLookup;
+
+  auto make = [&](auto axisA, auto axisB) -> std::unique_ptr<ISGL> {
+    using SGL = Acts::SurfaceArray::TransformedSurfaceGridLookup<
+        transform_t, decltype(axisA), decltype(axisB)>;
+    return std::make_unique<SGL>(transform, std::make_tuple(axisA, axisB));
+  };
+  using EquidistantA = Axis<AxisType::Equidistant, bdtA>;
+  using EquidistantB = Axis<AxisType::Equidistant, bdtB>;
+  using VariableA = Axis<AxisType::Variable, bdtA>;
+  using VariableB = Axis<AxisType::Variable, bdtB>;
+  if (descA.equidistant and descB.equidistant) {
+    return make(EquidistantA(descA.min, descA.max, descA.nBins),
+                EquidistantB(descB.min, descB.max, descB.nBins));
+  } else if (descA.equidistant) {
+    return make(EquidistantA(descA.min, descA.max, descA.nBins),
+                VariableB(descB.edges));
+  } else if (descB.equidistant) {
+    return make(VariableA(descA.edges),
+                EquidistantB(descB.min, descB.max, descB.nBins));
+  }
+  return make(VariableA(descA.edges), VariableB(descB.edges));
+}
+
+/// Decodes the snapshot content and recreates the geometry objects
+class SnapshotReader {
+ public:
+  SnapshotReader(const char* data, size_t size, const Acts::Logger& logger)
+      : m_data(data), m_size(size), m_pos(s_headerSize), m_logger(logger) {}
+
+  std::unique_ptr<const Acts::TrackingGeometry> trackingGeometry(
+      const Acts::IMaterialDecorator* materialDecorator) {
+    m_surfaces.resize(read<uint32_t>());
+    for (auto& surface : m_surfaces) {
+      surface = createSurface(readSurface());
+    }
+    m_layers.resize(read<uint32_t>());
+    for (auto& layer : m_layers) {
+      layer = readLayer();
+    }
+    m_volumes.resize(read<uint32_t>());
+    std::vector<std::vector<uint32_t>> volumeBoundaries(m_volumes.size());
+    for (size_t iv = 0; iv < m_volumes.size(); ++iv) {
+      m_volumes[iv] = readVolume(volumeBoundaries[iv]);
+    }
+    m_boundaries.resize(read<uint32_t>());
+    for (auto& boundary : m_boundaries) {
+      boundary = readBoundary();
+    }
+    auto world = m_volumes.at(read<uint32_t>());
+    ACTS_VERBOSE("Decoded " << m_surfaces.size() << " surfaces, "
+                            << m_layers.size() << " layers, "
+                            << m_volumes.size() << " volumes and "
+                            << m_boundaries.size() << " boundaries");
+
+    // replace the boundaries of the volumes by the stored, glued ones
+    for (size_t iv = 0; iv < m_volumes.size(); ++iv) {
+      const auto& boundaries = volumeBoundaries[iv];
+      if (boundaries.size() != m_volumes[iv]->boundarySurfaces().size()) {
+        throw std::runtime_error("Inconsistent number of volume boundaries");
+      }
+      for (size_t ib = 0; ib < boundaries.size(); ++ib) {
+        m_volumes[iv]->updateBoundarySurface(
+            static_cast<Acts::BoundarySurfaceFace>(ib),
+            m_boundaries.at(boundaries[ib]), false);
+      }
+    }
+
+    // closing the geometry assigns the identifiers again
+    auto trackingGeometry =
+        std::make_unique<const Acts::TrackingGeometry>(world, materialDecorator);
+    for (const auto& [object, geoID] : m_geoIDs) {
+      if (not(object->geoID() == geoID)) {
+        throw std::runtime_error("GeometryID mismatch in recreated geometry");
+      }
+    }
+    return trackingGeometry;
+  }
+
+ private:
+  const Acts::Logger& logger() const { return m_logger; }
+
+  template <typename T>
+  T read() {
+    if (m_pos + sizeof(T) > m_size) {
+      throw std::runtime_error("Truncated tracking geometry snapshot");
+    }
+    T value;
+    std::memcpy(&value, m_data + m_pos, sizeof(T));
+    m_pos += sizeof(T);
+    return value;
+  }
+
+  std::shared_ptr<const Acts::Transform3D> readTransform() {
+    Acts::Transform3D transform = Acts::Transform3D::Identity();
+    for (size_t ic = 0; ic < 4; ++ic) {
+      for (size_t ir = 0; ir < 3; ++ir) {
+        transform.matrix()(ir, ic) = read<double>();
+      }
+    }
+    return std::make_shared<const Acts::Transform3D>(transform);
+  }
+
+  std::vector<double> readValues() {
+    std::vector<double> values(read<uint32_t>());
+    for (auto& value : values) {
+      value = read<double>();
+    }
+    return values;
+  }
+
+  std::string readString() {
+    size_t length = read<uint32_t>();
+    if (m_pos + length > m_size) {
+      throw std::runtime_error("Truncated tracking geometry snapshot");
+    }
+    std::string value(m_data + m_pos, length);
+    m_pos += length;
+    return value;
+  }
+
+  std::unique_ptr<const Acts::BinUtility> readBinUtility() {
+    if (read<uint8_t>() == 0) {
+      return nullptr;
+    }
+    std::vector<Acts::BinningData> binningData;
+    size_t nDimensions = read<uint8_t>();
+    for (size_t id = 0; id < nDimensions; ++id) {
+      auto type = static_cast<Acts::BinningType>(read<uint8_t>());
+      auto option = static_cast<Acts::BinningOption>(read<uint8_t>());
+      auto value = static_cast<Acts::BinningValue>(read<uint8_t>());
+      if (type == Acts::equidistant) {
+        size_t bins = read<uint32_t>();
+        float min = read<float>();
+        float max = read<float>();
+        binningData.emplace_back(option, value, bins, min, max);
+      } else {
+        std::vector<float> boundaries(read<uint32_t>());
+        for (auto& boundary : boundaries) {
+          boundary = read<float>();
+        }
+        binningData.emplace_back(option, value, boundaries);
+      }
+    }
+    std::shared_ptr<const Acts::Transform3D> transform = nullptr;
+    if (read<uint8_t>() != 0) {
+      transform = readTransform();
+    }
+    if (binningData.empty()) {
+      throw std::runtime_error("Empty binning in snapshot");
+    }
+    auto bu = std::make_unique<Acts::BinUtility>(binningData[0], transform);
+    for (size_t id = 1; id < binningData.size(); ++id) {
+      (*bu) += Acts::BinUtility(binningData[id]);
+    }
+    return bu;
+  }
+
+  template <typename T, typename objects_t>
+  std::unique_ptr<Acts::BinnedArrayXD<T>> readBinnedArray(
+      const objects_t& objects) {
+    auto bu = readBinUtility();
+    size_t n2 = read<uint32_t>();
+    size_t n1 = read<uint32_t>();
+    size_t n0 = read<uint32_t>();
+    std::vector<std::vector<std::vector<T>>> grid(
+        n2, std::vector<std::vector<T>>(n1, std::vector<T>(n0, nullptr)));
+    for (auto& objects2 : grid) {
+      for (auto& objects1 : objects2) {
+        for (auto& object : objects1) {
+          uint32_t index = read<uint32_t>();
+          if (index != s_noIndex) {
+            object = objects.at(index);
+          }
+        }
+      }
+    }
+    std::vector<T> arrayObjects(read<uint32_t>());
+    for (auto& object : arrayObjects) {
+      object = objects.at(read<uint32_t>());
+    }
+    return std::make_unique<Acts::BinnedArrayXD<T>>(
+        grid, std::move(arrayObjects), std::move(bu));
+  }
+
+  std::shared_ptr<const Acts::ISurfaceMaterial> readSurfaceMaterial() {
+    auto kind = read<MaterialKind>();
+    if (kind == MaterialKind::Proto) {
+      auto bu = readBinUtility();
+      if (bu == nullptr) {
+        throw std::runtime_error("Proto material without binning in snapshot");
+      }
+      return std::make_shared<const Acts::ProtoSurfaceMaterial>(*bu);
+    } else if (kind == MaterialKind::Homogeneous) {
+      auto parameters = read<std::array<float, 6>>();
+      double splitFactor = read<double>();
+      Acts::MaterialProperties mp(parameters[5]);
+      if (parameters[0] > 0.) {
+        mp = Acts::MaterialProperties(parameters[0], parameters[1],
+                                      parameters[2], parameters[3],
+                                      parameters[4], parameters[5]);
+      }
+      return std::make_shared<const Acts::HomogeneousSurfaceMaterial>(
+          mp, splitFactor);
+    }
+    return nullptr;
+  }
+
+  std::shared_ptr<const Acts::SurfaceBounds> readSurfaceBounds() {
+    using Acts::SurfaceBounds;
+    auto type = static_cast<SurfaceBounds::BoundsType>(read<int32_t>());
+    auto values = readValues();
+    switch (type) {
+      case SurfaceBounds::eCone:
+        return makeBounds<Acts::ConeBounds>(values);
+      case SurfaceBounds::eCylinder:
+        return makeBounds<Acts::CylinderBounds>(values);
+      case SurfaceBounds::eDiamond:
+        return makeBounds<Acts::DiamondBounds>(values);
+      case SurfaceBounds::eDisc:
+        return makeBounds<Acts::RadialBounds>(values);
+      case SurfaceBounds::eEllipse:
+        return makeBounds<Acts::EllipseBounds>(values);
+      case SurfaceBounds::eLine:
+        return makeBounds<Acts::LineBounds>(values);
+      case SurfaceBounds::eRectangle:
+        return makeBounds<Acts::RectangleBounds>(values);
+      case SurfaceBounds::eTrapezoid:
+        return makeBounds<Acts::TrapezoidBounds>(values);
+      case SurfaceBounds::eDiscTrapezoid:
+        return makeBounds<Acts::DiscTrapezoidBounds>(values);
+      case SurfaceBounds::eAnnulus:
+        return makeBounds<Acts::AnnulusBounds>(values);
+      case SurfaceBounds::eBoundless:
+        return nullptr;
+      default:
+        throw std::runtime_error("Unknown surface bounds type in snapshot");
+    }
+  }
+
+  std::shared_ptr<const Acts::VolumeBounds> readVolumeBounds() {
+    using Acts::VolumeBounds;
+    auto type = static_cast<VolumeBounds::BoundsType>(read<int32_t>());
+    auto values = readValues();
+    switch (type) {
+      case VolumeBounds::eCuboid:
+        return makeBounds<Acts::CuboidVolumeBounds>(values);
+      case VolumeBounds::eCutoutCylinder:
+        return makeBounds<Acts::CutoutCylinderVolumeBounds>(values);
+      case VolumeBounds::eCylinder:
+        return makeBounds<Acts::CylinderVolumeBounds>(values);
+      case VolumeBounds::eGenericCuboid:
+        return makeBounds<Acts::GenericCuboidVolumeBounds>(values);
+      case VolumeBounds::eTrapezoid:
+        return makeBounds<Acts::TrapezoidVolumeBounds>(values);
+      default:
+        throw std::runtime_error("Unknown volume bounds type in snapshot");
+    }
+  }
+
+  SurfaceDescription readSurface() {
+    SurfaceDescription description;
+    description.type = static_cast<Acts::Surface::SurfaceType>(read<uint8_t>());
+    description.bounds = readSurfaceBounds();
+    description.transform = readTransform();
+    description.geoID = Acts::GeometryID(read<uint64_t>());
+    description.material = readSurfaceMaterial();
+    return description;
+  }
+
+  std::shared_ptr<Acts::Surface> createSurface(
+      const SurfaceDescription& description) {
+    using Acts::Surface;
+    const auto& transform = description.transform;
+    const auto& bounds = description.bounds;
+    std::shared_ptr<Surface> surface = nullptr;
+    switch (description.type) {
+      case Surface::Cone:
+        surface = Surface::makeShared<Acts::ConeSurface>(
+            transform, castBounds<Acts::ConeBounds>(bounds));
+        break;
+      case Surface::Cylinder:
+        surface = Surface::makeShared<Acts::CylinderSurface>(
+            transform, castBounds<Acts::CylinderBounds>(bounds));
+        break;
+      case Surface::Disc:
+        surface = Surface::makeShared<Acts::DiscSurface>(
+            transform, castBounds<Acts::DiscBounds>(bounds));
+        break;
+      case Surface::Plane:
+        surface = Surface::makeShared<Acts::PlaneSurface>(
+            transform, castBounds<Acts::PlanarBounds>(bounds));
+        break;
+      case Surface::Straw:
+        surface = Surface::makeShared<Acts::StrawSurface>(
+            transform, castBounds<Acts::LineBounds>(bounds));
+        break;
+      default:
+        throw std::runtime_error("Unknown surface type in snapshot");
+    }
+    surface->assignGeoID(description.geoID);
+    surface->assignSurfaceMaterial(description.material);
+    m_geoIDs.emplace_back(surface.get(), description.geoID);
+    return surface;
+  }
+
+  std::unique_ptr<Acts::SurfaceArray> readSurfaceArray(LayerKind kind) {
+    auto arrayKind = read<ArrayKind>();
+    if (arrayKind == ArrayKind::None) {
+      return nullptr;
+    } else if (arrayKind == ArrayKind::Single) {
+      return std::make_unique<Acts::SurfaceArray>(
+          m_surfaces.at(read<uint32_t>()));
+    }
+
+    std::vector<std::shared_ptr<const Acts::Surface>> surfaces(
+        read<uint32_t>());
+    for (auto& surface : surfaces) {
+      surface = m_surfaces.at(read<uint32_t>());
+    }
+    auto transform = readTransform();
+    double reference = read<double>();
+    std::array<AxisDescription, 2> axes;
+    for (auto& axis : axes) {
+      axis.equidistant = read<uint8_t>() != 0;
+      if (axis.equidistant) {
+        axis.min = read<double>();
+        axis.max = read<double>();
+        axis.nBins = read<uint32_t>();
+      } else {
+        axis.edges = readValues();
+      }
+    }
+
+    // the same local coordinates as the SurfaceArrayCreator
+    using Acts::detail::AxisBoundaryType;
+    const Acts::Transform3D& t = *transform;
+    std::unique_ptr<Acts::SurfaceArray::ISurfaceGridLookup> sl;
+    if (kind == LayerKind::Cylinder) {
+      sl = makeGridLookup<AxisBoundaryType::Closed, AxisBoundaryType::Bound>(
+          Acts::detail::CylinderGridTransform(t, reference), axes[0], axes[1]);
+    } else if (kind == LayerKind::Disc) {
+      sl = makeGridLookup<AxisBoundaryType::Bound, AxisBoundaryType::Closed>(
+          Acts::detail::DiscGridTransform(t, reference), axes[0], axes[1]);
+    } else if (kind == LayerKind::Plane) {
+      sl = makeGridLookup<AxisBoundaryType::Bound, AxisBoundaryType::Bound>(
+          Acts::detail::PlaneGridTransform(t), axes[0], axes[1]);
+    } else {
+      throw std::runtime_error("Unexpected surface array in snapshot");
+    }
+
+    size_t nBins = read<uint32_t>();
+    if (nBins != sl->size()) {
+      throw std::runtime_error("Inconsistent surface array size in snapshot");
+    }
+    for (size_t bin = 0; bin < nBins; ++bin) {
+      auto& binSurfaces = sl->lookup(bin);
+      binSurfaces.resize(read<uint32_t>());
+      for (auto& surface : binSurfaces) {
+        surface = surfaces.at(read<uint32_t>()).get();
+      }
+    }
+    // nothing left to fill, this only builds the neighbor cache
+    sl->fill(Acts::GeometryContext(), {});
+    return std::make_unique<Acts::SurfaceArray>(
+        std::move(sl), std::move(surfaces), std::move(transform));
+  }
+
+  Acts::LayerPtr readLayer() {
+    auto kind = read<LayerKind>();
+    auto layerType = static_cast<Acts::LayerType>(read<int8_t>());
+    double thickness = read<double>();
+    Acts::GeometryID geoID(read<uint64_t>());
+    auto representation = readSurface();
+    std::unique_ptr<Acts::ApproachDescriptor> approachDescriptor = nullptr;
+    if (read<uint8_t>() != 0) {
+      std::vector<std::shared_ptr<const Acts::Surface>> approachSurfaces(
+          read<uint32_t>());
+      for (auto& surface : approachSurfaces) {
+        surface = m_surfaces.at(read<uint32_t>());
+      }
+      approachDescriptor = std::make_unique<Acts::GenericApproachDescriptor>(
+          std::move(approachSurfaces));
+    }
+    auto surfaceArray = readSurfaceArray(kind);
+    std::vector<const Acts::Surface*> arraySurfaces;
+    if (surfaceArray) {
+      arraySurfaces = surfaceArray->surfaces();
+    }
+
+    Acts::MutableLayerPtr layer = nullptr;
+    const auto& transform = representation.transform;
+    const auto& bounds = representation.bounds;
+    switch (kind) {
+      case LayerKind::Navigation: {
+        // the representation of a navigation layer is a separate surface
+        auto navigationLayer = Acts::NavigationLayer::create(
+            createSurface(representation), thickness);
+        m_geoIDs.emplace_back(navigationLayer.get(), geoID);
+        const_cast<Acts::Layer&>(*navigationLayer).assignGeoID(geoID);
+        return navigationLayer;
+      }
+      case LayerKind::Cylinder:
+        layer = Acts::CylinderLayer::create(
+            transform, castBounds<Acts::CylinderBounds>(bounds),
+            std::move(surfaceArray), thickness, std::move(approachDescriptor),
+            layerType);
+        break;
+      case LayerKind::Disc:
+        layer = Acts::DiscLayer::create(
+            transform, castBounds<Acts::DiscBounds>(bounds),
+            std::move(surfaceArray), thickness, std::move(approachDescriptor),
+            layerType);
+        break;
+      case LayerKind::Plane:
+        layer = Acts::PlaneLayer::create(
+            transform, castBounds<Acts::PlanarBounds>(bounds),
+            std::move(surfaceArray), thickness, std::move(approachDescriptor),
+            layerType);
+        break;
+      default:
+        throw std::runtime_error("Unknown layer type in snapshot");
+    }
+    layer->assignGeoID(geoID);
+    layer->surfaceRepresentation().assignSurfaceMaterial(
+        representation.material);
+    m_geoIDs.emplace_back(layer.get(), geoID);
+    // as done by the LayerCreator
+    for (const auto* surface : arraySurfaces) {
+      const_cast<Acts::Surface*>(surface)->associateLayer(*layer);
+    }
+    return layer;
+  }
+
+  Acts::MutableTrackingVolumePtr readVolume(std::vector<uint32_t>& boundaries) {
+    std::string name = readString();
+    auto transform = readTransform();
+    auto bounds = readVolumeBounds();
+    Acts::GeometryID geoID(read<uint64_t>());
+    std::shared_ptr<const Acts::IVolumeMaterial> material = nullptr;
+    if (read<MaterialKind>() == MaterialKind::Homogeneous) {
+      auto parameters = read<std::array<float, 5>>();
+      material = std::make_shared<const Acts::HomogeneousVolumeMaterial>(
+          Acts::Material(parameters[0], parameters[1], parameters[2],
+                         parameters[3], parameters[4]));
+    }
+    std::unique_ptr<const Acts::LayerArray> layerArray = nullptr;
+    if (read<uint8_t>() != 0) {
+      layerArray = readBinnedArray<Acts::LayerPtr>(m_layers);
+    }
+    std::shared_ptr<const Acts::TrackingVolumeArray> volumeArray = nullptr;
+    if (read<uint8_t>() != 0) {
+      volumeArray = readBinnedArray<Acts::TrackingVolumePtr>(m_volumes);
+    }
+    boundaries.resize(read<uint32_t>());
+    for (auto& boundary : boundaries) {
+      boundary = read<uint32_t>();
+    }
+    auto volume = Acts::TrackingVolume::create(
+        std::move(transform), std::move(bounds), std::move(material),
+        std::move(layerArray), std::move(volumeArray), {}, name);
+    volume->assignGeoID(geoID);
+    m_geoIDs.emplace_back(volume.get(), geoID);
+    return volume;
+  }
+
+  std::shared_ptr<const BoundarySurface> readBoundary() {
+    const Acts::TrackingVolume* noVolume = nullptr;
+    auto boundary = std::make_shared<BoundarySurface>(
+        m_surfaces.at(read<uint32_t>()), noVolume, noVolume);
+    for (auto orientation : {Acts::insideVolume, Acts::outsideVolume}) {
+      auto kind = read<AttachmentKind>();
+      if (kind == AttachmentKind::Volume) {
+        boundary->attachVolume(m_volumes.at(read<uint32_t>()).get(),
+                               orientation);
+      } else if (kind == AttachmentKind::Array) {
+        boundary->attachVolumeArray(
+            readBinnedArray<Acts::TrackingVolumePtr>(m_volumes), orientation);
+      }
+    }
+    return boundary;
+  }
+
+  const char* m_data;
+  size_t m_size;
+  size_t m_pos;
+  const Acts::Logger& m_logger;
+
+  std::vector<std::shared_ptr<Acts::Surface>> m_surfaces;
+  std::vector<Acts::LayerPtr> m_layers;
+  std::vector<Acts::MutableTrackingVolumePtr> m_volumes;
+  std::vector<std::shared_ptr<const BoundarySurface>> m_boundaries;
+  /// The stored identifiers, checked after the geometry is closed
+  std::vector<std::pair<const Acts::GeometryObject*, Acts::GeometryID>>
+      m_geoIDs;
+};
+
+}  // namespace
+
+void Acts::TrackingGeometrySnapshot::write(const GeometryContext& gctx,
+                                           const TrackingGeometry& tGeometry,
+                                           const std::string& fileName) {
+  const auto* world = tGeometry.highestTrackingVolume();
+  if (world == nullptr) {
+    throw std::invalid_argument("Tracking geometry without world volume");
+  }
+  auto buffer = SnapshotWriter(gctx).write(*world);
+  std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+  file.write(buffer.data(), buffer.size());
+  if (not file) {
+    throw std::runtime_error("Could not write tracking geometry snapshot '" +
+                             fileName + "'");
+  }
+}
+
+Acts::TrackingGeometrySnapshot::TrackingGeometrySnapshot(
+    const Config& cfg, const std::string& fileName)
+    : m_cfg(cfg) {
+  // Validate the configuration
+  if (!m_cfg.logger) {
+    throw std::invalid_argument("Missing logger");
+  }
+  int fd = ::open(fileName.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::invalid_argument("Could not open tracking geometry snapshot '" +
+                                fileName + "'");
+  }
+  struct stat fileStat;
+  if (::fstat(fd, &fileStat) != 0 or
+      static_cast<size_t>(fileStat.st_size) < s_headerSize) {
+    ::close(fd);
+    throw std::invalid_argument("'" + fileName +
+                                "' is not a tracking geometry snapshot");
+  }
+  // the mapping stays valid after the descriptor is closed
+  size_t size = fileStat.st_size;
+  void* data = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (data == MAP_FAILED) {
+    throw std::runtime_error("Could not map tracking geometry snapshot '" +
+                             fileName + "'");
+  }
+  m_data = static_cast<const char*>(data);
+  m_size = size;
+
+  // Check the header
+  std::array<char, 8> magic;
+  uint32_t version = 0;
+  std::memcpy(magic.data(), m_data, magic.size());
+  std::memcpy(&version, m_data + magic.size(), sizeof(version));
+  if (magic != s_magic or version != s_version) {
+    ::munmap(data, size);
+    throw std::invalid_argument(
+        "'" + fileName + "' is not a tracking geometry snapshot of version " +
+        std::to_string(s_version));
+  }
+  ACTS_VERBOSE("Mapped " << m_size << " bytes from '" << fileName << "'");
+}
+
+Acts::TrackingGeometrySnapshot::~TrackingGeometrySnapshot() {
+  if (m_data != nullptr) {
+    ::munmap(const_cast<char*>(m_data), m_size);
+  }
+}
+
+std::unique_ptr<const Acts::TrackingGeometry>
+Acts::TrackingGeometrySnapshot::trackingGeometry(
+    const IMaterialDecorator* materialDecorator) const {
+  return SnapshotReader(m_data, m_size, logger())
+      .trackingGeometry(materialDecorator);
+}
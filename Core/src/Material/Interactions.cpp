@@ -8,8 +8,12 @@
 
 #include "Acts/Material/Interactions.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 
 #include "Acts/Utilities/PdgParticle.hpp"
 
@@ -496,3 +500,212 @@ float Acts::computeMultipleScatteringTheta0(const MaterialProperties& slab,
     return theta0Highland(xOverX0, momentumInv, q2OverBeta2);
   }
 }
+
+void Acts::MaterialPropertiesBatch::reserve(size_t n) {
+  thickness.reserve(n);
+  thicknessInX0.reserve(n);
+  meanExcitationEnergy.reserve(n);
+  molarElectronDensity.reserve(n);
+}
+
+void Acts::MaterialPropertiesBatch::clear() {
+  thickness.clear();
+  thicknessInX0.clear();
+  meanExcitationEnergy.clear();
+  molarElectronDensity.clear();
+}
+
+void Acts::MaterialPropertiesBatch::push_back(const MaterialProperties& slab) {
+  if (slab) {
+    thickness.push_back(slab.thickness());
+    thicknessInX0.push_back(slab.thicknessInX0());
+    meanExcitationEnergy.push_back(slab.material().meanExcitationEnergy());
+    molarElectronDensity.push_back(slab.material().molarElectronDensity());
+  } else {
+    // finite dummy values keep the batched computations well-defined
+    thickness.push_back(0.0f);
+    thicknessInX0.push_back(0.0f);
+    meanExcitationEnergy.push_back(1.0f);
+    molarElectronDensity.push_back(1.0f);
+  }
+}
+
+void Acts::ParticleKinematicsBatch::reserve(size_t n) {
+  pdg.reserve(n);
+  mass.reserve(n);
+  qOverP.reserve(n);
+  charge.reserve(n);
+}
+
+void Acts::ParticleKinematicsBatch::clear() {
+  pdg.clear();
+  mass.clear();
+  qOverP.clear();
+  charge.clear();
+}
+
+void Acts::ParticleKinematicsBatch::push_back(int pdg_, float m, float qOverP_,
+                                              float q) {
+  ASSERT_INPUTS(m, qOverP_, q)
+
+  pdg.push_back(pdg_);
+  mass.push_back(m);
+  qOverP.push_back(qOverP_);
+  charge.push_back(q);
+}
+
+void Acts::InteractionsBatchResult::resize(size_t n) {
+  energyLossBethe.resize(n);
+  energyLossLandau.resize(n);
+  energyLossLandauSigma.resize(n);
+  energyLossLandauSigmaQOverP.resize(n);
+  multipleScatteringTheta0.resize(n);
+}
+
+namespace {
+/// Natural logarithm for the batched computations.
+///
+/// Uses the polynomial of the Cephes logf with an integer-only range
+/// reduction, i.e. without calls and branches so the batch loop can be
+/// vectorized. Only valid for positive, finite, normal inputs where it
+/// agrees with std::log within a few ulp.
+inline float logBatch(float x) {
+  uint32_t bits = 0;
+  std::memcpy(&bits, &x, sizeof(bits));
+  // shift such that the mantissa is reduced to [sqrt(1/2), sqrt(2))
+  bits += 0x3f800000u - 0x3f3504f3u;
+  const auto e = static_cast<int32_t>(bits >> 23) - 0x7f;
+  bits = (bits & 0x007fffffu) + 0x3f3504f3u;
+  float m = 0.0f;
+  std::memcpy(&m, &bits, sizeof(m));
+  m -= 1.0f;
+  const auto fe = static_cast<float>(e);
+  const auto z = m * m;
+  auto y = 7.0376836292e-2f;
+  y = y * m - 1.1514610310e-1f;
+  y = y * m + 1.1676998740e-1f;
+  y = y * m - 1.2420140846e-1f;
+  y = y * m + 1.4249322787e-1f;
+  y = y * m - 1.6668057665e-1f;
+  y = y * m + 2.0000714765e-1f;
+  y = y * m - 2.4999993993e-1f;
+  y = y * m + 3.3333331174e-1f;
+  y = y * m * z - 2.12194440e-4f * fe - 0.5f * z;
+  return (m + y) + 0.693359375f * fe;
+}
+
+// the theta0 prefactors as single precision constants
+constexpr float Theta0HighlandScale = 13.6_MeV;
+constexpr float Theta0RossiGreisenScale = 17.5_MeV;
+
+/// Select between two values for the batched computations.
+///
+/// The selection is done on the bit patterns, since the compiler might turn
+/// a floating point selection back into conditional arithmetic which
+/// prevents the vectorization.
+inline float selectBatch(bool condition, float a, float b) {
+  uint32_t bitsA = 0;
+  uint32_t bitsB = 0;
+  std::memcpy(&bitsA, &a, sizeof(bitsA));
+  std::memcpy(&bitsB, &b, sizeof(bitsB));
+  const uint32_t mask = 0u - static_cast<uint32_t>(condition);
+  const uint32_t bits = (bitsA & mask) | (bitsB & ~mask);
+  float result = 0.0f;
+  std::memcpy(&result, &bits, sizeof(result));
+  return result;
+}
+}  // namespace
+
+void Acts::computeInteractions(const MaterialPropertiesBatch& slabs,
+                               const ParticleKinematicsBatch& particles,
+                               InteractionsBatchResult& result) {
+  assert((slabs.size() == particles.size()) and "Inconsistent batch sizes");
+
+  const size_t n = particles.size();
+  result.resize(n);
+
+  // plain pointers simplify the aliasing analysis for the compiler
+  const float* thickness = slabs.thickness.data();
+  const float* xOverX0 = slabs.thicknessInX0.data();
+  const float* meanExcitationEnergy = slabs.meanExcitationEnergy.data();
+  const float* molarElectronDensity = slabs.molarElectronDensity.data();
+  const int* pdg = particles.pdg.data();
+  const float* mass = particles.mass.data();
+  const float* qOverP = particles.qOverP.data();
+  const float* charge = particles.charge.data();
+
+  // the results are first written to local buffers. they can not alias the
+  // inputs, which otherwise requires too many runtime checks to vectorize.
+  constexpr size_t ChunkSize = 64;
+  std::array<float, ChunkSize> bethe;
+  std::array<float, ChunkSize> landau;
+  std::array<float, ChunkSize> landauSigma;
+  std::array<float, ChunkSize> landauSigmaQOverP;
+  std::array<float, ChunkSize> theta0;
+
+  for (size_t begin = 0; begin < n; begin += ChunkSize) {
+    const size_t size = std::min(ChunkSize, n - begin);
+    for (size_t j = 0; j < size; ++j) {
+      const size_t i = begin + j;
+      const auto m = mass[i];
+      const auto q = charge[i];
+      const auto I = meanExcitationEnergy[i];
+      const auto Ne = molarElectronDensity[i];
+      // vacuum slabs are computed with unit thickness and masked at the end.
+      // this keeps all logarithm arguments positive.
+      const bool isMaterial = (0.0f < thickness[i]);
+      const auto vacuumOffset = isMaterial ? 0.0f : 1.0f;
+      const auto x = thickness[i] + vacuumOffset;
+      const auto xX0 = xOverX0[i] + vacuumOffset;
+      const auto rq = RelativisticQuantities(m, qOverP[i], q);
+      const auto eps = computeEpsilon(Ne, x, rq);
+      // see computeDeltaHalf, always evaluated and selected afterwards
+      const auto plasmaEnergy = PlasmaEnergyScale * std::sqrt(Ne);
+      const auto dhalfHigh =
+          logBatch(rq.betaGamma) + logBatch(plasmaEnergy / I) - 0.5f;
+      const auto dhalf = selectBatch(rq.betaGamma < 10.0f, 0.0f, dhalfHigh);
+
+      // see computeEnergyLossBethe
+      const auto u = computeMassTerm(Me, rq);
+      const auto wmax = computeWMax(m, rq);
+      const auto runningBethe = 0.5f * logBatch(u / I) +
+                                0.5f * logBatch(wmax / I) - rq.beta2 - dhalf;
+      // see computeEnergyLossLandau
+      const auto t = computeMassTerm(m, rq);
+      const auto runningLandau = logBatch(t / I) + logBatch(eps / I) + 0.2f -
+                                 rq.beta2 - 2 * dhalf;
+      // see computeEnergyLossLandauSigma(QOverP)
+      const auto sigmaE = convertLandauFwhmToGaussianSigma(4 * eps);
+      const auto pInv = qOverP[i] / q;
+      const auto sigmaQOverP =
+          std::sqrt(rq.q2OverBeta2) * pInv * pInv * sigmaE;
+      // see theta0Highland and theta0RossiGreisen, both are evaluated and
+      // the one matching the particle type is selected
+      const auto momentumInv = std::abs(pInv);
+      const auto t0Sqrt = std::sqrt(xX0 * rq.q2OverBeta2);
+      const auto t0Highland = Theta0HighlandScale * momentumInv * t0Sqrt *
+                              (1.0f + 0.038f * 2 * logBatch(t0Sqrt));
+      // log10(y) = log(y) / log(10)
+      const auto t0RossiGreisen =
+          Theta0RossiGreisenScale * momentumInv * t0Sqrt *
+          (1.0f + 0.125f * 0.434294481903251828f * logBatch(10.0f * xX0));
+      const bool isElectron = (pdg[i] == PdgParticle::eElectron) |
+                              (pdg[i] == PdgParticle::ePositron);
+      const auto t0 = selectBatch(isElectron, t0RossiGreisen, t0Highland);
+
+      bethe[j] = selectBatch(isMaterial, eps * runningBethe, 0.0f);
+      landau[j] = selectBatch(isMaterial, eps * runningLandau, 0.0f);
+      landauSigma[j] = selectBatch(isMaterial, sigmaE, 0.0f);
+      landauSigmaQOverP[j] = selectBatch(isMaterial, sigmaQOverP, 0.0f);
+      theta0[j] = selectBatch(isMaterial, t0, 0.0f);
+    }
+    std::copy_n(bethe.begin(), size, result.energyLossBethe.begin() + begin);
+    std::copy_n(landau.begin(), size, result.energyLossLandau.begin() + begin);
+    std::copy_n(landauSigma.begin(), size,
+                result.energyLossLandauSigma.begin() + begin);
+    std::copy_n(landauSigmaQOverP.begin(), size,
+                result.energyLossLandauSigmaQOverP.begin() + begin);
+    std::copy_n(theta0.begin(), size,
+                result.multipleScatteringTheta0.begin() + begin);
+  }
+}
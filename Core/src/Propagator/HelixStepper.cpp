@@ -0,0 +1,292 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Propagator/HelixStepper.hpp"
+
+#include <cmath>
+
+namespace {
+
+/// Helix functions of the turning angle theta, scaled to be regular at zero
+struct HelixFunctions {
+  /// sin(theta) / theta
+  double sinc = 1.;
+  /// (1 - cos(theta)) / theta
+  double cosc = 0.;
+  /// 1 - sin(theta) / theta
+  double sincc = 0.;
+  /// (sin(theta) - theta * cos(theta)) / theta^2
+  double fs = 0.;
+  /// (theta * sin(theta) + cos(theta) - 1) / theta^2
+  double fc = 0.5;
+
+  HelixFunctions(double theta, double sinTheta, double cosTheta) {
+    const double theta2 = theta * theta;
+    if (std::abs(theta) < 1e-2) {
+      // Taylor expansions, the truncation error is below double precision
+      const double theta4 = theta2 * theta2;
+      sinc = 1. - theta2 / 6. + theta4 / 120.;
+      cosc = theta * (0.5 - theta2 / 24. + theta4 / 720.);
+      sincc = theta2 / 6. - theta4 / 120.;
+      fs = theta * (1. / 3. - theta2 / 30. + theta4 / 840.);
+      fc = 0.5 - theta2 / 8. + theta4 / 144.;
+    } else {
+      sinc = sinTheta / theta;
+      cosc = (1. - cosTheta) / theta;
+      sincc = 1. - sinc;
+      fs = (sinTheta - theta * cosTheta) / theta2;
+      fc = (theta * sinTheta + cosTheta - 1.) / theta2;
+    }
+  }
+};
+
+}  // namespace
+
+namespace Acts {
+
+std::tuple<BoundParameters, BoundMatrix, double>
+HelixStepper::boundState(State& state, const Surface& surface,
+                         bool reinitialize) const {
+  // Transport the covariance to here
+  std::optional<Covariance> cov = std::nullopt;
+  if (state.covTransport) {
+    covarianceTransport(state, surface, reinitialize);
+    cov = state.cov;
+  }
+  // Create the bound parameters
+  BoundParameters parameters(state.geoContext, cov, state.pos,
+                             state.p * state.dir, state.q, state.t,
+                             surface.getSharedPtr());
+  // Create the bound state
+  BoundState bState{std::move(parameters), state.jacobian,
+                    state.pathAccumulated};
+  // Reset the jacobian to identity
+  if (reinitialize) {
+    state.jacobian = Jacobian::Identity();
+  }
+  /// Return the State
+  return bState;
+}
+
+std::tuple<CurvilinearParameters, BoundMatrix, double>
+HelixStepper::curvilinearState(State& state, bool reinitialize) const {
+  // Transport the covariance to here
+  std::optional<Covariance> cov = std::nullopt;
+  if (state.covTransport) {
+    covarianceTransport(state, reinitialize);
+    cov = state.cov;
+  }
+  // Create the curvilinear parameters
+  CurvilinearParameters parameters(cov, state.pos, state.p * state.dir, state.q,
+                                   state.t);
+  // Create the bound state
+  CurvilinearState curvState{std::move(parameters), state.jacobian,
+                             state.pathAccumulated};
+  // Reset the jacobian to identity
+  if (reinitialize) {
+    state.jacobian = Jacobian::Identity();
+  }
+  /// Return the State
+  return curvState;
+}
+
+void HelixStepper::update(State& state, const BoundParameters& pars) const {
+  const auto& mom = pars.momentum();
+  state.pos = pars.position();
+  state.dir = mom.normalized();
+  state.p = mom.norm();
+  state.t = pars.time();
+
+  if (pars.covariance()) {
+    state.cov = (*(pars.covariance()));
+  }
+}
+
+void HelixStepper::update(State& state, const Vector3D& uposition,
+                          const Vector3D& udirection, double up,
+                          double time) const {
+  state.pos = uposition;
+  state.dir = udirection;
+  state.p = up;
+  state.t = time;
+}
+
+void HelixStepper::covarianceTransport(State& state, bool reinitialize) const {
+  // Optimized trigonometry on the propagation direction
+  const double x = state.dir(0);  // == cos(phi) * sin(theta)
+  const double y = state.dir(1);  // == sin(phi) * sin(theta)
+  const double z = state.dir(2);  // == cos(theta)
+  // can be turned into cosine/sine
+  const double cosTheta = z;
+  const double sinTheta = sqrt(x * x + y * y);
+  const double invSinTheta = 1. / sinTheta;
+  const double cosPhi = x * invSinTheta;
+  const double sinPhi = y * invSinTheta;
+  // prepare the jacobian to curvilinear
+  FreeToBoundMatrix jacToCurv = FreeToBoundMatrix::Zero();
+  if (std::abs(cosTheta) < s_curvilinearProjTolerance) {
+    // We normally operate in curvilinear coordinates defined as follows
+    jacToCurv(0, 0) = -sinPhi;
+    jacToCurv(0, 1) = cosPhi;
+    jacToCurv(1, 0) = -cosPhi * cosTheta;
+    jacToCurv(1, 1) = -sinPhi * cosTheta;
+    jacToCurv(1, 2) = sinTheta;
+  } else {
+    // Under grazing incidence to z, the above coordinate system definition
+    // becomes numerically unstable, and we need to switch to another one
+    const double c = sqrt(y * y + z * z);
+    const double invC = 1. / c;
+    jacToCurv(0, 1) = -z * invC;
+    jacToCurv(0, 2) = y * invC;
+    jacToCurv(1, 0) = c;
+    jacToCurv(1, 1) = -x * y * invC;
+    jacToCurv(1, 2) = -x * z * invC;
+  }
+  // Time parameter
+  jacToCurv(5, 3) = 1.;
+  // Directional and momentum parameters for curvilinear
+  jacToCurv(2, 4) = -sinPhi * invSinTheta;
+  jacToCurv(2, 5) = cosPhi * invSinTheta;
+  jacToCurv(3, 6) = -invSinTheta;
+  jacToCurv(4, 7) = 1.;
+  // Apply the transport from the steps on the jacobian
+  state.jacToGlobal = state.jacTransport * state.jacToGlobal;
+  // Transport the covariance
+  ActsRowVectorD<3> normVec(state.dir);
+  const BoundRowVector sfactors =
+      normVec *
+      state.jacToGlobal.template topLeftCorner<3, eBoundParametersSize>();
+  // The full jacobian is ([to local] jacobian) * ([transport] jacobian)
+  const Jacobian jacFull =
+      jacToCurv * (state.jacToGlobal - state.derivative * sfactors);
+  // Apply the actual covariance transport
+  state.cov = (jacFull * state.cov * jacFull.transpose());
+  // Reinitialize if asked to do so
+  // this is useful for interruption calls
+  if (reinitialize) {
+    // reset the jacobians
+    state.jacToGlobal = BoundToFreeMatrix::Zero();
+    state.jacTransport = FreeMatrix::Identity();
+    // fill the jacobian to global for next transport
+    state.jacToGlobal(0, eLOC_0) = -sinPhi;
+    state.jacToGlobal(0, eLOC_1) = -cosPhi * cosTheta;
+    state.jacToGlobal(1, eLOC_0) = cosPhi;
+    state.jacToGlobal(1, eLOC_1) = -sinPhi * cosTheta;
+    state.jacToGlobal(2, eLOC_1) = sinTheta;
+    state.jacToGlobal(3, eT) = 1;
+    state.jacToGlobal(4, ePHI) = -sinTheta * sinPhi;
+    state.jacToGlobal(4, eTHETA) = cosTheta * cosPhi;
+    state.jacToGlobal(5, ePHI) = sinTheta * cosPhi;
+    state.jacToGlobal(5, eTHETA) = cosTheta * sinPhi;
+    state.jacToGlobal(6, eTHETA) = -sinTheta;
+    state.jacToGlobal(7, eQOP) = 1;
+  }
+  // Store The global and bound jacobian (duplication for the moment)
+  state.jacobian = jacFull * state.jacobian;
+}
+
+void HelixStepper::covarianceTransport(State& state, const Surface& surface,
+                                       bool reinitialize) const {
+  using VectorHelpers::phi;
+  using VectorHelpers::theta;
+  // Initialize the transport final frame jacobian
+  FreeToBoundMatrix jacToLocal = FreeToBoundMatrix::Zero();
+  // initalize the jacobian to local, returns the transposed ref frame
+  auto rframeT = surface.initJacobianToLocal(state.geoContext, jacToLocal,
+                                             state.pos, state.dir);
+  // Update the jacobian with the transport from the steps
+  state.jacToGlobal = state.jacTransport * state.jacToGlobal;
+  // calculate the form factors for the derivatives
+  const BoundRowVector sVec = surface.derivativeFactors(
+      state.geoContext, state.pos, state.dir, rframeT, state.jacToGlobal);
+  // the full jacobian is ([to local] jacobian) * ([transport] jacobian)
+  const Jacobian jacFull =
+      jacToLocal * (state.jacToGlobal - state.derivative * sVec);
+  // Apply the actual covariance transport
+  state.cov = (jacFull * state.cov * jacFull.transpose());
+  // Reinitialize if asked to do so
+  // this is useful for interruption calls
+  if (reinitialize) {
+    // reset the jacobians
+    state.jacToGlobal = BoundToFreeMatrix::Zero();
+    state.jacTransport = FreeMatrix::Identity();
+    // reset the derivative
+    state.derivative = FreeVector::Zero();
+    // fill the jacobian to global for next transport
+    Vector2D loc{0., 0.};
+    surface.globalToLocal(state.geoContext, state.pos, state.dir, loc);
+    BoundVector pars;
+    pars << loc[eLOC_0], loc[eLOC_1], phi(state.dir), theta(state.dir),
+        state.q / state.p, state.t;
+    surface.initJacobianToGlobal(state.geoContext, state.jacToGlobal, state.pos,
+                                 state.dir, pars);
+  }
+  // Store The global and bound jacobian (duplication for the moment)
+  state.jacobian = jacFull * state.jacobian;
+}
+
+void HelixStepper::advance(State& state, double pathLength,
+                           double mass) const {
+  // time propagates along distance as 1/b = sqrt(1 + m²/p²)
+  const double dtds = std::hypot(1., mass / state.p);
+  helixStep(state, getField(state, state.pos), pathLength, dtds, mass);
+  // state the path length
+  state.pathAccumulated += pathLength;
+}
+
+void HelixStepper::helixStep(State& state, const Vector3D& bField, double h,
+                             double dtds, double mass) const {
+  // The equation of motion dT/ds = (q/p) T x B is solved by a rotation of the
+  // direction around the field axis by the angle -theta = -(q/p) |B| s
+  const double bMag = bField.norm();
+  const Vector3D bDir =
+      (bMag > 0.) ? Vector3D(bField / bMag) : Vector3D(0., 0., 1.);
+  const double qop = state.q / state.p;
+  const double kappa = qop * bMag;
+  const double theta = kappa * h;
+  const double sinTheta = std::sin(theta);
+  const double cosTheta = std::cos(theta);
+  const HelixFunctions hf(theta, sinTheta, cosTheta);
+
+  const Vector3D dir0 = state.dir;
+  const Vector3D bCrossT = bDir.cross(dir0);
+  const Vector3D tPar = bDir.dot(dir0) * bDir;
+  // Update the track parameters according to the equations of motion
+  state.pos += h * (hf.sinc * dir0 - hf.cosc * bCrossT + hf.sincc * tPar);
+  state.dir = cosTheta * dir0 - sinTheta * bCrossT + (1. - cosTheta) * tPar;
+  state.t += h * dtds;
+
+  // Propagate the jacobian
+  if (state.covTransport) {
+    ActsMatrixD<3, 3> bCross;
+    bCross << 0., -bDir.z(), bDir.y(), bDir.z(), 0., -bDir.x(), -bDir.y(),
+        bDir.x(), 0.;
+    const ActsSymMatrixD<3> bbT = bDir * bDir.transpose();
+    // The step transport matrix in global coordinates
+    FreeMatrix D = FreeMatrix::Identity();
+    // dr/dT and dT/dT
+    D.block<3, 3>(0, 4) =
+        h * (hf.sinc * ActsSymMatrixD<3>::Identity() - hf.cosc * bCross +
+             hf.sincc * bbT);
+    D.block<3, 3>(4, 4) = cosTheta * ActsSymMatrixD<3>::Identity() -
+                          sinTheta * bCross + (1. - cosTheta) * bbT;
+    // dr/d(q/p) and dT/d(q/p), through the turning angle only
+    D.block<3, 1>(0, 7) =
+        bMag * h * h * (hf.fs * (tPar - dir0) - hf.fc * bCrossT);
+    D.block<3, 1>(4, 7) =
+        bMag * h * (sinTheta * (tPar - dir0) - cosTheta * bCrossT);
+    // Evaluate dt/d(q/p)
+    D(3, 7) = h * mass * mass * state.q / (state.p * dtds);
+    // Update jacobian and derivative
+    state.jacTransport = D * state.jacTransport;
+    state.derivative.head<3>() = state.dir;
+    state.derivative(3) = dtds;
+    state.derivative.segment<3>(4) = qop * state.dir.cross(bField);
+  }
+}
+}  // namespace Acts
@@ -0,0 +1,66 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Propagator/StepSizePredictor.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "Acts/Utilities/Helpers.hpp"
+
+namespace {
+
+/// Bin a value in [min, max) into n bins, under- and overflow are clamped
+size_t clampedBin(double value, double min, double max, size_t n) {
+  double bin = std::floor((value - min) / (max - min) * n);
+  return static_cast<size_t>(std::clamp(bin, 0., double(n - 1)));
+}
+
+}  // namespace
+
+Acts::StepSizePredictor::StepSizePredictor()
+    : StepSizePredictor(Config()) {}
+
+Acts::StepSizePredictor::StepSizePredictor(const Config& cfg) : m_cfg(cfg) {
+  if (m_cfg.nQopBins == 0 or m_cfg.nEtaBins == 0) {
+    throw std::invalid_argument("StepSizePredictor needs at least one bin");
+  }
+  if (not(m_cfg.maxAbsQop > 0.) or not(m_cfg.maxAbsEta > 0.)) {
+    throw std::invalid_argument("StepSizePredictor needs positive ranges");
+  }
+}
+
+double Acts::StepSizePredictor::predict(const TrackingVolume* volume,
+                                        double qop, const Vector3D& dir) {
+  if (not m_cfg.predict) {
+    return 0.;
+  }
+  auto stepSize = m_stepSizes.find(key(volume, qop, dir));
+  if (stepSize == m_stepSizes.end()) {
+    return 0.;
+  }
+  m_statistics.nPredictions += 1;
+  return stepSize->second;
+}
+
+void Acts::StepSizePredictor::accept(const TrackingVolume* volume, double qop,
+                                     const Vector3D& dir, double stepSize) {
+  if (not m_cfg.predict) {
+    return;
+  }
+  m_stepSizes[key(volume, qop, dir)] = std::abs(stepSize);
+}
+
+Acts::StepSizePredictor::Key Acts::StepSizePredictor::key(
+    const TrackingVolume* volume, double qop, const Vector3D& dir) const {
+  return {volume,
+          clampedBin(std::abs(qop), 0., m_cfg.maxAbsQop, m_cfg.nQopBins),
+          clampedBin(VectorHelpers::eta(dir), -m_cfg.maxAbsEta,
+                     m_cfg.maxAbsEta, m_cfg.nEtaBins)};
+}
@@ -0,0 +1,110 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Utilities/Instrumentation.hpp"
+
+#include <cstdlib>
+#include <new>
+
+namespace {
+// trivially initialized, safe to use from within operator new
+thread_local Acts::Instrumentation::AllocationCount t_allocations;
+}  // namespace
+
+#ifdef ACTS_ENABLE_INSTRUMENTATION
+// The replacement is exported from the shared library and takes precedence
+// over the default one for all libraries loaded after it, unless the
+// executable itself replaces the global operator new.
+void* operator new(std::size_t size) {
+  t_allocations.allocations += 1;
+  t_allocations.allocatedBytes += size;
+  if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*size*/) noexcept {
+  std::free(ptr);
+}
+
+// Over-aligned types, e.g. with fixed-size Eigen members, use the aligned
+// overloads. The array and nothrow forms forward to the replaced ones.
+void* operator new(std::size_t size, std::align_val_t alignment) {
+  t_allocations.allocations += 1;
+  t_allocations.allocatedBytes += size;
+  const auto align = static_cast<std::size_t>(alignment);
+  // aligned_alloc requires the size to be a multiple of the alignment
+  const std::size_t alignedSize =
+      (size == 0) ? align : (size + align - 1) / align * align;
+  if (void* ptr = std::aligned_alloc(align, alignedSize)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr, std::align_val_t /*alignment*/) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*size*/,
+                     std::align_val_t /*alignment*/) noexcept {
+  std::free(ptr);
+}
+#endif
+
+Acts::Instrumentation::AllocationCount
+Acts::Instrumentation::threadAllocations() {
+  return t_allocations;
+}
+
+Acts::Instrumentation::Registry& Acts::Instrumentation::Registry::instance() {
+  static Registry registry;
+  return registry;
+}
+
+Acts::Instrumentation::Entry& Acts::Instrumentation::Registry::entry(
+    const std::string& name) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto& entry = m_entries[name];
+  if (not entry) {
+    entry = std::make_unique<Entry>();
+  }
+  return *entry;
+}
+
+Acts::Instrumentation::Counters Acts::Instrumentation::Registry::counters(
+    const std::string& name) const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto it = m_entries.find(name);
+  if (it == m_entries.end()) {
+    return Counters();
+  }
+  return it->second->counters();
+}
+
+std::map<std::string, Acts::Instrumentation::Counters>
+Acts::Instrumentation::Registry::counters() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  std::map<std::string, Counters> counters;
+  for (const auto& [name, entry] : m_entries) {
+    counters.emplace(name, entry->counters());
+  }
+  return counters;
+}
+
+void Acts::Instrumentation::Registry::reset() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  for (auto& entry : m_entries) {
+    entry.second->reset();
+  }
+}
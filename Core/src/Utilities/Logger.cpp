@@ -8,8 +8,115 @@
 
 #include "Acts/Utilities/Logger.hpp"
 
+#include <chrono>
+
 namespace Acts {
 
+Logging::AsyncPrintPolicy::AsyncPrintPolicy(
+    std::unique_ptr<OutputPrintPolicy> wrappee, size_t capacity,
+    bool dropOnFull)
+    : m_wrappee(std::move(wrappee)), m_dropOnFull(dropOnFull) {
+  // round up to the next power of two for cheap index wrapping
+  size_t size = 2;
+  while (size < capacity) {
+    size <<= 1;
+  }
+  m_slots = std::make_unique<Slot[]>(size);
+  for (size_t i = 0; i < size; ++i) {
+    m_slots[i].sequence.store(i, std::memory_order_relaxed);
+  }
+  m_mask = size - 1;
+  m_worker = std::thread(&AsyncPrintPolicy::run, this);
+}
+
+Logging::AsyncPrintPolicy::~AsyncPrintPolicy() {
+  m_stop.store(true, std::memory_order_release);
+  m_worker.join();
+  size_t dropped = droppedMessages();
+  if (dropped > 0) {
+    std::ostringstream os;
+    os << "AsyncPrintPolicy dropped " << dropped
+       << " message(s) due to a full buffer";
+    m_wrappee->flush(WARNING, os);
+  }
+}
+
+void Logging::AsyncPrintPolicy::flush(const Level& lvl,
+                                      const std::ostringstream& input) {
+  // format outside of the critical section to keep slots short-lived
+  std::string message = input.str();
+  size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+  while (true) {
+    Slot& slot = m_slots[pos & m_mask];
+    size_t seq = slot.sequence.load(std::memory_order_acquire);
+    auto diff = static_cast<std::ptrdiff_t>(seq - pos);
+    if (diff == 0) {
+      // slot is free, try to claim it
+      if (m_enqueuePos.compare_exchange_weak(pos, pos + 1,
+                                             std::memory_order_relaxed)) {
+        slot.level = lvl;
+        slot.message = std::move(message);
+        slot.sequence.store(pos + 1, std::memory_order_release);
+        return;
+      }
+    } else if (diff < 0) {
+      // slot still holds an unread message, i.e. the buffer is full
+      if (m_dropOnFull) {
+        m_dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+      }
+      std::this_thread::yield();
+      pos = m_enqueuePos.load(std::memory_order_relaxed);
+    } else {
+      // another producer claimed this slot in the meantime
+      pos = m_enqueuePos.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+bool Logging::AsyncPrintPolicy::pop(Level& lvl, std::string& message) {
+  Slot& slot = m_slots[m_dequeuePos & m_mask];
+  if (slot.sequence.load(std::memory_order_acquire) != m_dequeuePos + 1) {
+    return false;
+  }
+  lvl = slot.level;
+  message = std::move(slot.message);
+  // release the slot for the producers of the next round
+  slot.sequence.store(m_dequeuePos + m_mask + 1, std::memory_order_release);
+  ++m_dequeuePos;
+  return true;
+}
+
+void Logging::AsyncPrintPolicy::run() {
+  Level lvl = VERBOSE;
+  std::string message;
+  std::ostringstream os;
+  unsigned int idle = 0;
+  while (true) {
+    if (pop(lvl, message)) {
+      os.str(message);
+      m_wrappee->flush(lvl, os);
+      idle = 0;
+      continue;
+    }
+    // all producers are gone once the stop flag is set, but messages may
+    // have been queued before the flag was observed
+    if (m_stop.load(std::memory_order_acquire)) {
+      while (pop(lvl, message)) {
+        os.str(message);
+        m_wrappee->flush(lvl, os);
+      }
+      return;
+    }
+    // back off gradually while the buffer is empty
+    if (++idle < 64) {
+      std::this_thread::yield();
+    } else {
+      std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+  }
+}
+
 std::unique_ptr<const Logger> getDefaultLogger(const std::string& name,
                                                const Logging::Level& lvl,
                                                std::ostream* log_stream) {
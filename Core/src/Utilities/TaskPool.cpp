@@ -0,0 +1,53 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Utilities/TaskPool.hpp"
+
+Acts::TaskPool::TaskPool(size_t nThreads) {
+  m_workers.reserve(nThreads);
+  for (size_t it = 0; it < nThreads; ++it) {
+    m_workers.emplace_back([this]() { run(); });
+  }
+}
+
+Acts::TaskPool::~TaskPool() {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+  m_condition.notify_all();
+  for (auto& worker : m_workers) {
+    worker.join();
+  }
+}
+
+void Acts::TaskPool::submit(std::function<void()> task) {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_tasks.push_back(std::move(task));
+  }
+  m_condition.notify_one();
+}
+
+void Acts::TaskPool::run() {
+  while (true) {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_condition.wait(lock,
+                       [this]() { return m_stop or not m_tasks.empty(); });
+      if (m_tasks.empty()) {
+        // only reached when stopping
+        return;
+      }
+      task = std::move(m_tasks.front());
+      m_tasks.pop_front();
+    }
+    task();
+  }
+}
@@ -20,15 +20,26 @@ std::pair<double, double> Acts::GaussianTrackDensity::globalMaximumWithWidth(
   return state.trackDensity.globalMaximumWithWidth(state.trackDensityState);
 }
 
+std::pair<double, double> Acts::GaussianTrackDensity::globalMaximumWithWidth(
+    State& state) const {
+  return state.trackDensity.globalMaximumWithWidth(state.trackDensityState);
+}
+
+void Acts::GaussianTrackDensity::addTrack(const Acts::BoundParameters& trk,
+                                          State& state) const {
+  state.trackDensity.addTrack(state.trackDensityState, trk,
+                              m_cfg.d0MaxSignificance * m_cfg.d0MaxSignificance,
+                              m_cfg.z0MaxSignificance * m_cfg.z0MaxSignificance);
+}
+
+void Acts::GaussianTrackDensity::removeTrack(const Acts::BoundParameters& trk,
+                                             State& state) const {
+  state.trackDensity.removeTrack(state.trackDensityState, trk);
+}
+
 void Acts::GaussianTrackDensity::addTracks(
     const std::vector<Acts::BoundParameters>& trackList, State& state) const {
-  const double d0SignificanceCut =
-      m_cfg.d0MaxSignificance * m_cfg.d0MaxSignificance;
-  const double z0SignificanceCut =
-      m_cfg.z0MaxSignificance * m_cfg.z0MaxSignificance;
-
   for (const auto& trk : trackList) {
-    state.trackDensity.addTrack(state.trackDensityState, trk, d0SignificanceCut,
-                                z0SignificanceCut);
+    addTrack(trk, state);
   }
 }
\ No newline at end of file
@@ -8,11 +8,12 @@
 
 #include "Acts/Vertexing/TrackDensity.hpp"
 #include <math.h>
+#include <iterator>
 
 void Acts::TrackDensity::addTrack(State& state, const BoundParameters& trk,
                                   const double d0SignificanceCut,
                                   const double z0SignificanceCut) const {
-  if (state.trackSet.count(trk) != 0) {
+  if (state.trackMap.count(trk) != 0) {
     return;
   }
   // Get required track parameters
@@ -52,7 +53,9 @@ void Acts::TrackDensity::addTrack(State& state, const BoundParameters& trk,
   const double zMin = (-linearTerm + discriminant) / (2 * quadraticTerm);
   state.maxZRange = std::max(state.maxZRange, std::max(zMax - z0, z0 - zMin));
   constantTerm -= std::log(2 * M_PI * std::sqrt(covDeterminant));
-  state.trackSet.emplace(trk);
+  state.trackMap.emplace(std::piecewise_construct, std::forward_as_tuple(trk),
+                         std::forward_as_tuple(constantTerm, linearTerm,
+                                               quadraticTerm, zMin, zMax));
   state.lowerMap.emplace(std::piecewise_construct,
                          std::forward_as_tuple(constantTerm, linearTerm,
                                                quadraticTerm, zMin, zMax),
@@ -61,6 +64,49 @@ void Acts::TrackDensity::addTrack(State& state, const BoundParameters& trk,
                          std::forward_as_tuple(constantTerm, linearTerm,
                                                quadraticTerm, zMin, zMax),
                          std::forward_as_tuple(trk));
+
+  // The density changed within the range of the new track
+  invalidateSearches(state, zMin, zMax);
+  state.maximumSearches[z0].isValid = false;
+}
+
+void Acts::TrackDensity::removeTrack(State& state,
+                                     const BoundParameters& trk) const {
+  auto itrk = state.trackMap.find(trk);
+  if (itrk == state.trackMap.end()) {
+    return;
+  }
+  const double z0 = trk.parameters()[ParID_t::eLOC_Z0];
+  const TrackEntry entry = itrk->second;
+
+  // The range maps might hold different tracks with the same bounds
+  auto isSameTrack = [&trk](const BoundParameters& other) {
+    return not predPerigee()(trk, other) and not predPerigee()(other, trk);
+  };
+  auto eraseTrack = [&](auto& rangeMap) {
+    auto range = rangeMap.equal_range(entry);
+    for (auto it = range.first; it != range.second; ++it) {
+      if (isSameTrack(it->second)) {
+        rangeMap.erase(it);
+        return;
+      }
+    }
+  };
+  eraseTrack(state.lowerMap);
+  eraseTrack(state.upperMap);
+  auto next = state.trackMap.erase(itrk);
+
+  // The maximum search is kept while other tracks start it at the same z0
+  auto hasZ0 = [z0](TrackMap::const_iterator it) {
+    return it->first.parameters()[ParID_t::eLOC_Z0] == z0;
+  };
+  if ((next != state.trackMap.end() and hasZ0(next)) or
+      (next != state.trackMap.begin() and hasZ0(std::prev(next)))) {
+    state.maximumSearches[z0].isValid = false;
+  } else {
+    state.maximumSearches.erase(z0);
+  }
+  invalidateSearches(state, entry.lowerBound, entry.upperBound);
 }
 
 std::pair<double, double> Acts::TrackDensity::globalMaximumWithWidth(
@@ -69,35 +115,61 @@ std::pair<double, double> Acts::TrackDensity::globalMaximumWithWidth(
   double maximumDensity = 0.;
   double maxCurvature = 0.;
 
-  for (const auto& entry : state.trackSet) {
-    double trialZ = entry.parameters()[ParID_t::eLOC_Z0];
-    double density = 0.;
-    double slope = 0.;
-    double curvature = 0.;
-    density = trackDensity(state, trialZ, slope, curvature);
-    if (curvature >= 0. || density <= 0.) {
-      continue;
+  for (auto& [z0, search] : state.maximumSearches) {
+    if (not search.isValid) {
+      searchMaximum(state, z0, search);
     }
-    updateMaximum(trialZ, density, curvature, maximumPosition, maximumDensity,
-                  maxCurvature);
-    trialZ += stepSize(density, slope, curvature);
-    density = trackDensity(state, trialZ, slope, curvature);
-    if (curvature >= 0. || density <= 0.) {
+    if (search.density <= 0.) {
       continue;
     }
-    updateMaximum(trialZ, density, curvature, maximumPosition, maximumDensity,
-                  maxCurvature);
-    trialZ += stepSize(density, slope, curvature);
+    updateMaximum(search.z, search.density, search.curvature, maximumPosition,
+                  maximumDensity, maxCurvature);
+  }
+
+  return std::make_pair(maximumPosition,
+                        std::sqrt(-(maximumDensity / maxCurvature)));
+}
+
+void Acts::TrackDensity::searchMaximum(State& state, double z0,
+                                       MaximumSearch& search) const {
+  search = MaximumSearch();
+  search.zMin = z0;
+  search.zMax = z0;
+
+  double trialZ = z0;
+  double density = 0.;
+  double slope = 0.;
+  double curvature = 0.;
+  // Evaluate at the track and take two steps towards the nearest maximum
+  for (int istep = 0; istep < 3; ++istep) {
+    if (istep > 0) {
+      trialZ += stepSize(density, slope, curvature);
+    }
     density = trackDensity(state, trialZ, slope, curvature);
+    search.zMin = std::min(search.zMin, trialZ);
+    search.zMax = std::max(search.zMax, trialZ);
     if (curvature >= 0. || density <= 0.) {
-      continue;
+      break;
     }
-    updateMaximum(trialZ, density, curvature, maximumPosition, maximumDensity,
-                  maxCurvature);
+    updateMaximum(trialZ, density, curvature, search.z, search.density,
+                  search.curvature);
   }
 
-  return std::make_pair(maximumPosition,
-                        std::sqrt(-(maximumDensity / maxCurvature)));
+  search.isValid = true;
+  state.maxSearchRange = std::max(
+      state.maxSearchRange, std::max(search.zMax - z0, z0 - search.zMin));
+}
+
+void Acts::TrackDensity::invalidateSearches(State& state, double zMin,
+                                            double zMax) const {
+  auto end = state.maximumSearches.upper_bound(zMax + state.maxSearchRange);
+  for (auto it = state.maximumSearches.lower_bound(zMin - state.maxSearchRange);
+       it != end; ++it) {
+    MaximumSearch& search = it->second;
+    if (search.zMin <= zMax && search.zMax >= zMin) {
+      search.isValid = false;
+    }
+  }
 }
 
 double Acts::TrackDensity::globalMaximum(State& state) const {
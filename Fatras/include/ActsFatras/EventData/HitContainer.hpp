@@ -0,0 +1,176 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include "Acts/Geometry/GeometryID.hpp"
+#include "Acts/Utilities/Definitions.hpp"
+#include "ActsFatras/EventData/Barcode.hpp"
+#include "ActsFatras/EventData/Hit.hpp"
+
+namespace ActsFatras {
+
+/// A struct-of-arrays container for simulation hits.
+///
+/// Each hit property is stored in a separate contiguous column, i.e. there is
+/// no per-hit padding and passes over a single property only touch the memory
+/// they need. The space-time positions and the four-momenta can be stored with
+/// reduced precision to decrease the memory footprint further.
+///
+/// The container supports `push_back(const Hit&)` and an `emplace_back(...)`
+/// with the `Hit` constructor arguments and can thus be used as the hits
+/// output container of the simulator. Element access returns a `Hit` by
+/// value that is reconstructed from the stored columns.
+///
+/// @tparam scalar_t Storage type for the four-vectors
+template <typename scalar_t = Hit::Scalar>
+class HitContainer {
+ public:
+  using Scalar = scalar_t;
+  using Vector4 = Acts::ActsVector<Scalar, 4>;
+  using value_type = Hit;
+  using size_type = std::size_t;
+
+  /// Number of stored hits.
+  size_type size() const { return m_geometryIds.size(); }
+  /// Check if there are no stored hits.
+  bool empty() const { return m_geometryIds.empty(); }
+  /// Reserve storage for the given number of hits in all columns.
+  void reserve(size_type n) {
+    m_geometryIds.reserve(n);
+    m_particleIds.reserve(n);
+    m_indices.reserve(n);
+    m_pos4.reserve(n);
+    m_before4.reserve(n);
+    m_after4.reserve(n);
+  }
+  /// Resize all columns; new hits are default-constructed.
+  void resize(size_type n) {
+    m_geometryIds.resize(n);
+    m_particleIds.resize(n);
+    m_indices.resize(n, -1);
+    m_pos4.resize(n, Vector4::Zero());
+    m_before4.resize(n, Vector4::Zero());
+    m_after4.resize(n, Vector4::Zero());
+  }
+  /// Remove all hits but keep the allocated storage.
+  void clear() {
+    m_geometryIds.clear();
+    m_particleIds.clear();
+    m_indices.clear();
+    m_pos4.clear();
+    m_before4.clear();
+    m_after4.clear();
+  }
+
+  /// Add a hit constructed from its properties.
+  ///
+  /// The parameters are the same as for the `Hit` constructor.
+  template <typename Position4, typename Momentum40, typename Momentum41>
+  void emplace_back(Acts::GeometryID geometryId, Barcode particleId,
+                    const Eigen::MatrixBase<Position4>& pos4,
+                    const Eigen::MatrixBase<Momentum40>& before4,
+                    const Eigen::MatrixBase<Momentum41>& after4,
+                    int32_t index = -1) {
+    m_geometryIds.push_back(geometryId);
+    m_particleIds.push_back(particleId);
+    m_indices.push_back(index);
+    m_pos4.push_back(pos4.template cast<Scalar>());
+    m_before4.push_back(before4.template cast<Scalar>());
+    m_after4.push_back(after4.template cast<Scalar>());
+  }
+  /// Add a hit.
+  void push_back(const Hit& hit) {
+    emplace_back(hit.geometryId(), hit.particleId(), hit.position4(),
+                 hit.momentum4Before(), hit.momentum4After(), hit.index());
+  }
+  /// Append all hits from a range of `Hit` objects.
+  template <typename input_iterator_t>
+  void append(input_iterator_t first, input_iterator_t last) {
+    using Category =
+        typename std::iterator_traits<input_iterator_t>::iterator_category;
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, Category>) {
+      reserve(size() + std::distance(first, last));
+    }
+    for (; first != last; ++first) {
+      push_back(*first);
+    }
+  }
+  /// Append all hits from another container with column-wise bulk copies.
+  template <typename other_scalar_t>
+  void append(const HitContainer<other_scalar_t>& other) {
+    appendColumn(m_geometryIds, other.geometryIds());
+    appendColumn(m_particleIds, other.particleIds());
+    appendColumn(m_indices, other.indices());
+    appendColumn(m_pos4, other.positions4());
+    appendColumn(m_before4, other.momenta4Before());
+    appendColumn(m_after4, other.momenta4After());
+  }
+
+  /// Reconstruct the full hit at the given position.
+  Hit operator[](size_type i) const {
+    return Hit(m_geometryIds[i], m_particleIds[i],
+               m_pos4[i].template cast<Hit::Scalar>(),
+               m_before4[i].template cast<Hit::Scalar>(),
+               m_after4[i].template cast<Hit::Scalar>(), m_indices[i]);
+  }
+
+  /// Geometry identifier of the hit surface.
+  Acts::GeometryID geometryId(size_type i) const { return m_geometryIds[i]; }
+  /// Particle identifier of the particle that generated the hit.
+  Barcode particleId(size_type i) const { return m_particleIds[i]; }
+  /// Hit index along the particle trajectory.
+  int32_t index(size_type i) const { return m_indices[i]; }
+  /// Space-time position four-vector.
+  const Vector4& position4(size_type i) const { return m_pos4[i]; }
+  /// Particle four-momentum before the hit.
+  const Vector4& momentum4Before(size_type i) const { return m_before4[i]; }
+  /// Particle four-momentum after the hit.
+  const Vector4& momentum4After(size_type i) const { return m_after4[i]; }
+
+  /// @name Column access
+  /// @{
+  const std::vector<Acts::GeometryID>& geometryIds() const {
+    return m_geometryIds;
+  }
+  const std::vector<Barcode>& particleIds() const { return m_particleIds; }
+  const std::vector<int32_t>& indices() const { return m_indices; }
+  const std::vector<Vector4>& positions4() const { return m_pos4; }
+  const std::vector<Vector4>& momenta4Before() const { return m_before4; }
+  const std::vector<Vector4>& momenta4After() const { return m_after4; }
+  /// @}
+
+ private:
+  template <typename T, typename U>
+  static void appendColumn(std::vector<T>& column,
+                           const std::vector<U>& other) {
+    if constexpr (std::is_same_v<T, U>) {
+      column.insert(column.end(), other.begin(), other.end());
+    } else {
+      column.reserve(column.size() + other.size());
+      for (const auto& value : other) {
+        column.push_back(value.template cast<Scalar>());
+      }
+    }
+  }
+
+  std::vector<Acts::GeometryID> m_geometryIds;
+  std::vector<Barcode> m_particleIds;
+  std::vector<int32_t> m_indices;
+  std::vector<Vector4> m_pos4;
+  std::vector<Vector4> m_before4;
+  std::vector<Vector4> m_after4;
+};
+
+}  // namespace ActsFatras
@@ -0,0 +1,167 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include "Acts/Utilities/PdgParticle.hpp"
+#include "ActsFatras/EventData/Barcode.hpp"
+#include "ActsFatras/EventData/Particle.hpp"
+#include "ActsFatras/EventData/ProcessType.hpp"
+
+namespace ActsFatras {
+
+/// A struct-of-arrays container for simulated particle states.
+///
+/// Each particle property is stored in a separate contiguous column. The
+/// container supports `push_back(const Particle&)` and can thus be used as
+/// the final particle state output container of the simulator. Element
+/// access returns a `Particle` by value that is reconstructed from the
+/// stored columns.
+class ParticleContainer {
+ public:
+  using Scalar = Particle::Scalar;
+  using Vector3 = Particle::Vector3;
+  using Vector4 = Particle::Vector4;
+  using value_type = Particle;
+  using size_type = std::size_t;
+
+  /// Number of stored particles.
+  size_type size() const { return m_particleIds.size(); }
+  /// Check if there are no stored particles.
+  bool empty() const { return m_particleIds.empty(); }
+  /// Reserve storage for the given number of particles in all columns.
+  void reserve(size_type n) {
+    m_particleIds.reserve(n);
+    m_processes.reserve(n);
+    m_pdgs.reserve(n);
+    m_charges.reserve(n);
+    m_masses.reserve(n);
+    m_pos4.reserve(n);
+    m_unitDirections.reserve(n);
+    m_absMomenta.reserve(n);
+    m_pathsInX0.reserve(n);
+    m_pathsInL0.reserve(n);
+    m_pathLimitsX0.reserve(n);
+    m_pathLimitsL0.reserve(n);
+  }
+  /// Remove all particles but keep the allocated storage.
+  void clear() {
+    m_particleIds.clear();
+    m_processes.clear();
+    m_pdgs.clear();
+    m_charges.clear();
+    m_masses.clear();
+    m_pos4.clear();
+    m_unitDirections.clear();
+    m_absMomenta.clear();
+    m_pathsInX0.clear();
+    m_pathsInL0.clear();
+    m_pathLimitsX0.clear();
+    m_pathLimitsL0.clear();
+  }
+
+  /// Add a particle.
+  void push_back(const Particle& particle) {
+    m_particleIds.push_back(particle.particleId());
+    m_processes.push_back(particle.process());
+    m_pdgs.push_back(particle.pdg());
+    m_charges.push_back(particle.charge());
+    m_masses.push_back(particle.mass());
+    m_pos4.push_back(particle.position4());
+    m_unitDirections.push_back(particle.unitDirection());
+    m_absMomenta.push_back(particle.absMomentum());
+    m_pathsInX0.push_back(particle.pathInX0());
+    m_pathsInL0.push_back(particle.pathInL0());
+    m_pathLimitsX0.push_back(particle.pathLimitX0());
+    m_pathLimitsL0.push_back(particle.pathLimitL0());
+  }
+  /// Append all particles from a range of `Particle` objects.
+  template <typename input_iterator_t>
+  void append(input_iterator_t first, input_iterator_t last) {
+    using Category =
+        typename std::iterator_traits<input_iterator_t>::iterator_category;
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, Category>) {
+      reserve(size() + std::distance(first, last));
+    }
+    for (; first != last; ++first) {
+      push_back(*first);
+    }
+  }
+  /// Append all particles from another container with column-wise copies.
+  void append(const ParticleContainer& other) {
+    appendColumn(m_particleIds, other.m_particleIds);
+    appendColumn(m_processes, other.m_processes);
+    appendColumn(m_pdgs, other.m_pdgs);
+    appendColumn(m_charges, other.m_charges);
+    appendColumn(m_masses, other.m_masses);
+    appendColumn(m_pos4, other.m_pos4);
+    appendColumn(m_unitDirections, other.m_unitDirections);
+    appendColumn(m_absMomenta, other.m_absMomenta);
+    appendColumn(m_pathsInX0, other.m_pathsInX0);
+    appendColumn(m_pathsInL0, other.m_pathsInL0);
+    appendColumn(m_pathLimitsX0, other.m_pathLimitsX0);
+    appendColumn(m_pathLimitsL0, other.m_pathLimitsL0);
+  }
+
+  /// Reconstruct the full particle state at the given position.
+  Particle operator[](size_type i) const {
+    return Particle(m_particleIds[i], m_pdgs[i], m_charges[i], m_masses[i])
+        .setProcess(m_processes[i])
+        .setPosition4(m_pos4[i])
+        .setDirection(m_unitDirections[i])
+        .setAbsMomentum(m_absMomenta[i])
+        .setMaterialPassed(m_pathsInX0[i], m_pathsInL0[i])
+        .setMaterialLimits(m_pathLimitsX0[i], m_pathLimitsL0[i]);
+  }
+
+  /// @name Column access
+  /// @{
+  const std::vector<Barcode>& particleIds() const { return m_particleIds; }
+  const std::vector<ProcessType>& processes() const { return m_processes; }
+  const std::vector<Acts::PdgParticle>& pdgs() const { return m_pdgs; }
+  const std::vector<Scalar>& charges() const { return m_charges; }
+  const std::vector<Scalar>& masses() const { return m_masses; }
+  const std::vector<Vector4>& positions4() const { return m_pos4; }
+  const std::vector<Vector3>& unitDirections() const {
+    return m_unitDirections;
+  }
+  const std::vector<Scalar>& absMomenta() const { return m_absMomenta; }
+  const std::vector<Scalar>& pathsInX0() const { return m_pathsInX0; }
+  const std::vector<Scalar>& pathsInL0() const { return m_pathsInL0; }
+  /// @}
+
+ private:
+  template <typename T>
+  static void appendColumn(std::vector<T>& column,
+                           const std::vector<T>& other) {
+    column.insert(column.end(), other.begin(), other.end());
+  }
+
+  // identity
+  std::vector<Barcode> m_particleIds;
+  std::vector<ProcessType> m_processes;
+  std::vector<Acts::PdgParticle> m_pdgs;
+  std::vector<Scalar> m_charges;
+  std::vector<Scalar> m_masses;
+  // kinematics
+  std::vector<Vector4> m_pos4;
+  std::vector<Vector3> m_unitDirections;
+  std::vector<Scalar> m_absMomenta;
+  // material
+  std::vector<Scalar> m_pathsInX0;
+  std::vector<Scalar> m_pathsInL0;
+  std::vector<Scalar> m_pathLimitsX0;
+  std::vector<Scalar> m_pathLimitsL0;
+};
+
+}  // namespace ActsFatras
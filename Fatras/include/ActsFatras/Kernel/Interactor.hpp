@@ -9,6 +9,8 @@
 #pragma once
 
 #include <cassert>
+#include <cstddef>
+#include <vector>
 
 #include "Acts/Material/ISurfaceMaterial.hpp"
 #include "Acts/Surfaces/Surface.hpp"
@@ -46,7 +48,11 @@ struct InteractorResult {
   /// Additional particles generated by interactions.
   std::vector<Particle> generatedParticles;
   /// Hits created by the propagated particle.
+  ///
+  /// This stays empty if the hits are emplaced into an external container.
   std::vector<Hit> hits;
+  /// Number of hits created by the propagated particle.
+  std::size_t numHits = 0;
 };
 
 /// Fatras interactor plugin for the Acts propagator.
@@ -60,8 +66,10 @@ struct InteractorResult {
 /// @tparam generator_t is a random number generator
 /// @tparam physics_list_t is a simulation physics lists
 /// @tparam hit_surface_selector_t is a selector of sensitive hit surfaces
+/// @tparam hits_t is a container for hits with a Hit-like `emplace_back`
 template <typename generator_t, typename physics_list_t,
-          typename hit_surface_selector_t = NoSurface>
+          typename hit_surface_selector_t = NoSurface,
+          typename hits_t = std::vector<Hit>>
 struct Interactor {
   using result_type = InteractorResult;
 
@@ -85,6 +93,11 @@ struct Interactor {
   hit_surface_selector_t selectHitSurface;
   /// Initial particle state.
   Particle particle;
+  /// Optional external hit container, e.g. the hits of the full event.
+  ///
+  /// If set, hits are emplaced directly into it instead of being collected in
+  /// the result first.
+  hits_t *hits = nullptr;
 
   /// Simulate the interaction with a single surface.
   ///
@@ -165,11 +178,19 @@ struct Interactor {
     // store results of this interaction step, including potential hits
     result.particle = after;
     if (selectHitSurface(surface)) {
-      result.hits.emplace_back(
-          surface.geoID(), before.particleId(),
-          // the interaction could potentially modify the particle position
-          Hit::Scalar(0.5) * (before.position4() + after.position4()),
-          before.momentum4(), after.momentum4(), result.hits.size());
+      auto emplaceHit = [&](auto &container) {
+        container.emplace_back(
+            surface.geoID(), before.particleId(),
+            // the interaction could potentially modify the particle position
+            Hit::Scalar(0.5) * (before.position4() + after.position4()),
+            before.momentum4(), after.momentum4(), result.numHits);
+      };
+      if (hits) {
+        emplaceHit(*hits);
+      } else {
+        emplaceHit(result.hits);
+      }
+      result.numHits += 1;
     }
 
     // continue the propagation with the modified parameters
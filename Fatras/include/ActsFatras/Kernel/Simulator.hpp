@@ -71,11 +71,34 @@ struct ParticleSimulator {
       const Acts::GeometryContext &geoCtx,
       const Acts::MagneticFieldContext &magCtx, generator_t &generator,
       const Particle &particle) const {
+    return simulate<generator_t, std::vector<Hit>>(geoCtx, magCtx, generator,
+                                                   particle, nullptr);
+  }
+
+  /// Simulate a single particle and emplace the hits into a given container.
+  ///
+  /// @param geoCtx is the geometry context to access surface geometries
+  /// @param magCtx is the magnetic field context to access field values
+  /// @param generator is the random number generator
+  /// @param particle is the initial particle state
+  /// @param hits is the container to which the hits are appended directly
+  /// @returns the result of the corresponding Interactor propagator action.
+  ///
+  /// @tparam generator_t is the type of the random number generator
+  /// @tparam hits_t is a container for hits with a Hit-like `emplace_back`
+  ///
+  /// @note The hits container in the result stays empty. Hits are appended
+  ///       even if the propagation fails eventually.
+  template <typename generator_t, typename hits_t>
+  Acts::Result<InteractorResult> simulate(
+      const Acts::GeometryContext &geoCtx,
+      const Acts::MagneticFieldContext &magCtx, generator_t &generator,
+      const Particle &particle, hits_t *hits) const {
     assert(localLogger and "Missing local logger");
 
     // propagator-related additional types
-    using Interact =
-        Interactor<generator_t, physics_list_t, hit_surface_selector_t>;
+    using Interact = Interactor<generator_t, physics_list_t,
+                                hit_surface_selector_t, hits_t>;
     using Actions = Acts::ActionList<Interact, Acts::DebugOutputActor>;
     using Abort = Acts::AbortList<typename Interact::ParticleNotAlive,
                                   Acts::EndOfWorldReached>;
@@ -92,6 +115,7 @@ struct ParticleSimulator {
     interactor.physics = physics;
     interactor.selectHitSurface = selectHitSurface;
     interactor.particle = particle;
+    interactor.hits = hits;
 
     // run with a start parameter type depending on the particle charge.
     // TODO make track parameters consistently constructible regardless
@@ -180,20 +204,28 @@ struct Simulator {
   /// additional ones generated from interactions are stored in separate output
   /// containers; both the initial state at the production vertex and the final
   /// state after propagation are stored. Hits generated from selected input and
-  /// generated particles are stored in the hit container.
+  /// generated particles are emplaced directly into the hit container.
+  ///
+  /// The initial particle states container is used as the simulation queue
+  /// and must provide mutable random access, the final particle states and
+  /// the hits container only need to support appending, e.g. the
+  /// struct-of-arrays `ParticleContainer` and `HitContainer`.
   ///
   /// @tparam generator_t is the type of the random number generator
   /// @tparam input_particles_t is a Container for particles
-  /// @tparam output_particles_t is a SequenceContainer for particles
-  /// @tparam hits_t is a SequenceContainer for hits
+  /// @tparam initial_particles_t is a SequenceContainer for particles
+  /// @tparam final_particles_t is a container for particles with `push_back`
+  /// @tparam hits_t is a container for hits with `size`, `resize`, and a
+  ///         Hit-like `emplace_back`
   template <typename generator_t, typename input_particles_t,
-            typename output_particles_t, typename hits_t>
+            typename initial_particles_t, typename final_particles_t,
+            typename hits_t>
   Acts::Result<std::vector<FailedParticle>> simulate(
       const Acts::GeometryContext &geoCtx,
       const Acts::MagneticFieldContext &magCtx, generator_t &generator,
       const input_particles_t &inputParticles,
-      output_particles_t &simulatedParticlesInitial,
-      output_particles_t &simulatedParticlesFinal, hits_t &hits) const {
+      initial_particles_t &simulatedParticlesInitial,
+      final_particles_t &simulatedParticlesFinal, hits_t &hits) const {
     assert(
         (simulatedParticlesInitial.size() == simulatedParticlesFinal.size()) and
         "Inconsistent initial sizes of the simulated particle containers");
@@ -229,14 +261,19 @@ struct Simulator {
 
         // only simulatable particles are pushed to the container.
         // they must therefore be either charged or neutral.
+        const auto numHits = hits.size();
         ParticleSimulatorResult result = ParticleSimulatorResult::success({});
         if (selectCharged(initialParticle)) {
-          result = charged.simulate(geoCtx, magCtx, generator, initialParticle);
+          result = charged.simulate(geoCtx, magCtx, generator, initialParticle,
+                                    &hits);
         } else {
-          result = neutral.simulate(geoCtx, magCtx, generator, initialParticle);
+          result = neutral.simulate(geoCtx, magCtx, generator, initialParticle,
+                                    &hits);
         }
 
         if (not result.ok()) {
+          // drop the hits that the failed particle already generated
+          hits.resize(numHits);
           // remove particle from output container since it was not simulated.
           simulatedParticlesInitial.erase(
               std::next(simulatedParticlesInitial.begin(), iinitial));
@@ -246,7 +283,7 @@ struct Simulator {
         }
 
         copyOutputs(result.value(), simulatedParticlesInitial,
-                    simulatedParticlesFinal, hits);
+                    simulatedParticlesFinal);
         // since physics processes are independent, there can be particle id
         // collisions within the generated secondaries. they can be resolved by
         // renumbering within each sub-particle generation. this must happen
@@ -279,12 +316,14 @@ struct Simulator {
 
   /// Copy Interactor results to output containers.
   ///
-  /// @tparam particles_t is a SequenceContainer for particles
-  /// @tparam hits_t is a SequenceContainer for hits
-  template <typename particles_t, typename hits_t>
+  /// Hits are not copied since they are emplaced directly by the Interactor.
+  ///
+  /// @tparam initial_particles_t is a SequenceContainer for particles
+  /// @tparam final_particles_t is a container for particles with `push_back`
+  template <typename initial_particles_t, typename final_particles_t>
   void copyOutputs(const InteractorResult &result,
-                   particles_t &particlesInitial, particles_t &particlesFinal,
-                   hits_t &hits) const {
+                   initial_particles_t &particlesInitial,
+                   final_particles_t &particlesFinal) const {
     // initial particle state was already pushed to the container before
     // store final particle state at the end of the simulation
     particlesFinal.push_back(result.particle);
@@ -293,7 +332,6 @@ struct Simulator {
         result.generatedParticles.begin(), result.generatedParticles.end(),
         std::back_inserter(particlesInitial),
         [this](const Particle &particle) { return selectParticle(particle); });
-    std::copy(result.hits.begin(), result.hits.end(), std::back_inserter(hits));
   }
 
   /// Renumber particle ids in the tail of the container.
@@ -15,13 +15,14 @@
 #include "Acts/Geometry/TrackingGeometry.hpp"
 #include "Acts/Utilities/BinningType.hpp"
 #include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/TaskPool.hpp"
 #include "Acts/Utilities/Units.hpp"
 
 namespace Acts {
 
 /// Sort function which sorts dd4hep::DetElement by their ID
 /// @param[in][out] det the dd4hep::DetElements to be sorted
-void sortDetElementsByID(std::vector<dd4hep::DetElement>& det) {
+inline void sortDetElementsByID(std::vector<dd4hep::DetElement>& det) {
   sort(det.begin(), det.end(),
        [](const dd4hep::DetElement& a, const dd4hep::DetElement& b) {
          return (a.id() < b.id());
@@ -72,6 +73,14 @@ void sortDetElementsByID(std::vector<dd4hep::DetElement>& det) {
 /// volumes, which is needed for navigation. Therefore the different hierachies
 /// need to be sorted ascending. The default is sorting by ID.
 /// @param matDetcroator is the material decorator that loads material maps
+/// @param [in] taskPool is the optional pool to convert the sub detectors and
+/// build their layers concurrently, the volumes are still wrapped around each
+/// other in sequence such that the GeometryIDs are not changed
+/// @note With a pool, ROOT needs to be made thread-safe with
+/// `ROOT::EnableThreadSafety()` before the conversion. The lazily created
+/// nominal alignments of all DetElements are filled sequentially before the
+/// concurrent phase, any other DD4hep access of the detector, e.g. by a
+/// custom `sortSubDetectors`, must not run concurrently with the conversion.
 ///
 /// @exception std::logic_error if an error in the translation occurs
 /// @return std::unique_ptr to the full TrackingGeometry
@@ -92,7 +101,8 @@ std::unique_ptr<const TrackingGeometry> convertDD4hepDetector(
     const std::function<void(std::vector<dd4hep::DetElement>& detectors)>&
         sortSubDetectors = sortDetElementsByID,
     const GeometryContext& gctx = GeometryContext(),
-    std::shared_ptr<const IMaterialDecorator> matDecorator = nullptr);
+    std::shared_ptr<const IMaterialDecorator> matDecorator = nullptr,
+    std::shared_ptr<TaskPool> taskPool = nullptr);
 
 /// @brief Method internally used to create an Acts::CylinderVolumeBuilder
 ///
@@ -131,6 +141,10 @@ std::unique_ptr<const TrackingGeometry> convertDD4hepDetector(
 ///       the material will have the'real' thickness.
 /// @attention The default thickness should be set thin enough that no
 ///            touching or overlapping with the next layer can happen.
+/// @param [in] taskPool is the optional pool to build the layers of the sub
+/// detector concurrently
+/// @note With a pool, the same thread-safety requirements as for
+/// convertDD4hepDetector apply
 /// @return std::shared_ptr the Acts::CylinderVolumeBuilder which can be used to
 /// build the full tracking geometry
 std::shared_ptr<const CylinderVolumeBuilder> volumeBuilder_dd4hep(
@@ -139,13 +153,21 @@ std::shared_ptr<const CylinderVolumeBuilder> volumeBuilder_dd4hep(
     BinningType bTypePhi = equidistant, BinningType bTypeR = equidistant,
     BinningType bTypeZ = equidistant, double layerEnvelopeR = UnitConstants::mm,
     double layerEnvelopeZ = UnitConstants::mm,
-    double defaultLayerThickness = UnitConstants::fm);
+    double defaultLayerThickness = UnitConstants::fm,
+    std::shared_ptr<TaskPool> taskPool = nullptr);
 
 /// Helper method internally used to create a default
 /// Acts::CylinderVolumeBuilder
 std::shared_ptr<const CylinderVolumeHelper> cylinderVolumeHelper_dd4hep(
     Logging::Level loggingLevel = Logging::Level::INFO);
 
+/// Method internally used by convertDD4hepDetector and the DD4hepLayerBuilder
+/// to create the nominal alignments of a DetElement and all its children
+/// DD4hep creates them lazily on first access, which is not thread-safe. They
+/// are therefore created sequentially before the concurrent conversion.
+/// @param [in] detElement the dd4hep::DetElement at the top of the hierarchy
+void fillNominalAlignments_dd4hep(const dd4hep::DetElement& detElement);
+
 /// Method internally used by convertDD4hepDetector to collect all sub detectors
 /// Sub detector means each 'compound' DetElement or DetElements which are
 /// declared as 'isBarrel' or 'isBeampipe' by their extension.
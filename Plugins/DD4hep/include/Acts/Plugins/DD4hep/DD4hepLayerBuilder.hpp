@@ -14,6 +14,7 @@
 #include "Acts/Utilities/BinUtility.hpp"
 #include "Acts/Utilities/Definitions.hpp"
 #include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/TaskPool.hpp"
 #include "Acts/Utilities/Units.hpp"
 
 class TGeoMatrix;
@@ -73,6 +74,14 @@ class DD4hepLayerBuilder : public ILayerBuilder {
     /// @attention The default thickness should be set thin enough that no
     ///            touching or overlapping with the next layer can happen.
     double defaultThickness = UnitConstants::fm;
+    /// Optional pool to build the layers of each side concurrently, the
+    /// layers are returned in the order of the given DetElements
+    /// @note ROOT needs to be made thread-safe with
+    /// `ROOT::EnableThreadSafety()` and the DD4hep extensions and identifiers
+    /// of the layers must not be modified during the build. The nominal
+    /// alignments of the layers and their children are created sequentially
+    /// when the configuration is set.
+    std::shared_ptr<TaskPool> taskPool = nullptr;
   };
 
   /// Constructor
@@ -36,7 +36,8 @@ std::unique_ptr<const TrackingGeometry> convertDD4hepDetector(
     const std::function<void(std::vector<dd4hep::DetElement>& detectors)>&
         sortSubDetectors,
     const Acts::GeometryContext& gctx,
-    std::shared_ptr<const IMaterialDecorator> matDecorator) {
+    std::shared_ptr<const IMaterialDecorator> matDecorator,
+    std::shared_ptr<TaskPool> taskPool) {
   // create local logger for conversion
   auto DD4hepConverterlogger =
       Acts::getDefaultLogger("DD4hepConversion", loggingLevel);
@@ -50,18 +51,34 @@ std::unique_ptr<const TrackingGeometry> convertDD4hepDetector(
   collectSubDetectors_dd4hep(worldDetElement, subDetectors);
   // sort to build detector from bottom to top
   sortSubDetectors(subDetectors);
+  // create the lazily evaluated DD4hep caches before the concurrent phase
+  if (taskPool) {
+    fillNominalAlignments_dd4hep(worldDetElement);
+  }
+  // convert the sub detectors, they are independent of each other
+  std::vector<std::shared_ptr<const CylinderVolumeBuilder>> subDetBuilders(
+      subDetectors.size());
+  auto convertSubDetector = [&](size_t is) {
+    ACTS_INFO("Translating DD4hep sub detector: " << subDetectors[is].name());
+    // create volume builder
+    subDetBuilders[is] = volumeBuilder_dd4hep(
+        subDetectors[is], loggingLevel, bTypePhi, bTypeR, bTypeZ,
+        layerEnvelopeR, layerEnvelopeZ, defaultLayerThickness, taskPool);
+  };
+  if (taskPool) {
+    taskPool->parallelFor(subDetectors.size(), convertSubDetector);
+  } else {
+    for (size_t is = 0; is < subDetectors.size(); ++is) {
+      convertSubDetector(is);
+    }
+  }
   // the volume builders of the subdetectors
-  std::list<std::shared_ptr<const ITrackingVolumeBuilder>> volumeBuilders;
+  std::list<std::shared_ptr<const CylinderVolumeBuilder>> volumeBuilders;
   // the beam pipe volume builder needs special treatment and needs to be added
   // in the end (beampipe exceeds length of all other subdetectors)
   std::shared_ptr<const CylinderVolumeBuilder> beamPipeVolumeBuilder;
-  // loop over the sub detectors
-  for (auto& subDetector : subDetectors) {
-    ACTS_INFO("Translating DD4hep sub detector: " << subDetector.name());
-    // create volume builder
-    auto volBuilder = volumeBuilder_dd4hep(
-        subDetector, loggingLevel, bTypePhi, bTypeR, bTypeZ, layerEnvelopeR,
-        layerEnvelopeZ, defaultLayerThickness);
+  // loop over the sub detector volume builders in the sorted order
+  for (auto& volBuilder : subDetBuilders) {
     if (volBuilder) {
       // distinguish beam pipe
       if (volBuilder->getConfiguration().buildToRadiusZero) {
@@ -87,27 +104,36 @@ std::unique_ptr<const TrackingGeometry> convertDD4hepDetector(
     volumeBuilders.push_back(beamPipeVolumeBuilder);
   }
 
-  std::vector<std::function<std::shared_ptr<TrackingVolume>(
-      const GeometryContext&, const TrackingVolumePtr&,
-      const VolumeBoundsPtr&)>>
-      volumeFactories;
-
-  for (const auto& vb : volumeBuilders) {
-    volumeFactories.push_back(
-        [vb](const GeometryContext& vgctx,
-             const std::shared_ptr<const TrackingVolume>& inner,
-             const VolumeBoundsPtr&) {
-          return vb->trackingVolume(vgctx, inner);
-        });
-  }
-
   // create cylinder volume helper
   auto volumeHelper = cylinderVolumeHelper_dd4hep();
   // hand over the collected volume builders
   Acts::TrackingGeometryBuilder::Config tgbConfig;
   tgbConfig.trackingVolumeHelper = volumeHelper;
   tgbConfig.materialDecorator = std::move(matDecorator);
-  tgbConfig.trackingVolumeBuilders = std::move(volumeFactories);
+  for (const auto& vb : volumeBuilders) {
+    if (taskPool) {
+      // the layers of all volumes are built concurrently first
+      tgbConfig.stagedVolumeBuilders.push_back(
+          [vb](const GeometryContext& cgctx)
+              -> TrackingGeometryBuilder::VolumeBuilder {
+            auto content = vb->buildContent(cgctx);
+            return [vb, content](
+                       const GeometryContext& vgctx,
+                       const std::shared_ptr<const TrackingVolume>& inner,
+                       const VolumeBoundsPtr&) {
+              return vb->trackingVolume(vgctx, content, inner);
+            };
+          });
+    } else {
+      tgbConfig.trackingVolumeBuilders.push_back(
+          [vb](const GeometryContext& vgctx,
+               const std::shared_ptr<const TrackingVolume>& inner,
+               const VolumeBoundsPtr&) {
+            return vb->trackingVolume(vgctx, inner);
+          });
+    }
+  }
+  tgbConfig.taskPool = std::move(taskPool);
   auto trackingGeometryBuilder =
       std::make_shared<const Acts::TrackingGeometryBuilder>(tgbConfig);
   return (trackingGeometryBuilder->trackingGeometry(gctx));
@@ -116,8 +142,8 @@ std::unique_ptr<const TrackingGeometry> convertDD4hepDetector(
 std::shared_ptr<const CylinderVolumeBuilder> volumeBuilder_dd4hep(
     dd4hep::DetElement subDetector, Logging::Level loggingLevel,
     BinningType bTypePhi, BinningType bTypeR, BinningType bTypeZ,
-    double layerEnvelopeR, double layerEnvelopeZ,
-    double defaultLayerThickness) {
+    double layerEnvelopeR, double layerEnvelopeZ, double defaultLayerThickness,
+    std::shared_ptr<TaskPool> taskPool) {
   // create cylinder volume helper
   auto volumeHelper = cylinderVolumeHelper_dd4hep(loggingLevel);
   // create local logger for conversion
@@ -327,6 +353,7 @@ std::shared_ptr<const CylinderVolumeBuilder> volumeBuilder_dd4hep(
     lbConfig.bTypeR = bTypeR;
     lbConfig.bTypeZ = bTypeZ;
     lbConfig.defaultThickness = defaultLayerThickness;
+    lbConfig.taskPool = taskPool;
     auto dd4hepLayerBuilder = std::make_shared<const Acts::DD4hepLayerBuilder>(
         lbConfig,
         Acts::getDefaultLogger(std::string("D2A_L:") + subDetector.name(),
@@ -446,6 +473,7 @@ std::shared_ptr<const CylinderVolumeBuilder> volumeBuilder_dd4hep(
     lbConfig.bTypePhi = bTypePhi;
     lbConfig.bTypeZ = bTypeZ;
     lbConfig.defaultThickness = defaultLayerThickness;
+    lbConfig.taskPool = taskPool;
     auto dd4hepLayerBuilder = std::make_shared<const Acts::DD4hepLayerBuilder>(
         lbConfig,
         Acts::getDefaultLogger(std::string("D2A_LB_") + subDetector.name(),
@@ -535,6 +563,13 @@ std::shared_ptr<const Acts::CylinderVolumeHelper> cylinderVolumeHelper_dd4hep(
   return cylinderVolumeHelper;
 }
 
+void fillNominalAlignments_dd4hep(const dd4hep::DetElement& detElement) {
+  detElement.nominal();
+  for (const auto& child : detElement.children()) {
+    fillNominalAlignments_dd4hep(child.second);
+  }
+}
+
 void collectCompounds_dd4hep(dd4hep::DetElement& detElement,
                              std::vector<dd4hep::DetElement>& compounds) {
   const dd4hep::DetElement::Children& children = detElement.children();
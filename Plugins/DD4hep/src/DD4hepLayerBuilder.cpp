@@ -15,6 +15,7 @@
 #include "Acts/Geometry/ProtoLayer.hpp"
 #include "Acts/Material/ISurfaceMaterial.hpp"
 #include "Acts/Plugins/DD4hep/ActsExtension.hpp"
+#include "Acts/Plugins/DD4hep/ConvertDD4hepDetector.hpp"
 #include "Acts/Plugins/DD4hep/ConvertDD4hepMaterial.hpp"
 #include "Acts/Plugins/DD4hep/DD4hepDetectorElement.hpp"
 #include "Acts/Plugins/TGeo/TGeoPrimitivesHelpers.hpp"
@@ -43,6 +44,16 @@ Acts::DD4hepLayerBuilder::~DD4hepLayerBuilder() = default;
 void Acts::DD4hepLayerBuilder::setConfiguration(
     const Acts::DD4hepLayerBuilder::Config& config) {
   m_cfg = config;
+  // the layers are built concurrently with a pool, the lazily evaluated
+  // DD4hep caches must be filled before
+  if (m_cfg.taskPool) {
+    for (const auto* layers :
+         {&m_cfg.negativeLayers, &m_cfg.centralLayers, &m_cfg.positiveLayers}) {
+      for (const auto& detElement : *layers) {
+        fillNominalAlignments_dd4hep(detElement);
+      }
+    }
+  }
 }
 
 const Acts::LayerVector Acts::DD4hepLayerBuilder::endcapLayers(
@@ -56,8 +67,10 @@ const Acts::LayerVector Acts::DD4hepLayerBuilder::endcapLayers(
     ACTS_VERBOSE(" Received layers for " << side
                                          << " volume -> creating "
                                             "disc layers");
-    // go through layers
-    for (auto& detElement : dendcapLayers) {
+    // build the layers, they are independent of each other
+    layers.resize(dendcapLayers.size());
+    auto buildLayer = [&](size_t il) {
+      const auto& detElement = dendcapLayers[il];
       // prepare the layer surfaces
       std::vector<std::shared_ptr<const Surface>> layerSurfaces;
       // access the extension of the layer
@@ -154,8 +167,15 @@ const Acts::LayerVector Acts::DD4hepLayerBuilder::endcapLayers(
       }
       // Add the ProtoMaterial if present
       addDiscLayerProtoMaterial(detElement, *endcapLayer);
-      // push back created layer
-      layers.push_back(endcapLayer);
+      // set the created layer
+      layers[il] = endcapLayer;
+    };
+    if (m_cfg.taskPool) {
+      m_cfg.taskPool->parallelFor(layers.size(), buildLayer);
+    } else {
+      for (size_t il = 0; il < layers.size(); ++il) {
+        buildLayer(il);
+      }
     }
   }
   return layers;
@@ -175,8 +195,10 @@ const Acts::LayerVector Acts::DD4hepLayerBuilder::centralLayers(
     ACTS_VERBOSE(
         " Received layers for central volume -> creating "
         "cylindrical layers");
-    // go through layers
-    for (auto& detElement : m_cfg.centralLayers) {
+    // build the layers, they are independent of each other
+    layers.resize(m_cfg.centralLayers.size());
+    auto buildLayer = [&](size_t il) {
+      const auto& detElement = m_cfg.centralLayers[il];
       // prepare the layer surfaces
       std::vector<std::shared_ptr<const Surface>> layerSurfaces;
       // access the extension of the layer
@@ -266,8 +288,15 @@ const Acts::LayerVector Acts::DD4hepLayerBuilder::centralLayers(
       }
       // Add the ProtoMaterial if present
       addCylinderLayerProtoMaterial(detElement, *centralLayer);
-      // push back created layer
-      layers.push_back(centralLayer);
+      // set the created layer
+      layers[il] = centralLayer;
+    };
+    if (m_cfg.taskPool) {
+      m_cfg.taskPool->parallelFor(layers.size(), buildLayer);
+    } else {
+      for (size_t il = 0; il < layers.size(); ++il) {
+        buildLayer(il);
+      }
     }
   }
   return layers;
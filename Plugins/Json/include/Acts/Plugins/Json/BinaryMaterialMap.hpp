@@ -0,0 +1,165 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "Acts/Geometry/GeometryID.hpp"
+#include "Acts/Material/ISurfaceMaterial.hpp"
+#include "Acts/Plugins/Json/JsonGeometryConverter.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+namespace Acts {
+
+/// @class BinaryMaterialMap
+///
+/// @brief Compact binary format for surface material maps
+///
+/// The file starts with a fixed size header, followed by an index of all
+/// entries sorted by GeometryID. Each index entry points to a data block with
+/// the binning and the material properties of one surface. Opening a file only
+/// reads the header and the index. The surface material is then created
+/// directly from the data blocks, i.e. without any intermediate
+/// representation of the full map.
+///
+/// File layout (native byte order, offsets in bytes from the file start):
+///
+///     header : char[8] magic, uint32 version, uint32 reserved,
+///              uint64 number of entries
+///     index  : { uint64 geoID, uint64 offset, uint64 size } per entry
+///     blocks : uint8 type, uint8 number of bin dimensions,
+///              { uint8 value, uint8 option, uint32 bins, float min,
+///                float max } per bin dimension,
+///              uint32 n1, uint32 n0,
+///              float[6] { X0, L0, Ar, Z, rho, thickness } per n1 x n0 bin
+///
+/// Vacuum bins are stored with all parameters set to zero.
+class BinaryMaterialMap {
+ public:
+  using SurfaceMaterialMap =
+      std::map<GeometryID, std::shared_ptr<const ISurfaceMaterial>>;
+
+  /// Material type stored in a data block
+  enum class Type : uint8_t { Proto = 0, Homogeneous = 1, Binned = 2 };
+
+  /// Entry of the file index
+  struct IndexEntry {
+    /// encoded geometry identifier
+    GeometryID::Value geoID = 0;
+    /// position of the data block
+    uint64_t offset = 0;
+    /// size of the data block
+    uint64_t size = 0;
+  };
+
+  /// @class Config
+  /// Configuration of the reader
+  class Config {
+   public:
+    /// The default logger
+    std::shared_ptr<const Logger> logger;
+    /// The name of the reader
+    std::string name = "";
+
+    /// Constructor
+    ///
+    /// @param lname Name of the reader tool
+    /// @param lvl The output logging level
+    Config(const std::string& lname = "BinaryMaterialMap",
+           Logging::Level lvl = Logging::INFO)
+        : logger(getDefaultLogger(lname, lvl)), name(lname) {}
+  };
+
+  /// Constructor, reads the header and the index
+  ///
+  /// @param cfg configuration struct for the reader
+  /// @param fileName the binary material map file
+  BinaryMaterialMap(const Config& cfg, const std::string& fileName);
+
+  /// Access the index of all stored entries, sorted by GeometryID
+  const std::vector<IndexEntry>& index() const { return m_index; }
+
+  /// Check whether an entry exists for a surface, only uses the index
+  ///
+  /// @param geoID the identifier of the surface
+  bool contains(const GeometryID& geoID) const;
+
+  /// Read the material for a single surface
+  ///
+  /// @param geoID the identifier of the surface
+  ///
+  /// @return a newly created surface material or nullptr if no entry exists
+  ///
+  /// @note Thread-safe, access to the underlying file stream is serialized.
+  std::shared_ptr<ISurfaceMaterial> surfaceMaterial(const GeometryID& geoID);
+
+  /// Read the material for all surfaces
+  ///
+  /// The data blocks are read one after another in file order.
+  SurfaceMaterialMap surfaceMaterialMap();
+
+  /// Write surface material maps in the binary format
+  ///
+  /// @param fileName the output file
+  /// @param surfaceMaterialMap the material to be written
+  ///
+  /// Only proto, homogeneous, and binned surface material are supported.
+  static void write(const std::string& fileName,
+                    const SurfaceMaterialMap& surfaceMaterialMap);
+
+  /// Check whether a file is a binary material map
+  ///
+  /// @param fileName the file to be checked
+  static bool isBinaryMaterialMap(const std::string& fileName);
+
+  /// Convert a json material map file into the binary format
+  ///
+  /// @param cfg configuration of the json converter
+  /// @param jsonFileName the json input file
+  /// @param binaryFileName the binary output file
+  static void convertJson(const JsonGeometryConverter::Config& cfg,
+                          const std::string& jsonFileName,
+                          const std::string& binaryFileName);
+
+ private:
+  /// Find the index entry for a surface
+  std::vector<IndexEntry>::const_iterator find(const GeometryID& geoID) const;
+
+  /// Read and create the surface material from one data block
+  ///
+  /// @note The caller has to hold the file mutex
+  std::shared_ptr<ISurfaceMaterial> readSurfaceMaterial(
+      const IndexEntry& entry);
+
+  /// The config class
+  Config m_cfg;
+
+  /// The input stream
+  std::ifstream m_file;
+
+  /// The index of all entries
+  std::vector<IndexEntry> m_index;
+
+  /// Buffer re-used for reading the data blocks
+  std::vector<char> m_buffer;
+
+  /// Serializes the access to the input stream and the buffer
+  std::mutex m_fileMutex;
+
+  /// Private access to the logging instance
+  const Logger& logger() const { return *m_cfg.logger; }
+};
+
+}  // namespace Acts
@@ -16,7 +16,9 @@
 #include "Acts/Material/IMaterialDecorator.hpp"
 #include "Acts/Material/ISurfaceMaterial.hpp"
 #include "Acts/Material/IVolumeMaterial.hpp"
+#include "Acts/Plugins/Json/BinaryMaterialMap.hpp"
 #include "Acts/Plugins/Json/JsonGeometryConverter.hpp"
+#include "Acts/Plugins/Json/LazySurfaceMaterial.hpp"
 #include "Acts/Surfaces/Surface.hpp"
 
 // Convenience shorthand
@@ -26,7 +28,12 @@ namespace Acts {
 /// @brief Material decorator from Json format
 ///
 /// This reads in material maps for surfaces and volumes
-/// from a json file
+/// from a json file. Files in the binary material map format
+/// (see BinaryMaterialMap) are detected and read transparently.
+///
+/// For binary files the material can optionally be loaded lazily: only the
+/// index is read at construction and the decorated surfaces get a
+/// LazySurfaceMaterial proxy, which builds the surface material on first use.
 class JsonMaterialDecorator : public IMaterialDecorator {
  public:
   using SurfaceMaterialMap =
@@ -35,13 +42,34 @@ class JsonMaterialDecorator : public IMaterialDecorator {
   using VolumeMaterialMap =
       std::map<GeometryID, std::shared_ptr<const IVolumeMaterial>>;
 
+  /// Constructor
+  ///
+  /// @param rConfig the configuration of the json reader
+  /// @param jFileName the json or binary material map file
+  /// @param clearSurfaceMaterial clear the surface material before decorating
+  /// @param clearVolumeMaterial clear the volume material before decorating
+  /// @param lazyLoading load the surface material on first use, only
+  ///        supported for binary material maps and ignored otherwise
   JsonMaterialDecorator(const JsonGeometryConverter::Config& rConfig,
                         const std::string& jFileName,
                         bool clearSurfaceMaterial = true,
-                        bool clearVolumeMaterial = true)
+                        bool clearVolumeMaterial = true,
+                        bool lazyLoading = false)
       : m_readerConfig(rConfig),
         m_clearSurfaceMaterial(clearSurfaceMaterial),
         m_clearVolumeMaterial(clearVolumeMaterial) {
+    // the binary format is read directly without json parsing
+    if (BinaryMaterialMap::isBinaryMaterialMap(jFileName)) {
+      auto bmMap = std::make_shared<BinaryMaterialMap>(
+          BinaryMaterialMap::Config(), jFileName);
+      if (lazyLoading) {
+        m_binaryMaterialMap = std::move(bmMap);
+      } else {
+        m_surfaceMaterialMap = bmMap->surfaceMaterialMap();
+      }
+      return;
+    }
+
     // the material reader
     Acts::JsonGeometryConverter::Config jmConverterCfg("JsonGeometryConverter",
                                                        Logging::VERBOSE);
@@ -64,6 +92,14 @@ class JsonMaterialDecorator : public IMaterialDecorator {
     if (m_clearSurfaceMaterial) {
       surface.assignSurfaceMaterial(nullptr);
     }
+    // Lazy loading, only the index is checked here
+    if (m_binaryMaterialMap) {
+      if (m_binaryMaterialMap->contains(surface.geoID())) {
+        surface.assignSurfaceMaterial(std::make_shared<LazySurfaceMaterial>(
+            m_binaryMaterialMap, surface.geoID()));
+      }
+      return;
+    }
     // Try to find the surface in the map
     auto sMaterial = m_surfaceMaterialMap.find(surface.geoID());
     if (sMaterial != m_surfaceMaterialMap.end()) {
@@ -85,6 +121,8 @@ class JsonMaterialDecorator : public IMaterialDecorator {
   JsonGeometryConverter::Config m_readerConfig;
   SurfaceMaterialMap m_surfaceMaterialMap;
   VolumeMaterialMap m_volumeMaterialMap;
+  /// The binary material map, only set for lazy loading
+  std::shared_ptr<BinaryMaterialMap> m_binaryMaterialMap = nullptr;
 
   bool m_clearSurfaceMaterial{true};
   bool m_clearVolumeMaterial{true};
@@ -0,0 +1,104 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+#include "Acts/Geometry/GeometryID.hpp"
+#include "Acts/Material/ISurfaceMaterial.hpp"
+#include "Acts/Plugins/Json/BinaryMaterialMap.hpp"
+
+namespace Acts {
+
+/// @class LazySurfaceMaterial
+///
+/// @brief proxy to surface material stored in a binary material map
+///
+/// Only the identifier of the surface is kept at construction time. The
+/// actual surface material is read from the binary material map and built the
+/// first time any material properties are requested. The loading is
+/// thread-safe and happens exactly once, afterwards all calls are forwarded
+/// to the loaded material without any locking.
+///
+/// @note The proxy hides the concrete material type, it is therefore not
+/// suited for the material mapping which inspects the surface material.
+class LazySurfaceMaterial : public ISurfaceMaterial {
+ public:
+  /// Constructor
+  ///
+  /// @param materialMap the binary material map holding the surface material
+  /// @param geoID the identifier of the surface
+  LazySurfaceMaterial(std::shared_ptr<BinaryMaterialMap> materialMap,
+                      const GeometryID& geoID);
+
+  /// Destructor
+  ~LazySurfaceMaterial() override = default;
+
+  /// Scale operator, loads the material if not yet done
+  ///
+  /// @param scale is the scale factor applied
+  LazySurfaceMaterial& operator*=(double scale) final;
+
+  /// @copydoc ISurfaceMaterial::materialProperties(const Vector2D&)
+  const MaterialProperties& materialProperties(const Vector2D& lp) const final;
+
+  /// @copydoc ISurfaceMaterial::materialProperties(const Vector3D&)
+  const MaterialProperties& materialProperties(const Vector3D& gp) const final;
+
+  /// @copydoc ISurfaceMaterial::materialProperties(size_t, size_t)
+  const MaterialProperties& materialProperties(size_t ib0,
+                                               size_t ib1) const final;
+
+  /// Check whether the material has been loaded already
+  bool isLoaded() const;
+
+  /// Access the loaded material, loads it if not yet done
+  const ISurfaceMaterial& material() const;
+
+  /// Output Method for std::ostream
+  std::ostream& toStream(std::ostream& sl) const final;
+
+ private:
+  /// Read the surface material from the binary material map
+  void load() const;
+
+  /// The binary material map
+  std::shared_ptr<BinaryMaterialMap> m_materialMap;
+
+  /// The identifier of the surface
+  GeometryID m_geoID;
+
+  /// Guards the one-time loading
+  mutable std::once_flag m_loaded;
+
+  /// The loaded surface material
+  mutable std::shared_ptr<ISurfaceMaterial> m_material = nullptr;
+
+  /// Set once the material is available
+  mutable std::atomic<bool> m_isLoaded{false};
+};
+
+inline const MaterialProperties& LazySurfaceMaterial::materialProperties(
+    const Vector2D& lp) const {
+  return material().materialProperties(lp);
+}
+
+inline const MaterialProperties& LazySurfaceMaterial::materialProperties(
+    const Vector3D& gp) const {
+  return material().materialProperties(gp);
+}
+
+inline const MaterialProperties& LazySurfaceMaterial::materialProperties(
+    size_t ib0, size_t ib1) const {
+  return material().materialProperties(ib0, ib1);
+}
+
+}  // namespace Acts
@@ -0,0 +1,308 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Plugins/Json/BinaryMaterialMap.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <stdexcept>
+
+#include "Acts/Material/BinnedSurfaceMaterial.hpp"
+#include "Acts/Material/HomogeneousSurfaceMaterial.hpp"
+#include "Acts/Material/ProtoSurfaceMaterial.hpp"
+#include "Acts/Utilities/BinUtility.hpp"
+
+namespace {
+
+constexpr std::array<char, 8> s_magic = {'A', 'C', 'T', 'S',
+                                         'M', 'A', 'T', '\0'};
+constexpr uint32_t s_version = 1;
+// magic, version, reserved, number of entries
+constexpr size_t s_headerSize = 8 + 4 + 4 + 8;
+// geoID, offset, size
+constexpr size_t s_indexEntrySize = 8 + 8 + 8;
+
+/// Append the binary representation of a trivial value to a buffer
+template <typename T>
+void append(std::vector<char>& buffer, const T& value) {
+  const char* bytes = reinterpret_cast<const char*>(&value);
+  buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+/// Sequential reader of trivial values from a buffer
+class BlockReader {
+ public:
+  BlockReader(const std::vector<char>& buffer) : m_buffer(buffer) {}
+
+  template <typename T>
+  T read() {
+    if (m_pos + sizeof(T) > m_buffer.size()) {
+      throw std::runtime_error("Truncated binary material map block");
+    }
+    T value;
+    std::memcpy(&value, m_buffer.data() + m_pos, sizeof(T));
+    m_pos += sizeof(T);
+    return value;
+  }
+
+ private:
+  const std::vector<char>& m_buffer;
+  size_t m_pos = 0;
+};
+
+/// Append the binning of a bin utility to a buffer
+void appendBinning(std::vector<char>& buffer, const Acts::BinUtility& bu) {
+  const auto& binningData = bu.binningData();
+  append<uint8_t>(buffer, binningData.size());
+  for (const auto& bData : binningData) {
+    append<uint8_t>(buffer, bData.binvalue);
+    append<uint8_t>(buffer, bData.option);
+    append<uint32_t>(buffer, bData.bins());
+    append<float>(buffer, bData.min);
+    append<float>(buffer, bData.max);
+  }
+}
+
+/// Append a material properties matrix to a buffer
+void appendMatrix(std::vector<char>& buffer,
+                  const Acts::MaterialPropertiesMatrix& matrix) {
+  uint32_t n1 = matrix.size();
+  uint32_t n0 = matrix.empty() ? 0 : matrix.front().size();
+  append(buffer, n1);
+  append(buffer, n0);
+  for (const auto& mpVector : matrix) {
+    if (mpVector.size() != n0) {
+      throw std::invalid_argument("Inconsistent material matrix dimensions");
+    }
+    for (const auto& mp : mpVector) {
+      std::array<float, 6> parameters = {0, 0, 0, 0, 0, 0};
+      if (mp) {
+        parameters = {mp.material().X0(), mp.material().L0(),
+                      mp.material().Ar(), mp.material().Z(),
+                      mp.material().massDensity(), mp.thickness()};
+      }
+      append(buffer, parameters);
+    }
+  }
+}
+
+}  // namespace
+
+Acts::BinaryMaterialMap::BinaryMaterialMap(
+    const Acts::BinaryMaterialMap::Config& cfg, const std::string& fileName)
+    : m_cfg(cfg), m_file(fileName, std::ios::binary) {
+  // Validate the configuration
+  if (!m_cfg.logger) {
+    throw std::invalid_argument("Missing logger");
+  }
+  if (!m_file) {
+    throw std::invalid_argument("Could not open binary material map '" +
+                                fileName + "'");
+  }
+  // Read and check the header
+  std::array<char, 8> magic;
+  uint32_t version = 0;
+  uint32_t reserved = 0;
+  uint64_t nEntries = 0;
+  m_file.read(magic.data(), magic.size());
+  m_file.read(reinterpret_cast<char*>(&version), sizeof(version));
+  m_file.read(reinterpret_cast<char*>(&reserved), sizeof(reserved));
+  m_file.read(reinterpret_cast<char*>(&nEntries), sizeof(nEntries));
+  if (!m_file or magic != s_magic) {
+    throw std::invalid_argument("'" + fileName +
+                                "' is not a binary material map");
+  }
+  if (version != s_version) {
+    throw std::invalid_argument("Unsupported binary material map version " +
+                                std::to_string(version));
+  }
+  // Read the index
+  m_index.resize(nEntries);
+  for (auto& entry : m_index) {
+    m_file.read(reinterpret_cast<char*>(&entry.geoID), sizeof(entry.geoID));
+    m_file.read(reinterpret_cast<char*>(&entry.offset), sizeof(entry.offset));
+    m_file.read(reinterpret_cast<char*>(&entry.size), sizeof(entry.size));
+  }
+  if (!m_file) {
+    throw std::runtime_error("Truncated binary material map index");
+  }
+  ACTS_VERBOSE("Read index with " << nEntries << " entries from '" << fileName
+                                  << "'");
+}
+
+std::vector<Acts::BinaryMaterialMap::IndexEntry>::const_iterator
+Acts::BinaryMaterialMap::find(const GeometryID& geoID) const {
+  auto entry = std::lower_bound(
+      m_index.begin(), m_index.end(), geoID.value(),
+      [](const IndexEntry& e, GeometryID::Value v) { return e.geoID < v; });
+  if (entry == m_index.end() or entry->geoID != geoID.value()) {
+    return m_index.end();
+  }
+  return entry;
+}
+
+bool Acts::BinaryMaterialMap::contains(const GeometryID& geoID) const {
+  return find(geoID) != m_index.end();
+}
+
+std::shared_ptr<Acts::ISurfaceMaterial>
+Acts::BinaryMaterialMap::surfaceMaterial(const GeometryID& geoID) {
+  auto entry = find(geoID);
+  if (entry == m_index.end()) {
+    return nullptr;
+  }
+  std::lock_guard<std::mutex> lock(m_fileMutex);
+  return readSurfaceMaterial(*entry);
+}
+
+Acts::BinaryMaterialMap::SurfaceMaterialMap
+Acts::BinaryMaterialMap::surfaceMaterialMap() {
+  SurfaceMaterialMap surfaceMaterialMap;
+  std::lock_guard<std::mutex> lock(m_fileMutex);
+  // Blocks are written in index order, reading them in order avoids seeks
+  for (const auto& entry : m_index) {
+    surfaceMaterialMap.emplace_hint(surfaceMaterialMap.end(),
+                                    GeometryID(entry.geoID),
+                                    readSurfaceMaterial(entry));
+  }
+  ACTS_VERBOSE("Created surface material for " << surfaceMaterialMap.size()
+                                               << " surfaces");
+  return surfaceMaterialMap;
+}
+
+std::shared_ptr<Acts::ISurfaceMaterial>
+Acts::BinaryMaterialMap::readSurfaceMaterial(const IndexEntry& entry) {
+  m_buffer.resize(entry.size);
+  m_file.seekg(entry.offset);
+  m_file.read(m_buffer.data(), entry.size);
+  if (!m_file) {
+    throw std::runtime_error("Could not read binary material map block");
+  }
+
+  BlockReader reader(m_buffer);
+  auto type = static_cast<Type>(reader.read<uint8_t>());
+  // The binning
+  BinUtility bUtility;
+  auto nBinDims = reader.read<uint8_t>();
+  for (uint8_t ibin = 0; ibin < nBinDims; ++ibin) {
+    auto bValue = static_cast<BinningValue>(reader.read<uint8_t>());
+    auto bOption = static_cast<BinningOption>(reader.read<uint8_t>());
+    auto bins = reader.read<uint32_t>();
+    auto min = reader.read<float>();
+    auto max = reader.read<float>();
+    bUtility += BinUtility(bins, min, max, bOption, bValue);
+  }
+  if (type == Type::Proto) {
+    return std::make_shared<ProtoSurfaceMaterial>(bUtility);
+  }
+  // The material matrix
+  auto n1 = reader.read<uint32_t>();
+  auto n0 = reader.read<uint32_t>();
+  MaterialPropertiesMatrix mpMatrix(n1);
+  for (auto& mpVector : mpMatrix) {
+    mpVector.reserve(n0);
+    for (uint32_t i0 = 0; i0 < n0; ++i0) {
+      auto p = reader.read<std::array<float, 6>>();
+      if (p[2] > 0.) {
+        mpVector.emplace_back(p[0], p[1], p[2], p[3], p[4], p[5]);
+      } else {
+        mpVector.emplace_back();
+      }
+    }
+  }
+  if (type == Type::Homogeneous) {
+    if (n1 != 1 or n0 != 1) {
+      throw std::runtime_error("Invalid homogeneous material block");
+    }
+    return std::make_shared<HomogeneousSurfaceMaterial>(mpMatrix[0][0]);
+  }
+  return std::make_shared<BinnedSurfaceMaterial>(bUtility,
+                                                 std::move(mpMatrix));
+}
+
+void Acts::BinaryMaterialMap::write(
+    const std::string& fileName, const SurfaceMaterialMap& surfaceMaterialMap) {
+  std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+  if (!file) {
+    throw std::invalid_argument("Could not open '" + fileName +
+                                "' for writing");
+  }
+  // The header
+  uint64_t nEntries = surfaceMaterialMap.size();
+  uint32_t reserved = 0;
+  file.write(s_magic.data(), s_magic.size());
+  file.write(reinterpret_cast<const char*>(&s_version), sizeof(s_version));
+  file.write(reinterpret_cast<const char*>(&reserved), sizeof(reserved));
+  file.write(reinterpret_cast<const char*>(&nEntries), sizeof(nEntries));
+
+  // The data blocks follow the index, std::map keeps them sorted by geoID
+  std::vector<IndexEntry> index;
+  index.reserve(nEntries);
+  uint64_t offset = s_headerSize + nEntries * s_indexEntrySize;
+  file.seekp(offset);
+  std::vector<char> buffer;
+  for (const auto& [geoID, sMaterial] : surfaceMaterialMap) {
+    buffer.clear();
+    if (auto psm = dynamic_cast<const ProtoSurfaceMaterial*>(sMaterial.get())) {
+      append(buffer, Type::Proto);
+      appendBinning(buffer, psm->binUtility());
+    } else if (auto hsm = dynamic_cast<const HomogeneousSurfaceMaterial*>(
+                   sMaterial.get())) {
+      append(buffer, Type::Homogeneous);
+      append<uint8_t>(buffer, 0);
+      appendMatrix(buffer, {{hsm->materialProperties(0, 0)}});
+    } else if (auto bsm = dynamic_cast<const BinnedSurfaceMaterial*>(
+                   sMaterial.get())) {
+      append(buffer, Type::Binned);
+      appendBinning(buffer, bsm->binUtility());
+      appendMatrix(buffer, bsm->fullMaterial());
+    } else {
+      throw std::invalid_argument(
+          "Unsupported surface material type for binary material map");
+    }
+    file.write(buffer.data(), buffer.size());
+    index.push_back({geoID.value(), offset, buffer.size()});
+    offset += buffer.size();
+  }
+
+  // Fill in the index
+  file.seekp(s_headerSize);
+  for (const auto& entry : index) {
+    file.write(reinterpret_cast<const char*>(&entry.geoID),
+               sizeof(entry.geoID));
+    file.write(reinterpret_cast<const char*>(&entry.offset),
+               sizeof(entry.offset));
+    file.write(reinterpret_cast<const char*>(&entry.size), sizeof(entry.size));
+  }
+  if (!file) {
+    throw std::runtime_error("Could not write binary material map '" +
+                             fileName + "'");
+  }
+}
+
+bool Acts::BinaryMaterialMap::isBinaryMaterialMap(const std::string& fileName) {
+  std::ifstream file(fileName, std::ios::binary);
+  std::array<char, 8> magic;
+  file.read(magic.data(), magic.size());
+  return file and magic == s_magic;
+}
+
+void Acts::BinaryMaterialMap::convertJson(
+    const JsonGeometryConverter::Config& cfg, const std::string& jsonFileName,
+    const std::string& binaryFileName) {
+  std::ifstream ifj(jsonFileName);
+  if (!ifj) {
+    throw std::invalid_argument("Could not open '" + jsonFileName + "'");
+  }
+  nlohmann::json jin;
+  ifj >> jin;
+  JsonGeometryConverter jmConverter(cfg);
+  auto maps = jmConverter.jsonToMaterialMaps(jin);
+  write(binaryFileName, maps.first);
+}
@@ -0,0 +1,64 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Plugins/Json/LazySurfaceMaterial.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+Acts::LazySurfaceMaterial::LazySurfaceMaterial(
+    std::shared_ptr<BinaryMaterialMap> materialMap, const GeometryID& geoID)
+    : ISurfaceMaterial(),
+      m_materialMap(std::move(materialMap)),
+      m_geoID(geoID) {
+  if (!m_materialMap) {
+    throw std::invalid_argument("Missing binary material map");
+  }
+}
+
+Acts::LazySurfaceMaterial& Acts::LazySurfaceMaterial::operator*=(
+    double scale) {
+  load();
+  (*m_material) *= scale;
+  return (*this);
+}
+
+bool Acts::LazySurfaceMaterial::isLoaded() const {
+  return m_isLoaded.load(std::memory_order_acquire);
+}
+
+const Acts::ISurfaceMaterial& Acts::LazySurfaceMaterial::material() const {
+  // fast path without going through the once flag
+  if (!m_isLoaded.load(std::memory_order_acquire)) {
+    load();
+  }
+  return (*m_material);
+}
+
+void Acts::LazySurfaceMaterial::load() const {
+  std::call_once(m_loaded, [this]() {
+    auto sMaterial = m_materialMap->surfaceMaterial(m_geoID);
+    if (!sMaterial) {
+      throw std::runtime_error("No material for surface " +
+                               std::to_string(m_geoID.value()) +
+                               " in binary material map");
+    }
+    m_material = std::move(sMaterial);
+    m_isLoaded.store(true, std::memory_order_release);
+  });
+}
+
+std::ostream& Acts::LazySurfaceMaterial::toStream(std::ostream& sl) const {
+  if (isLoaded()) {
+    return m_material->toStream(sl);
+  }
+  sl << "Acts::LazySurfaceMaterial : not yet loaded for " << m_geoID
+     << std::endl;
+  return sl;
+}
@@ -12,14 +12,20 @@
 
 #pragma once
 #include <climits>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/Geometry/ILayerBuilder.hpp"
 #include "Acts/Geometry/LayerCreator.hpp"
 #include "Acts/Plugins/TGeo/ITGeoIdentifierProvider.hpp"
 #include "Acts/Utilities/Definitions.hpp"
 #include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/TaskPool.hpp"
 #include "Acts/Utilities/Units.hpp"
 
+class TGeoHMatrix;
 class TGeoMatrix;
 class TGeoVolume;
 class TGeoNode;
@@ -42,6 +48,9 @@ using namespace Acts::UnitLiterals;
 /// The parsing can be restricted to a given parse volume (in r and z),
 /// and given some splitting parameters the surfaces can be automatically be
 /// split into layers.
+///
+/// The geometry tree is parsed only once for all layer configurations, the
+/// matched sensor nodes are indexed by their layer and sensor name pattern.
 class TGeoLayerBuilder : public ILayerBuilder {
  public:
   ///  Helper config structs for volume parsin
@@ -108,6 +117,16 @@ class TGeoLayerBuilder : public ILayerBuilder {
     bool checkRingLayout = false;
     /// Tolerance for ring detection and association
     double ringTolerance = 0_mm;
+    /// Optional pool to convert the matched sensors concurrently, the
+    /// identifier provider has to be thread-safe in this case
+    /// @note ROOT needs to be made thread-safe with
+    /// `ROOT::EnableThreadSafety()` and the geometry of the gGeoManager must
+    /// not be modified during the build. The tree is only parsed sequentially.
+    std::shared_ptr<TaskPool> taskPool = nullptr;
+    /// Cross check the sensor index against a full parse of the tree for
+    /// every name pattern, the sensors and their order have to agree. This is
+    /// meant for validation only, a mismatch throws std::logic_error.
+    bool checkSensorIndex = false;
   };
 
   /// Constructor
@@ -171,23 +190,63 @@ class TGeoLayerBuilder : public ILayerBuilder {
   /// @todo make clear where the TGeoDetectorElement lives
   std::vector<std::shared_ptr<const TGeoDetectorElement>> m_elementStore;
 
-  /// Private helper function to parse the geometry tree
+  /// A sensor node matched in the geometry tree
+  struct SensorNode {
+    /// The matched node
+    TGeoNode* node = nullptr;
+    /// The global transform of the mother volume of the node
+    std::shared_ptr<const TGeoHMatrix> motherTransform = nullptr;
+  };
+
+  /// The matched sensor nodes per (layer name, sensor name) pattern, in the
+  /// order of the geometry tree
+  std::map<std::pair<std::string, std::string>, std::vector<SensorNode>>
+      m_sensorIndex;
+
+  /// The top volume the sensor index was built for
+  const TGeoVolume* m_indexedVolume = nullptr;
+
+  /// Private helper function to index the geometry tree
+  ///
+  /// Parses the tree once and records the sensor nodes for the name
+  /// patterns of all layer configurations. A sensor matches if its node
+  /// name matches the sensor name and it lies in a volume branch that
+  /// matches the layer name, the parsing stops at a matched sensor.
+  ///
+  /// @param tgVolume is the top volume
+  void buildIndex(TGeoVolume* tgVolume);
+
+  /// Private helper function to collect the sensors of a name pattern with a
+  /// full recursive parse of the tree, used to cross check the index
   ///
-  /// @param gcts the geometry context of this call
-  /// @param layerSurfaces are the surfaces that build the layer
   /// @param tgVolume is the current volume
   /// @param tgNode the current Node (branch)
   /// @param tgTransform is the current relative transform
+  /// @param layerName is the layer name pattern
+  /// @param sensorName is the sensor name pattern
+  /// @param correctBranch is the branch hit
+  /// @param sensors are the collected sensors in tree order
+  void collectSensors(TGeoVolume* tgVolume, TGeoNode* tgNode,
+                      const TGeoMatrix& tgTransform,
+                      const std::string& layerName,
+                      const std::string& sensorName, bool correctBranch,
+                      std::vector<SensorNode>& sensors) const;
+
+  /// Private helper function to cross check the index with collectSensors
+  ///
+  /// @param tgVolume is the top volume
+  void checkIndex(TGeoVolume* tgVolume) const;
+
+  /// Private helper function to convert the indexed sensors of a layer
+  ///
+  /// @param gcts the geometry context of this call
+  /// @param layerSurfaces are the surfaces that build the layer
   /// @param layerConfig is the configuration to be filled
   /// @param type is ( n | c | p ) as of  ( -1 | 0 | 1 )
-  /// @param correctBranch is the branch hit
-  /// @param offset is a string offset for the screen output
   void resolveSensitive(
       const GeometryContext& gctx,
       std::vector<std::shared_ptr<const Surface>>& layerSurfaces,
-      TGeoVolume* tgVolume, TGeoNode* tgNode, const TGeoMatrix& tgTransform,
-      LayerConfig& layerConfig, int type, bool correctBranch = false,
-      const std::string& offset = "");
+      LayerConfig& layerConfig, int type);
 
   /// Private helper method : build layers
   ///
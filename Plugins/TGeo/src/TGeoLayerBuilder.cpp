@@ -8,6 +8,10 @@
 
 #include "Acts/Plugins/TGeo/TGeoLayerBuilder.hpp"
 #include <stdio.h>
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
 #include "Acts/Geometry/ProtoLayer.hpp"
 #include "Acts/Plugins/TGeo/TGeoDetectorElement.hpp"
 #include "TGeoManager.h"
@@ -25,6 +29,9 @@ Acts::TGeoLayerBuilder::~TGeoLayerBuilder() = default;
 void Acts::TGeoLayerBuilder::setConfiguration(
     const Acts::TGeoLayerBuilder::Config& config) {
   m_cfg = config;
+  // The name patterns may have changed, the index is rebuilt on demand
+  m_sensorIndex.clear();
+  m_indexedVolume = nullptr;
 }
 
 void Acts::TGeoLayerBuilder::setLogger(
@@ -96,9 +103,10 @@ void Acts::TGeoLayerBuilder::buildLayers(const GeometryContext& gctx,
     // Step down from the top volume each time to collect the logical tree
     TGeoVolume* tvolume = gGeoManager->GetTopVolume();
     if (tvolume != nullptr) {
-      // Recursively step down
-      resolveSensitive(gctx, layerSurfaces, tvolume, nullptr, TGeoIdentity(),
-                       layerCfg, type);
+      // Index the tree for all configurations, done only once
+      buildIndex(tvolume);
+      // Convert the sensors of this configuration
+      resolveSensitive(gctx, layerSurfaces, layerCfg, type);
       // screen output
       ACTS_DEBUG(
           "- number of senstive sensors found : " << layerSurfaces.size());
@@ -236,55 +244,214 @@ void Acts::TGeoLayerBuilder::buildLayers(const GeometryContext& gctx,
   }
 }
 
-void Acts::TGeoLayerBuilder::resolveSensitive(
-    const GeometryContext& gctx,
-    std::vector<std::shared_ptr<const Acts::Surface>>& layerSurfaces,
+void Acts::TGeoLayerBuilder::buildIndex(TGeoVolume* tgVolume) {
+  if (tgVolume == m_indexedVolume) {
+    return;
+  }
+  m_sensorIndex.clear();
+  m_indexedVolume = tgVolume;
+
+  // The distinct name patterns of all configurations
+  using NamePattern = std::pair<std::string, std::string>;
+  std::vector<const NamePattern*> patterns;
+  std::vector<std::vector<SensorNode>*> patternSensors;
+  for (const auto& layerConfigs : m_cfg.layerConfigurations) {
+    for (const auto& layerCfg : layerConfigs) {
+      auto inserted = m_sensorIndex.emplace(
+          NamePattern(layerCfg.layerName, layerCfg.sensorName),
+          std::vector<SensorNode>{});
+      if (inserted.second) {
+        patterns.push_back(&inserted.first->first);
+        patternSensors.push_back(&inserted.first->second);
+      }
+    }
+  }
+  ACTS_DEBUG("Indexing the geometry tree for " << patterns.size()
+                                               << " name pattern(s).");
+
+  auto matches = [this](const std::string& wc, const char* name) -> bool {
+    return std::string(name).find(wc) != std::string::npos ||
+           match(wc.c_str(), name);
+  };
+  // Volumes and nodes are visited once per placement, cache the name checks
+  std::unordered_map<const TGeoVolume*, std::vector<bool>> layerMatches;
+  std::unordered_map<const TGeoNode*, std::vector<bool>> sensorMatches;
+  auto layerMatch = [&](const TGeoVolume* volume) -> const std::vector<bool>& {
+    auto it = layerMatches.find(volume);
+    if (it == layerMatches.end()) {
+      std::vector<bool> volumeMatches(patterns.size());
+      for (size_t jp = 0; jp < patterns.size(); ++jp) {
+        volumeMatches[jp] = matches(patterns[jp]->first, volume->GetName());
+      }
+      it = layerMatches.emplace(volume, std::move(volumeMatches)).first;
+    }
+    return it->second;
+  };
+  auto sensorMatch = [&](const TGeoNode* node) -> const std::vector<bool>& {
+    auto it = sensorMatches.find(node);
+    if (it == sensorMatches.end()) {
+      std::vector<bool> nodeMatches(patterns.size());
+      for (size_t jp = 0; jp < patterns.size(); ++jp) {
+        nodeMatches[jp] = matches(patterns[jp]->second, node->GetName());
+      }
+      it = sensorMatches.emplace(node, std::move(nodeMatches)).first;
+    }
+    return it->second;
+  };
+
+  // A node still to be parsed, with the patterns that are still searched
+  // for and whether their layer branch has been hit above the node
+  struct PendingNode {
+    TGeoNode* node = nullptr;
+    std::shared_ptr<const TGeoHMatrix> motherTransform = nullptr;
+    std::vector<std::pair<size_t, bool>> branches;
+  };
+  std::vector<PendingNode> pending;
+
+  // Check the volume for the layer names and queue its daughters, in
+  // reverse order such that the tree is parsed depth first and in order
+  auto queueDaughters = [&](TGeoVolume* volume,
+                            const std::shared_ptr<const TGeoHMatrix>& transform,
+                            std::vector<std::pair<size_t, bool>> branches) {
+    if (volume == nullptr or volume->GetNdaughters() == 0) {
+      return;
+    }
+    for (auto& [ip, branchHit] : branches) {
+      if (not branchHit and layerMatch(volume)[ip]) {
+        branchHit = true;
+        ACTS_VERBOSE("Volume " << volume->GetName() << " triggered branch '"
+                               << patterns[ip]->first << "'.");
+      }
+    }
+    for (int id = volume->GetNdaughters() - 1; id >= 0; --id) {
+      pending.push_back({volume->GetNode(id), transform, branches});
+    }
+  };
+
+  std::vector<std::pair<size_t, bool>> topBranches;
+  for (size_t ip = 0; ip < patterns.size(); ++ip) {
+    topBranches.emplace_back(ip, false);
+  }
+  queueDaughters(tgVolume, std::make_shared<const TGeoHMatrix>(),
+                 std::move(topBranches));
+
+  size_t nNodes = 0;
+  while (not pending.empty()) {
+    PendingNode current = std::move(pending.back());
+    pending.pop_back();
+    ++nNodes;
+    // Record the sensors, the search for their pattern ends there
+    std::vector<std::pair<size_t, bool>> branches;
+    for (const auto& [ip, branchHit] : current.branches) {
+      // Single layer depth supported by sensor==layer
+      if ((branchHit or patterns[ip]->first == patterns[ip]->second) and
+          sensorMatch(current.node)[ip]) {
+        ACTS_VERBOSE("Sensor name '" << patterns[ip]->second
+                                     << "' found in branch '"
+                                     << patterns[ip]->first << "'.");
+        patternSensors[ip]->push_back({current.node, current.motherTransform});
+      } else {
+        branches.emplace_back(ip, branchHit);
+      }
+    }
+    // Step down for the remaining patterns
+    TGeoVolume* nodeVolume = current.node->GetVolume();
+    if (not branches.empty() and nodeVolume != nullptr and
+        nodeVolume->GetNdaughters() > 0) {
+      auto nTransform = std::make_shared<const TGeoHMatrix>(
+          TGeoCombiTrans(*current.motherTransform) *
+          TGeoCombiTrans(*current.node->GetMatrix()));
+      queueDaughters(nodeVolume, nTransform, std::move(branches));
+    }
+  }
+  ACTS_DEBUG("- parsed " << nNodes << " nodes.");
+
+  if (m_cfg.checkSensorIndex) {
+    checkIndex(tgVolume);
+  }
+}
+
+void Acts::TGeoLayerBuilder::collectSensors(
     TGeoVolume* tgVolume, TGeoNode* tgNode, const TGeoMatrix& tgTransform,
-    LayerConfig& layerConfig, int type, bool correctBranch,
-    const std::string& offset) {
+    const std::string& layerName, const std::string& sensorName,
+    bool correctBranch, std::vector<SensorNode>& sensors) const {
   if (tgVolume != nullptr) {
     std::string volumeName = tgVolume->GetName();
-    /// Some screen output indicating that the volume was found
-    ACTS_VERBOSE(offset << "[o] Volume : " << volumeName
-                        << " - checking for volume name "
-                        << layerConfig.layerName);
-
     // Once in the current branch stepping down means staying inside the branch
-    bool correctVolume = correctBranch;
-    if (!correctVolume &&
-        (volumeName.find(layerConfig.layerName) != std::string::npos ||
-         match(layerConfig.layerName.c_str(), volumeName.c_str()))) {
-      correctVolume = true;
-      ACTS_VERBOSE(offset << "    triggered current branch!");
-    }
+    bool correctVolume =
+        correctBranch || volumeName.find(layerName) != std::string::npos ||
+        match(layerName.c_str(), volumeName.c_str());
     // Loop over the daughters and collect them
-    auto daugthers = tgVolume->GetNodes();
-    // Screen output
-    ACTS_VERBOSE(offset << "has " << tgVolume->GetNdaughters()
-                        << " daughters.");
-    // A daughter iterator
-    TIter iObj(daugthers);
-    // While loop over the objects for the recursive parsing
+    TIter iObj(tgVolume->GetNodes());
     while (TObject* obj = iObj()) {
-      // dynamic_cast to a node
       TGeoNode* node = dynamic_cast<TGeoNode*>(obj);
       if (node != nullptr) {
-        resolveSensitive(gctx, layerSurfaces, nullptr, node, tgTransform,
-                         layerConfig, type, correctVolume, offset + "  ");
+        collectSensors(nullptr, node, tgTransform, layerName, sensorName,
+                       correctVolume, sensors);
       }
     }
-  } else {
-    ACTS_VERBOSE("No volume present.");
   }
 
-  /// If you have a node, get the volume and step down further
   if (tgNode != nullptr) {
-    // Get the matrix of the current node for positioning
-    const TGeoMatrix* tgMatrix = tgNode->GetMatrix();
+    std::string tNodeName = tgNode->GetName();
+    // Find out the branch hit, single layer depth supported by sensor==layer
+    bool branchHit = correctBranch || (sensorName == layerName);
+    if (branchHit && (tNodeName.find(sensorName) != std::string::npos ||
+                      match(sensorName.c_str(), tNodeName.c_str()))) {
+      sensors.push_back(
+          {tgNode, std::make_shared<const TGeoHMatrix>(tgTransform)});
+    } else {
+      // This is not yet the senstive one, step down
+      TGeoHMatrix nTransform =
+          TGeoCombiTrans(tgTransform) * TGeoCombiTrans(*tgNode->GetMatrix());
+      collectSensors(tgNode->GetVolume(), nullptr, nTransform, layerName,
+                     sensorName, correctBranch, sensors);
+    }
+  }
+}
+
+void Acts::TGeoLayerBuilder::checkIndex(TGeoVolume* tgVolume) const {
+  for (const auto& [pattern, indexed] : m_sensorIndex) {
+    std::vector<SensorNode> parsed;
+    collectSensors(tgVolume, nullptr, TGeoIdentity(), pattern.first,
+                   pattern.second, false, parsed);
+    bool agree = (indexed.size() == parsed.size());
+    for (size_t is = 0; agree and is < parsed.size(); ++is) {
+      const auto& iTransform = *indexed[is].motherTransform;
+      const auto& pTransform = *parsed[is].motherTransform;
+      agree = indexed[is].node == parsed[is].node and
+              std::equal(iTransform.GetRotationMatrix(),
+                         iTransform.GetRotationMatrix() + 9,
+                         pTransform.GetRotationMatrix()) and
+              std::equal(iTransform.GetTranslation(),
+                         iTransform.GetTranslation() + 3,
+                         pTransform.GetTranslation());
+    }
+    if (not agree) {
+      throw std::logic_error(
+          "Sensor index of layer '" + pattern.first + "' and sensor '" +
+          pattern.second + "' differs from the full tree parse: " +
+          std::to_string(indexed.size()) + " indexed vs. " +
+          std::to_string(parsed.size()) + " parsed sensors.");
+    }
+    ACTS_DEBUG("- index of '" << pattern.first << "' / '" << pattern.second
+                              << "' agrees with the full tree parse.");
+  }
+}
+
+void Acts::TGeoLayerBuilder::resolveSensitive(
+    const GeometryContext& gctx,
+    std::vector<std::shared_ptr<const Acts::Surface>>& layerSurfaces,
+    LayerConfig& layerConfig, int type) {
+  const auto& sensors =
+      m_sensorIndex.at({layerConfig.layerName, layerConfig.sensorName});
 
+  // Select the sensors inside the parse range and on the requested side
+  std::vector<const SensorNode*> accepted;
+  for (const auto& sensor : sensors) {
     // Build the matrix
-    TGeoHMatrix parseTransform =
-        TGeoCombiTrans(tgTransform) * TGeoCombiTrans(*tgMatrix);
+    TGeoHMatrix parseTransform = TGeoCombiTrans(*sensor.motherTransform) *
+                                 TGeoCombiTrans(*sensor.node->GetMatrix());
 
     // The translation of the node for parsing
     const Double_t* translation = parseTransform.GetTranslation();
@@ -294,82 +461,67 @@ void Acts::TGeoLayerBuilder::resolveSensitive(
     double z = m_cfg.unit * translation[2];
     double r = std::sqrt(x * x + y * y);
 
-    // The name of the nodefor cross checking
-    std::string tNodeName = tgNode->GetName();
-    ACTS_VERBOSE(offset << "[>] Node : " << tNodeName
-                        << " - checking for sensor name "
-                        << layerConfig.sensorName);
-    // Find out the branch hit, ingle layer depth supported by sensor==layer
-    bool branchHit =
-        correctBranch || (layerConfig.sensorName == layerConfig.layerName);
-    if (branchHit &&
-        (tNodeName.find(layerConfig.sensorName) != std::string::npos ||
-         match(layerConfig.sensorName.c_str(), tNodeName.c_str()))) {
-      ACTS_VERBOSE(offset << "Sensor name '" << layerConfig.sensorName
-                          << "' found in branch '" << layerConfig.layerName
-                          << "'.");
-
-      // Create the detector element
-      // - check on the type for the side
-      // - check for the parsing volume
-      bool insideParseRange = r >= layerConfig.parseRangeR.first and
-                              r <= layerConfig.parseRangeR.second;
-
-      if (insideParseRange and ((type == 0) || type * z > 0.)) {
-        //  Senstive volume found, collect it
-        ACTS_VERBOSE(offset << "[>>] accepted.");
-        // Create the element
-        auto identifier =
-            m_cfg.identifierProvider != nullptr
-                ? m_cfg.identifierProvider->identify(gctx, *tgNode)
-                : Identifier();
-        auto tgElement = std::make_shared<const Acts::TGeoDetectorElement>(
-            identifier, tgNode, &tgTransform, layerConfig.localAxes,
-            m_cfg.unit);
-        // Record the element @todo solve with provided cache
-        m_elementStore.push_back(tgElement);
-        // Register the shared pointer to the surface for layer building
-        layerSurfaces.push_back(tgElement->surface().getSharedPtr());
-
-        // Record split range for eventual splitting
-        double surfaceR = tgElement->surface().binningPositionValue(gctx, binR);
-        double surfaceZ = tgElement->surface().binningPositionValue(gctx, binZ);
-
-        // Split in R if configured to do so
-        if (m_cfg.layerSplitToleranceR[type + 1] > 0.) {
-          registerSplit(layerConfig.splitParametersR, surfaceR,
-                        m_cfg.layerSplitToleranceR[type + 1],
-                        layerConfig.splitRangeR);
-        }
-        // Split in Z if configured to do so
-        if (m_cfg.layerSplitToleranceZ[type + 1] > 0.) {
-          registerSplit(layerConfig.splitParametersZ, surfaceZ,
-                        m_cfg.layerSplitToleranceZ[type + 1],
-                        layerConfig.splitRangeZ);
-        }
-      } else if (type * z < 0) {
-        ACTS_VERBOSE("[xx] cancelled by side check.");
-      } else if (not insideParseRange) {
-        ACTS_VERBOSE("[xx] cancelled by parse range on side " << type);
-        ACTS_VERBOSE("     r = " << r << " in ("
-                                 << layerConfig.parseRangeR.first << ", "
-                                 << layerConfig.parseRangeR.second << "] ?");
-      }
-    } else {
-      // This is not yet the senstive one
-      ACTS_VERBOSE(offset << "[<<] not accepted, stepping down.");
-      // Build the matrix
-      TGeoHMatrix nTransform =
-          TGeoCombiTrans(tgTransform) * TGeoCombiTrans(*tgMatrix);
-      std::string suffix = "_transform";
-      nTransform.SetName((tNodeName + suffix).c_str());
-      // If it's not accepted, get the associated volume
-      TGeoVolume* nodeVolume = tgNode->GetVolume();
-      // Now step down one further
-      resolveSensitive(gctx, layerSurfaces, nodeVolume, nullptr, nTransform,
-                       layerConfig, type, correctBranch, offset + "  ");
+    // - check on the type for the side
+    // - check for the parsing volume
+    bool insideParseRange = r >= layerConfig.parseRangeR.first and
+                            r <= layerConfig.parseRangeR.second;
+
+    if (insideParseRange and ((type == 0) || type * z > 0.)) {
+      //  Senstive volume found, collect it
+      ACTS_VERBOSE("[>>] Sensor " << sensor.node->GetName() << " accepted.");
+      accepted.push_back(&sensor);
+    } else if (type * z < 0) {
+      ACTS_VERBOSE("[xx] cancelled by side check.");
+    } else if (not insideParseRange) {
+      ACTS_VERBOSE("[xx] cancelled by parse range on side " << type);
+      ACTS_VERBOSE("     r = " << r << " in ("
+                               << layerConfig.parseRangeR.first << ", "
+                               << layerConfig.parseRangeR.second << "] ?");
     }
+  }
+
+  // Create the detector elements, they are independent of each other
+  std::vector<std::shared_ptr<const TGeoDetectorElement>> tgElements(
+      accepted.size());
+  auto createElement = [&](size_t ie) {
+    TGeoNode* tgNode = accepted[ie]->node;
+    auto identifier = m_cfg.identifierProvider != nullptr
+                          ? m_cfg.identifierProvider->identify(gctx, *tgNode)
+                          : Identifier();
+    tgElements[ie] = std::make_shared<const Acts::TGeoDetectorElement>(
+        identifier, tgNode, accepted[ie]->motherTransform.get(),
+        layerConfig.localAxes, m_cfg.unit);
+  };
+  if (m_cfg.taskPool) {
+    m_cfg.taskPool->parallelFor(tgElements.size(), createElement);
   } else {
-    ACTS_VERBOSE("No node present.");
+    for (size_t ie = 0; ie < tgElements.size(); ++ie) {
+      createElement(ie);
+    }
+  }
+
+  // Register them in the order of the geometry tree
+  for (const auto& tgElement : tgElements) {
+    // Record the element @todo solve with provided cache
+    m_elementStore.push_back(tgElement);
+    // Register the shared pointer to the surface for layer building
+    layerSurfaces.push_back(tgElement->surface().getSharedPtr());
+
+    // Record split range for eventual splitting
+    double surfaceR = tgElement->surface().binningPositionValue(gctx, binR);
+    double surfaceZ = tgElement->surface().binningPositionValue(gctx, binZ);
+
+    // Split in R if configured to do so
+    if (m_cfg.layerSplitToleranceR[type + 1] > 0.) {
+      registerSplit(layerConfig.splitParametersR, surfaceR,
+                    m_cfg.layerSplitToleranceR[type + 1],
+                    layerConfig.splitRangeR);
+    }
+    // Split in Z if configured to do so
+    if (m_cfg.layerSplitToleranceZ[type + 1] > 0.) {
+      registerSplit(layerConfig.splitParametersZ, surfaceZ,
+                    m_cfg.layerSplitToleranceZ[type + 1],
+                    layerConfig.splitRangeZ);
+    }
   }
 }
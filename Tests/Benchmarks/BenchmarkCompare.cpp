@@ -0,0 +1,111 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/program_options.hpp>
+
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+
+namespace po = boost::program_options;
+using Acts::Test::MicroBenchmarkSummary;
+
+namespace {
+
+std::vector<MicroBenchmarkSummary> readSummaries(const std::string& path) {
+  std::ifstream file(path);
+  if (not file) {
+    throw std::runtime_error("Could not open '" + path + "'");
+  }
+  return MicroBenchmarkSummary::readCsv(file);
+}
+
+}  // namespace
+
+// Compare benchmark summaries against a stored baseline.
+//
+// Both inputs are CSV files as written by `Acts::Test::writeCsv`. The exit
+// code is non-zero if at least one benchmark regressed, which allows using
+// this directly in continuous integration jobs.
+int main(int argc, char* argv[]) {
+  std::string baselinePath;
+  std::string currentPath;
+  double maxSlowdown = 0.05;
+  double minSignificance = 3.;
+
+  try {
+    po::options_description desc("Allowed options");
+    // clang-format off
+  desc.add_options()
+      ("help", "produce help message")
+      ("baseline",po::value<std::string>(&baselinePath)->required(),"baseline benchmark summaries (CSV)")
+      ("current",po::value<std::string>(&currentPath)->required(),"current benchmark summaries (CSV)")
+      ("max-slowdown",po::value<double>(&maxSlowdown)->default_value(maxSlowdown),"relative slowdown that is tolerated")
+      ("min-significance",po::value<double>(&minSignificance)->default_value(minSignificance),"minimal significance of a flagged slowdown in units of the robust error");
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+
+    if (vm.count("help") != 0u) {
+      std::cout << desc << std::endl;
+      return 0;
+    }
+    po::notify(vm);
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 2;
+  }
+
+  std::map<std::string, MicroBenchmarkSummary> baselines;
+  std::vector<MicroBenchmarkSummary> currents;
+  try {
+    for (auto& summary : readSummaries(baselinePath)) {
+      baselines.emplace(summary.name, std::move(summary));
+    }
+    currents = readSummaries(currentPath);
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 2;
+  }
+
+  size_t nRegressions = 0;
+  std::cout << std::fixed;
+  for (const auto& current : currents) {
+    auto baseline = baselines.find(current.name);
+    if (baseline == baselines.end()) {
+      std::cout << "NEW        " << current.name << ": " << std::setprecision(3)
+                << current.iter_time_average << "ns per iteration"
+                << std::endl;
+      continue;
+    }
+    const auto comparison = Acts::Test::compareToBaseline(
+        baseline->second, current, maxSlowdown, minSignificance);
+    nRegressions += comparison.is_regression ? 1u : 0u;
+    std::cout << (comparison.is_regression ? "REGRESSION " : "OK         ")
+              << comparison.name << ": " << std::setprecision(3)
+              << comparison.baseline_time << "ns -> "
+              << comparison.current_time << "ns per iteration ("
+              << std::showpos << std::setprecision(1)
+              << 100 * comparison.relative_change << "%, "
+              << comparison.significance << " sigma)" << std::noshowpos
+              << std::endl;
+    baselines.erase(baseline);
+  }
+  for (const auto& [name, baseline] : baselines) {
+    std::cout << "MISSING    " << name << std::endl;
+  }
+
+  std::cout << nRegressions << " regression(s) in " << currents.size()
+            << " benchmark(s)" << std::endl;
+  return (nRegressions == 0) ? 0 : 1;
+}
@@ -8,9 +8,11 @@
 
 #include <algorithm>
 #include <chrono>
+#include <fstream>
 #include <functional>
 #include <iostream>
 #include <random>
+#include <string>
 #include <vector>
 
 #include "Acts/Surfaces/BoundaryCheck.hpp"
@@ -20,7 +22,8 @@
 
 using namespace Acts;
 
-int main(int /*argc*/, char** /*argv[]*/) {
+// The optional argument is a CSV or JSON file for the benchmark summaries
+int main(int argc, char* argv[]) {
   // === PROBLEM DATA ===
 
   // Trapezoidal area of interest
@@ -62,13 +65,17 @@ int main(int /*argc*/, char** /*argv[]*/) {
   // We use this to switch between iteration counts
   enum class Mode { NoCheck, FastOutside, SlowOutside };
 
-  // Benchmark output display
-  auto print_bench_header = [](const std::string& check_name) {
+  // Benchmark output display and machine-readable summaries
+  std::vector<Acts::Test::MicroBenchmarkSummary> summaries;
+  std::string current_check;
+  auto print_bench_header = [&](const std::string& check_name) {
     std::cout << check_name << ":" << std::endl;
+    current_check = check_name;
   };
-  auto print_bench_result = [](const std::string& bench_name,
-                               const Acts::Test::MicroBenchmarkResult& res) {
+  auto print_bench_result = [&](const std::string& bench_name,
+                                const Acts::Test::MicroBenchmarkResult& res) {
     std::cout << "- " << bench_name << ": " << res << std::endl;
+    summaries.emplace_back(current_check + "/" + bench_name, res);
   };
 
   // Benchmark runner
@@ -127,5 +134,16 @@ int main(int /*argc*/, char** /*argv[]*/) {
                   Mode::SlowOutside);
   run_all_benches(BoundaryCheck(cov, 3.0), "Cov. tolerance", Mode::SlowOutside);
 
+  if (argc > 1) {
+    const std::string path = argv[1];
+    std::ofstream file(path);
+    if (path.size() > 5 and path.substr(path.size() - 5) == ".json") {
+      Acts::Test::writeJson(file, summaries);
+    } else {
+      Acts::Test::writeCsv(file, summaries);
+    }
+    std::cout << "Wrote benchmark summaries to " << path << std::endl;
+  }
+
   return 0;
 }
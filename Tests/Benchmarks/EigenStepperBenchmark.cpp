@@ -29,6 +29,7 @@ int main(int argc, char* argv[]) {
   double maxPathInM = 1;
   unsigned int lvl = Acts::Logging::INFO;
   bool withCov = true;
+  bool useFloat = false;
 
   // Create a test context
   GeometryContext tgContext = GeometryContext();
@@ -44,6 +45,7 @@ int main(int argc, char* argv[]) {
       ("B",po::value<double>(&BzInT)->default_value(2),"z-component of B-field in T")
       ("path",po::value<double>(&maxPathInM)->default_value(5),"maximum path length in m")
       ("cov",po::value<bool>(&withCov)->default_value(true),"propagation with covariance matrix")
+      ("float",po::value<bool>(&useFloat)->default_value(false),"Runge-Kutta stages in single precision")
       ("verbose",po::value<unsigned int>(&lvl)->default_value(Acts::Logging::INFO),"logging level");
     // clang-format on
     po::variables_map vm;
@@ -64,16 +66,18 @@ int main(int argc, char* argv[]) {
 
   // print information about profiling setup
   ACTS_INFO("propagating " << toys << " tracks with pT = " << ptInGeV
-                           << "GeV in a " << BzInT << "T B-field");
+                           << "GeV in a " << BzInT << "T B-field"
+                           << (useFloat ? " with single precision stages"
+                                        : ""));
 
   using BField_type = ConstantBField;
   using Stepper_type = EigenStepper<BField_type>;
-  using Propagator_type = Propagator<Stepper_type>;
+  using FloatStepper_type =
+      EigenStepper<BField_type, StepperExtensionList<DefaultExtension>,
+                   detail::VoidAuctioneer, float>;
   using Covariance = BoundSymMatrix;
 
   BField_type bField(0, 0, BzInT * UnitConstants::T);
-  Stepper_type atlas_stepper(std::move(bField));
-  Propagator_type propagator(std::move(atlas_stepper));
 
   PropagatorOptions<> options(tgContext, mfContext);
   options.pathLimit = maxPathInM * UnitConstants::m;
@@ -98,21 +102,27 @@ int main(int argc, char* argv[]) {
 
   double totalPathLength = 0;
   size_t num_iters = 0;
-  const auto propagation_bench_result = Acts::Test::microBenchmark(
-      [&] {
-        auto r = propagator.propagate(pars, options).value();
-        if (totalPathLength == 0.) {
-          ACTS_DEBUG("reached position ("
-                     << r.endParameters->position().x() << ", "
-                     << r.endParameters->position().y() << ", "
-                     << r.endParameters->position().z() << ") in " << r.steps
-                     << " steps");
-        }
-        totalPathLength += r.pathLength;
-        ++num_iters;
-        return r;
-      },
-      1, toys);
+  auto runBenchmark = [&](auto stepper) {
+    Propagator<decltype(stepper)> propagator(std::move(stepper));
+    return Acts::Test::microBenchmark(
+        [&] {
+          auto r = propagator.propagate(pars, options).value();
+          if (totalPathLength == 0.) {
+            ACTS_DEBUG("reached position ("
+                       << r.endParameters->position().x() << ", "
+                       << r.endParameters->position().y() << ", "
+                       << r.endParameters->position().z() << ") in "
+                       << r.steps << " steps");
+          }
+          totalPathLength += r.pathLength;
+          ++num_iters;
+          return r;
+        },
+        1, toys);
+  };
+  const auto propagation_bench_result =
+      useFloat ? runBenchmark(FloatStepper_type(bField))
+               : runBenchmark(Stepper_type(bField));
 
   ACTS_INFO("Execution stats: " << propagation_bench_result);
   ACTS_INFO("average path length = " << totalPathLength / num_iters / 1_mm
@@ -0,0 +1,334 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/program_options.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/Navigator.hpp"
+#include "Acts/Propagator/StraightLineStepper.hpp"
+#include "Acts/Tests/CommonHelpers/CylindricalTrackingGeometry.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/UnitVectors.hpp"
+#include "Acts/Utilities/Units.hpp"
+#include "ActsFatras/EventData/HitContainer.hpp"
+#include "ActsFatras/EventData/ParticleContainer.hpp"
+#include "ActsFatras/Kernel/PhysicsList.hpp"
+#include "ActsFatras/Kernel/Simulator.hpp"
+#include "ActsFatras/Physics/StandardPhysicsLists.hpp"
+#include "ActsFatras/Selectors/ChargeSelectors.hpp"
+
+namespace po = boost::program_options;
+using namespace Acts::UnitLiterals;
+using Acts::Logger;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/// Names of the timed physics processes, in physics list order
+const std::array<const char*, 3> s_processNames = {
+    "Highland scattering", "Bethe-Bloch", "Bethe-Heitler"};
+
+/// Work counters, filled thread-locally and merged at the end of a run
+struct Counters {
+  size_t events = 0;
+  size_t particles = 0;
+  size_t failed = 0;
+  size_t steps = 0;
+  size_t hits = 0;
+  std::array<Clock::duration, 3> processTime = {};
+
+  Counters& operator+=(const Counters& other) {
+    events += other.events;
+    particles += other.particles;
+    failed += other.failed;
+    steps += other.steps;
+    hits += other.hits;
+    for (size_t ip = 0; ip < processTime.size(); ++ip) {
+      processTime[ip] += other.processTime[ip];
+    }
+    return *this;
+  }
+};
+
+thread_local Counters t_counters;
+
+/// Physics process that accumulates the time spent in it
+template <typename process_t, size_t kProcess>
+struct TimedProcess : public process_t {
+  template <typename generator_t>
+  bool operator()(generator_t& generator, const Acts::MaterialProperties& slab,
+                  ActsFatras::Particle& particle,
+                  std::vector<ActsFatras::Particle>& generated) const {
+    const auto start = Clock::now();
+    bool stop = process_t::operator()(generator, slab, particle, generated);
+    t_counters.processTime[kProcess] += Clock::now() - start;
+    return stop;
+  }
+};
+
+/// Propagator that counts the propagation steps
+template <typename propagator_t>
+struct CountingPropagator {
+  using Propagator = propagator_t;
+
+  propagator_t propagator;
+
+  template <typename parameters_t, typename propagator_options_t>
+  auto propagate(const parameters_t& start,
+                 const propagator_options_t& options) const {
+    auto result = propagator.propagate(start, options);
+    if (result.ok()) {
+      t_counters.steps += result.value().steps;
+    }
+    return result;
+  }
+};
+
+// propagate charged particles numerically, neutral ones along straight lines
+using Navigator = Acts::Navigator;
+using ChargedStepper = Acts::EigenStepper<Acts::ConstantBField>;
+using ChargedPropagator =
+    CountingPropagator<Acts::Propagator<ChargedStepper, Navigator>>;
+using NeutralStepper = Acts::StraightLineStepper;
+using NeutralPropagator =
+    CountingPropagator<Acts::Propagator<NeutralStepper, Navigator>>;
+
+// the standard electro-magnetic physics list with timed processes
+using TimedPhysicsList = ActsFatras::PhysicsList<
+    TimedProcess<ActsFatras::detail::StandardScattering, 0>,
+    TimedProcess<ActsFatras::detail::StandardBetheBloch, 1>,
+    TimedProcess<ActsFatras::detail::StandardBetheHeitler, 2>>;
+
+using Generator = std::mt19937;
+using ChargedSimulator =
+    ActsFatras::ParticleSimulator<ChargedPropagator, TimedPhysicsList,
+                                  ActsFatras::EverySurface>;
+using NeutralSimulator =
+    ActsFatras::ParticleSimulator<NeutralPropagator, ActsFatras::PhysicsList<>,
+                                  ActsFatras::NoSurface>;
+using Simulator =
+    ActsFatras::Simulator<ActsFatras::ChargedSelector, ChargedSimulator,
+                          ActsFatras::NeutralSelector, NeutralSimulator>;
+
+/// Event generation settings
+struct EventConfig {
+  /// particle gun: number, type, momentum and eta range
+  size_t gunParticles = 10;
+  Acts::PdgParticle gunPdg = Acts::PdgParticle::eMuon;
+  double gunPMin = 1_GeV;
+  double gunPMax = 10_GeV;
+  double etaMax = 2.5;
+  /// pile-up: mean number of vertices and charged pions per vertex
+  double pileup = 0.;
+  size_t pileupParticles = 20;
+  /// longitudinal vertex spread
+  double sigmaZ = 50_mm;
+  /// lower p cut for the generated secondaries
+  double pMin = 50_MeV;
+};
+
+/// Generate the input particles of one event
+std::vector<ActsFatras::Particle> generateEvent(const EventConfig& cfg,
+                                                Generator& rng) {
+  std::uniform_real_distribution<double> phiDist(-M_PI, M_PI);
+  std::uniform_real_distribution<double> etaDist(-cfg.etaMax, cfg.etaMax);
+  std::uniform_real_distribution<double> gunPDist(cfg.gunPMin, cfg.gunPMax);
+  std::exponential_distribution<double> pileupPtDist(1 / 0.4_GeV);
+  std::normal_distribution<double> zDist(0., cfg.sigmaZ);
+  std::poisson_distribution<size_t> nPileupDist(cfg.pileup);
+  std::bernoulli_distribution chargeDist(0.5);
+
+  std::vector<ActsFatras::Particle> particles;
+  // hard scatter vertex at the origin
+  for (size_t ip = 0; ip < cfg.gunParticles; ++ip) {
+    const auto pid =
+        ActsFatras::Barcode().setVertexPrimary(1).setParticle(ip + 1);
+    particles.push_back(
+        ActsFatras::Particle(pid, cfg.gunPdg)
+            .setDirection(Acts::makeDirectionUnitFromPhiEta(phiDist(rng),
+                                                            etaDist(rng)))
+            .setAbsMomentum(gunPDist(rng)));
+  }
+  // soft pile-up vertices spread along the beam line
+  const size_t nPileup = cfg.pileup > 0. ? nPileupDist(rng) : 0;
+  for (size_t iv = 0; iv < nPileup; ++iv) {
+    const double z = zDist(rng);
+    for (size_t ip = 0; ip < cfg.pileupParticles; ++ip) {
+      const auto pid =
+          ActsFatras::Barcode().setVertexPrimary(iv + 2).setParticle(ip + 1);
+      const auto pdg = chargeDist(rng) ? Acts::PdgParticle::ePionPlus
+                                       : Acts::PdgParticle::ePionMinus;
+      const double eta = etaDist(rng);
+      const double pt = 0.1_GeV + pileupPtDist(rng);
+      particles.push_back(
+          ActsFatras::Particle(pid, pdg)
+              .setPosition4(0., 0., z, 0.)
+              .setDirection(
+                  Acts::makeDirectionUnitFromPhiEta(phiDist(rng), eta))
+              .setAbsMomentum(pt * std::cosh(eta)));
+    }
+  }
+  return particles;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  size_t nEvents = 100;
+  size_t maxThreads = std::max(1u, std::thread::hardware_concurrency());
+  double BzInT = 2;
+  unsigned int seed = 42;
+  unsigned int lvl = Acts::Logging::INFO;
+  EventConfig eventCfg;
+  int gunPdg = eventCfg.gunPdg;
+  double gunPMinInGeV = eventCfg.gunPMin / 1_GeV;
+  double gunPMaxInGeV = eventCfg.gunPMax / 1_GeV;
+
+  try {
+    po::options_description desc("Allowed options");
+    // clang-format off
+  desc.add_options()
+      ("help", "produce help message")
+      ("events",po::value<size_t>(&nEvents)->default_value(nEvents),"number of events per thread configuration")
+      ("threads",po::value<size_t>(&maxThreads)->default_value(maxThreads),"run with 1..N threads")
+      ("gun-particles",po::value<size_t>(&eventCfg.gunParticles)->default_value(eventCfg.gunParticles),"particle gun multiplicity")
+      ("gun-pdg",po::value<int>(&gunPdg)->default_value(gunPdg),"particle gun pdg code")
+      ("gun-pmin",po::value<double>(&gunPMinInGeV)->default_value(gunPMinInGeV),"particle gun minimum momentum in GeV")
+      ("gun-pmax",po::value<double>(&gunPMaxInGeV)->default_value(gunPMaxInGeV),"particle gun maximum momentum in GeV")
+      ("eta",po::value<double>(&eventCfg.etaMax)->default_value(eventCfg.etaMax),"maximum absolute eta of the generated particles")
+      ("pileup",po::value<double>(&eventCfg.pileup)->default_value(eventCfg.pileup),"mean number of pile-up vertices")
+      ("pileup-particles",po::value<size_t>(&eventCfg.pileupParticles)->default_value(eventCfg.pileupParticles),"charged pions per pile-up vertex")
+      ("B",po::value<double>(&BzInT)->default_value(BzInT),"z-component of B-field in T")
+      ("seed",po::value<unsigned int>(&seed)->default_value(seed),"random seed")
+      ("verbose",po::value<unsigned int>(&lvl)->default_value(Acts::Logging::INFO),"logging level");
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help") != 0u) {
+      std::cout << desc << std::endl;
+      return 0;
+    }
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
+  }
+  eventCfg.gunPdg = static_cast<Acts::PdgParticle>(gunPdg);
+  eventCfg.gunPMin = gunPMinInGeV * 1_GeV;
+  eventCfg.gunPMax = gunPMaxInGeV * 1_GeV;
+
+  auto myLogger = Acts::getDefaultLogger("Fatras", Acts::Logging::Level(lvl));
+  ACTS_LOCAL_LOGGER(std::move(myLogger));
+
+  Acts::GeometryContext geoCtx;
+  Acts::MagneticFieldContext magCtx;
+
+  // the detector and the simulator, shared by all threads
+  Acts::Test::CylindricalTrackingGeometry geoBuilder(geoCtx);
+  auto trackingGeometry = geoBuilder();
+  Navigator navigator(trackingGeometry);
+  ChargedPropagator chargedPropagator{ChargedPropagator::Propagator(
+      ChargedStepper(Acts::ConstantBField(0, 0, BzInT * 1_T)), navigator)};
+  NeutralPropagator neutralPropagator{
+      NeutralPropagator::Propagator(NeutralStepper(), navigator)};
+  ChargedSimulator chargedSimulator(std::move(chargedPropagator),
+                                    Acts::Logging::WARNING);
+  chargedSimulator.physics.get<1>().selectOutputParticle.valMin =
+      eventCfg.pMin;
+  chargedSimulator.physics.get<2>().selectOutputParticle.valMin =
+      eventCfg.pMin;
+  NeutralSimulator neutralSimulator(std::move(neutralPropagator),
+                                    Acts::Logging::WARNING);
+  const Simulator simulator(std::move(chargedSimulator),
+                            std::move(neutralSimulator));
+
+  // the input events are generated upfront, outside of the timing
+  std::vector<std::vector<ActsFatras::Particle>> events;
+  Generator eventRng(seed);
+  for (size_t ie = 0; ie < nEvents; ++ie) {
+    events.push_back(generateEvent(eventCfg, eventRng));
+  }
+  ACTS_INFO("simulating " << nEvents << " events with " << eventCfg.gunParticles
+                          << " gun particles and " << eventCfg.pileup
+                          << " pile-up vertices in a " << BzInT
+                          << "T B-field");
+
+  for (size_t nThreads = 1; nThreads <= maxThreads; ++nThreads) {
+    std::atomic<size_t> nextEvent{0};
+    Counters total;
+    std::mutex totalMutex;
+    auto work = [&]() {
+      t_counters = Counters();
+      // per-thread event buffers that keep their storage between events
+      std::vector<ActsFatras::Particle> initial;
+      ActsFatras::ParticleContainer final;
+      ActsFatras::HitContainer<float> hits;
+      for (size_t ie = nextEvent++; ie < nEvents; ie = nextEvent++) {
+        // seed per event, results do not depend on the number of threads
+        Generator rng(seed + ie);
+        initial.clear();
+        final.clear();
+        hits.clear();
+        auto result = simulator.simulate(geoCtx, magCtx, rng, events[ie],
+                                         initial, final, hits);
+        if (not result.ok()) {
+          ACTS_ERROR("event " << ie << " failed: " << result.error());
+          continue;
+        }
+        t_counters.events += 1;
+        t_counters.particles += initial.size();
+        t_counters.failed += result.value().size();
+        t_counters.hits += hits.size();
+      }
+      std::lock_guard<std::mutex> lock(totalMutex);
+      total += t_counters;
+    };
+
+    const auto start = Clock::now();
+    std::vector<std::thread> threads;
+    for (size_t it = 0; it < nThreads; ++it) {
+      threads.emplace_back(work);
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    const std::chrono::duration<double> wallTime = Clock::now() - start;
+    const double seconds = wallTime.count();
+
+    ACTS_INFO(nThreads << " thread(s): " << total.events << " events in "
+                       << seconds << "s, " << total.events / seconds
+                       << " events/s, " << total.particles / seconds
+                       << " particles/s, " << total.steps / seconds
+                       << " steps/s, " << total.hits / seconds << " hits/s");
+    if (total.failed > 0) {
+      ACTS_WARNING(total.failed << " particles failed to simulate");
+    }
+    // share of the summed thread time spent in the physics processes
+    const double threadSeconds = seconds * nThreads;
+    for (size_t ip = 0; ip < s_processNames.size(); ++ip) {
+      const std::chrono::duration<double> processTime = total.processTime[ip];
+      ACTS_INFO("    " << s_processNames[ip] << ": " << processTime.count()
+                       << "s, " << 100 * processTime.count() / threadSeconds
+                       << "% of the thread time");
+    }
+  }
+
+  return 0;
+}
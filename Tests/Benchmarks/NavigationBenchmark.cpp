@@ -0,0 +1,274 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/program_options.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/ActionList.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/MaterialInteractor.hpp"
+#include "Acts/Propagator/Navigator.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/StandardAborters.hpp"
+#include "Acts/Propagator/SurfaceCollector.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Tests/CommonHelpers/CylindricalTrackingGeometry.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/Units.hpp"
+
+namespace po = boost::program_options;
+using namespace Acts;
+using namespace Acts::UnitLiterals;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/// Accumulated propagation time split, filled by the timed navigator
+struct TimeSplit {
+  Clock::duration total{};
+  Clock::duration stepping{};
+  Clock::duration navigation{};
+  Clock::duration actors{};
+  size_t propagations = 0;
+  size_t steps = 0;
+  /// end of the last navigator calls of the current propagation
+  Clock::time_point statusEnd;
+  Clock::time_point targetEnd;
+};
+
+TimeSplit s_split;
+
+/// Navigator that measures its own time and infers the stepping and the
+/// actor time from the gaps between its calls.
+///
+/// Every iteration of the propagation loop calls the stepper, the navigator
+/// status, the actors and aborters, and the navigator target in this order.
+/// The time between the end of the target call and the start of the next
+/// status call is thus spent in the stepper, the time between the end of the
+/// status call and the start of the target call in the actors and aborters.
+struct TimedNavigator : public Navigator {
+  using Navigator::Navigator;
+
+  template <typename propagator_state_t, typename stepper_t>
+  void status(propagator_state_t& state, const stepper_t& stepper) const {
+    const auto start = Clock::now();
+    // there is no step before the initial status call
+    if (s_split.targetEnd != Clock::time_point()) {
+      s_split.stepping += start - s_split.targetEnd;
+    }
+    Navigator::status(state, stepper);
+    s_split.statusEnd = Clock::now();
+    s_split.navigation += s_split.statusEnd - start;
+  }
+
+  template <typename propagator_state_t, typename stepper_t>
+  void target(propagator_state_t& state, const stepper_t& stepper) const {
+    const auto start = Clock::now();
+    s_split.actors += start - s_split.statusEnd;
+    Navigator::target(state, stepper);
+    s_split.targetEnd = Clock::now();
+    s_split.navigation += s_split.targetEnd - start;
+  }
+};
+
+using BField = ConstantBField;
+using Stepper = EigenStepper<BField>;
+using TimedPropagator = Propagator<Stepper, TimedNavigator>;
+using Aborters = AbortList<EndOfWorldReached>;
+
+/// Generate tracks from the origin in an |eta| range and a pT range
+std::vector<CurvilinearParameters> generateTracks(
+    std::mt19937& rng, size_t nTracks, double etaMin, double etaMax,
+    double ptMin, double ptMax, bool withCovariance) {
+  std::uniform_real_distribution<double> phiDist(-M_PI, M_PI);
+  std::uniform_real_distribution<double> etaDist(etaMin, etaMax);
+  std::uniform_real_distribution<double> ptDist(ptMin, ptMax);
+  std::bernoulli_distribution flip(0.5);
+
+  std::optional<BoundSymMatrix> cov = std::nullopt;
+  if (withCovariance) {
+    BoundSymMatrix c = BoundSymMatrix::Zero();
+    c.diagonal() << 10_um, 10_um, 1e-3, 1e-3, 1e-3 / 1_GeV, 1_ns;
+    cov = c;
+  }
+
+  std::vector<CurvilinearParameters> tracks;
+  tracks.reserve(nTracks);
+  for (size_t it = 0; it < nTracks; ++it) {
+    const double phi = phiDist(rng);
+    const double eta = flip(rng) ? etaDist(rng) : -etaDist(rng);
+    const double theta = 2 * std::atan(std::exp(-eta));
+    const double pt = ptDist(rng);
+    const double q = flip(rng) ? 1_e : -1_e;
+    Vector3D mom(pt * std::cos(phi), pt * std::sin(phi),
+                 pt / std::tan(theta));
+    tracks.emplace_back(cov, Vector3D(0., 0., 0.), mom, q, 0.);
+  }
+  return tracks;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  size_t nTracks = 200;
+  size_t nRuns = 20;
+  size_t nEtaBins = 3;
+  double etaMax = 2.5;
+  double ptMinInGeV = 0.5;
+  double ptMaxInGeV = 10;
+  double BzInT = 2;
+  bool withCov = true;
+  unsigned int seed = 42;
+  std::string output;
+  unsigned int lvl = Acts::Logging::INFO;
+
+  try {
+    po::options_description desc("Allowed options");
+    // clang-format off
+  desc.add_options()
+      ("help", "produce help message")
+      ("tracks",po::value<size_t>(&nTracks)->default_value(nTracks),"number of tracks per eta bin")
+      ("runs",po::value<size_t>(&nRuns)->default_value(nRuns),"number of benchmark runs over all tracks")
+      ("eta-bins",po::value<size_t>(&nEtaBins)->default_value(nEtaBins),"number of |eta| bins")
+      ("eta",po::value<double>(&etaMax)->default_value(etaMax),"maximum absolute eta")
+      ("pt-min",po::value<double>(&ptMinInGeV)->default_value(ptMinInGeV),"minimum transverse momentum in GeV")
+      ("pt-max",po::value<double>(&ptMaxInGeV)->default_value(ptMaxInGeV),"maximum transverse momentum in GeV")
+      ("B",po::value<double>(&BzInT)->default_value(BzInT),"z-component of B-field in T")
+      ("cov",po::value<bool>(&withCov)->default_value(withCov),"propagation with covariance matrix")
+      ("seed",po::value<unsigned int>(&seed)->default_value(seed),"random seed")
+      ("output",po::value<std::string>(&output),"write the benchmark summaries to this CSV or JSON file")
+      ("verbose",po::value<unsigned int>(&lvl)->default_value(Acts::Logging::INFO),"logging level");
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help") != 0u) {
+      std::cout << desc << std::endl;
+      return 0;
+    }
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
+  }
+
+  auto myLogger = getDefaultLogger("Navigation", Acts::Logging::Level(lvl));
+  ACTS_LOCAL_LOGGER(std::move(myLogger));
+
+  GeometryContext geoCtx;
+  MagneticFieldContext magCtx;
+
+  // the cylindrical test detector with material on all layers
+  Test::CylindricalTrackingGeometry geoBuilder(geoCtx);
+  TimedPropagator propagator(Stepper(BField(0, 0, BzInT * 1_T)),
+                             TimedNavigator(geoBuilder()));
+
+  ACTS_INFO("propagating " << nTracks << " tracks per |eta| bin with pT in ["
+                           << ptMinInGeV << ", " << ptMaxInGeV
+                           << "] GeV in a " << BzInT << "T B-field"
+                           << (withCov ? " with covariance transport" : ""));
+
+  std::mt19937 rng(seed);
+  std::vector<Test::MicroBenchmarkSummary> summaries;
+
+  // benchmark one set of tracks with one action list configuration
+  auto runBenchmark = [&](const std::string& name, const auto& options,
+                          const std::vector<CurvilinearParameters>& tracks) {
+    s_split = TimeSplit();
+    size_t nFailed = 0;
+    const auto result = Test::microBenchmark(
+        [&](const CurvilinearParameters& start) {
+          // no step before the first navigator call of a propagation
+          s_split.targetEnd = Clock::time_point();
+          const auto begin = Clock::now();
+          auto r = propagator.propagate(start, options);
+          s_split.total += Clock::now() - begin;
+          s_split.propagations += 1;
+          if (r.ok()) {
+            s_split.steps += r.value().steps;
+          } else {
+            ++nFailed;
+          }
+          return r.ok();
+        },
+        tracks, nRuns, std::chrono::milliseconds(200));
+
+    const double total = s_split.total.count();
+    const double stepping = s_split.stepping.count();
+    const double navigation = s_split.navigation.count();
+    const double actors = s_split.actors.count();
+    auto percent = [&](double part) { return 100 * part / total; };
+    ACTS_INFO(name << ": " << result);
+    ACTS_INFO("    " << double(s_split.steps) / s_split.propagations
+                     << " steps per track, " << percent(stepping)
+                     << "% stepping, " << percent(navigation)
+                     << "% navigation, " << percent(actors)
+                     << "% actors and aborters, "
+                     << percent(total - stepping - navigation - actors)
+                     << "% other");
+    if (nFailed != 0) {
+      ACTS_WARNING("    " << nFailed << " propagations failed");
+    }
+    summaries.emplace_back(name, result);
+  };
+
+  for (size_t ibin = 0; ibin < nEtaBins; ++ibin) {
+    const double etaLow = etaMax * ibin / nEtaBins;
+    const double etaHigh = etaMax * (ibin + 1) / nEtaBins;
+    const auto tracks =
+        generateTracks(rng, nTracks, etaLow, etaHigh, ptMinInGeV * 1_GeV,
+                       ptMaxInGeV * 1_GeV, withCov);
+    std::ostringstream bin;
+    bin << etaLow << "<|eta|<" << etaHigh;
+
+    // navigation only
+    {
+      PropagatorOptions<ActionList<>, Aborters> options(geoCtx, magCtx);
+      runBenchmark(bin.str() + "/navigation", options, tracks);
+    }
+    // material effects
+    {
+      PropagatorOptions<ActionList<MaterialInteractor>, Aborters> options(
+          geoCtx, magCtx);
+      runBenchmark(bin.str() + "/material", options, tracks);
+    }
+    // material effects and sensitive surface collection
+    {
+      PropagatorOptions<ActionList<MaterialInteractor, SurfaceCollector<>>,
+                        Aborters>
+          options(geoCtx, magCtx);
+      runBenchmark(bin.str() + "/material+surfaces", options, tracks);
+    }
+  }
+
+  if (not output.empty()) {
+    std::ofstream file(output);
+    if (output.size() > 5 and output.substr(output.size() - 5) == ".json") {
+      Test::writeJson(file, summaries);
+    } else {
+      Test::writeCsv(file, summaries);
+    }
+    ACTS_INFO("wrote benchmark summaries to " << output);
+  }
+
+  return 0;
+}
@@ -0,0 +1,745 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/program_options.hpp>
+
+#include <sys/resource.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Acts/EventData/Measurement.hpp"
+#include "Acts/EventData/MeasurementHelpers.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Fitter/GainMatrixSmoother.hpp"
+#include "Acts/Fitter/GainMatrixUpdater.hpp"
+#include "Acts/Fitter/KalmanFitter.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Plugins/Digitization/CartesianSegmentation.hpp"
+#include "Acts/Plugins/Digitization/Clusterization.hpp"
+#include "Acts/Plugins/Digitization/DigitizationModule.hpp"
+#include "Acts/Plugins/Digitization/PlanarModuleCluster.hpp"
+#include "Acts/Plugins/Digitization/PlanarModuleStepper.hpp"
+#include "Acts/Plugins/Digitization/SingleHitSpacePointBuilder.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/Navigator.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/StraightLineStepper.hpp"
+#include "Acts/Seeding/BinFinder.hpp"
+#include "Acts/Seeding/BinnedSPGroup.hpp"
+#include "Acts/Seeding/SeedFilter.hpp"
+#include "Acts/Seeding/Seedfinder.hpp"
+#include "Acts/Seeding/SpacePointGrid.hpp"
+#include "Acts/Surfaces/PerigeeSurface.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Tests/CommonHelpers/CylindricalTrackingGeometry.hpp"
+#include "Acts/Utilities/CalibrationContext.hpp"
+#include "Acts/Utilities/Instrumentation.hpp"
+#include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/UnitVectors.hpp"
+#include "Acts/Utilities/Units.hpp"
+#include "Acts/Vertexing/AdaptiveMultiVertexFinder.hpp"
+#include "Acts/Vertexing/AdaptiveMultiVertexFitter.hpp"
+#include "Acts/Vertexing/HelicalTrackLinearizer.hpp"
+#include "Acts/Vertexing/ImpactPoint3dEstimator.hpp"
+#include "Acts/Vertexing/TrackDensityVertexFinder.hpp"
+#include "Acts/Vertexing/TrackToVertexIPEstimator.hpp"
+#include "Acts/Vertexing/Vertex.hpp"
+#include "ActsFatras/EventData/Hit.hpp"
+#include "ActsFatras/Kernel/PhysicsList.hpp"
+#include "ActsFatras/Kernel/Simulator.hpp"
+#include "ActsFatras/Physics/StandardPhysicsLists.hpp"
+#include "ActsFatras/Selectors/ChargeSelectors.hpp"
+
+namespace po = boost::program_options;
+using namespace Acts::UnitLiterals;
+using Acts::Logger;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/// Stages of the reconstruction chain, in execution order
+enum Stage : size_t {
+  eSimulation = 0,
+  eDigitization,
+  eSpacePoints,
+  eSeeding,
+  eFitting,
+  eVertexing,
+  eNumStages,
+};
+
+const std::array<const char*, eNumStages> s_stageNames = {
+    "simulation", "digitization", "space points",
+    "seeding",    "track fit",    "vertexing"};
+
+/// Resources used by one stage
+struct StageCounters {
+  Clock::duration time{};
+  size_t allocations = 0;
+  size_t allocatedBytes = 0;
+};
+
+/// Work counters, filled thread-locally and merged at the end of the run
+struct Counters {
+  size_t events = 0;
+  size_t particles = 0;
+  size_t hits = 0;
+  size_t clusters = 0;
+  size_t spacePoints = 0;
+  size_t seeds = 0;
+  size_t fits = 0;
+  size_t failedFits = 0;
+  size_t vertices = 0;
+  std::array<StageCounters, eNumStages> stages = {};
+
+  Counters& operator+=(const Counters& other) {
+    events += other.events;
+    particles += other.particles;
+    hits += other.hits;
+    clusters += other.clusters;
+    spacePoints += other.spacePoints;
+    seeds += other.seeds;
+    fits += other.fits;
+    failedFits += other.failedFits;
+    vertices += other.vertices;
+    for (size_t is = 0; is < eNumStages; ++is) {
+      stages[is].time += other.stages[is].time;
+      stages[is].allocations += other.stages[is].allocations;
+      stages[is].allocatedBytes += other.stages[is].allocatedBytes;
+    }
+    return *this;
+  }
+};
+
+thread_local Counters t_counters;
+
+/// Run one stage and account its wall time and heap allocations
+///
+/// The allocations are counted by the instrumentation of the library and
+/// are only available if it was built with ACTS_ENABLE_INSTRUMENTATION.
+template <typename function_t>
+void runStage(Stage stage, function_t&& function) {
+  const auto allocations = Acts::Instrumentation::threadAllocations();
+  const auto start = Clock::now();
+  function();
+  auto& counters = t_counters.stages[stage];
+  counters.time += Clock::now() - start;
+  const auto finalAllocations = Acts::Instrumentation::threadAllocations();
+  counters.allocations +=
+      finalAllocations.allocations - allocations.allocations;
+  counters.allocatedBytes +=
+      finalAllocations.allocatedBytes - allocations.allocatedBytes;
+}
+
+// simulation: charged particles numerically, neutral ones along straight lines
+using Navigator = Acts::Navigator;
+using BField = Acts::ConstantBField;
+using Stepper = Acts::EigenStepper<BField>;
+using ChargedPropagator = Acts::Propagator<Stepper, Navigator>;
+using NeutralPropagator = Acts::Propagator<Acts::StraightLineStepper, Navigator>;
+using Generator = std::mt19937;
+using ChargedSimulator =
+    ActsFatras::ParticleSimulator<ChargedPropagator,
+                                  ActsFatras::ChargedElectroMagneticPhysicsList,
+                                  ActsFatras::EverySurface>;
+using NeutralSimulator =
+    ActsFatras::ParticleSimulator<NeutralPropagator, ActsFatras::PhysicsList<>,
+                                  ActsFatras::NoSurface>;
+using Simulator =
+    ActsFatras::Simulator<ActsFatras::ChargedSelector, ChargedSimulator,
+                          ActsFatras::NeutralSelector, NeutralSimulator>;
+
+// reconstruction event data
+using SourceLink = Acts::MinimalSourceLink;
+using Measurement = Acts::FittableMeasurement<SourceLink>;
+using Cluster = Acts::PlanarModuleCluster;
+using SpacePoint = Acts::SpacePoint<Cluster>;
+
+// track fitting and vertexing
+using KalmanFitter =
+    Acts::KalmanFitter<ChargedPropagator,
+                       Acts::GainMatrixUpdater<Acts::BoundParameters>,
+                       Acts::GainMatrixSmoother<Acts::BoundParameters>>;
+using VertexPropagator = Acts::Propagator<Stepper>;
+using Linearizer = Acts::HelicalTrackLinearizer<VertexPropagator>;
+using IP3dEstimator =
+    Acts::ImpactPoint3dEstimator<Acts::BoundParameters, VertexPropagator>;
+using IPEstimator =
+    Acts::TrackToVertexIPEstimator<Acts::BoundParameters, VertexPropagator>;
+using VertexFitter =
+    Acts::AdaptiveMultiVertexFitter<Acts::BoundParameters, Linearizer>;
+using VertexSeedFinder =
+    Acts::TrackDensityVertexFinder<VertexFitter, Acts::GaussianTrackDensity>;
+using VertexFinder =
+    Acts::AdaptiveMultiVertexFinder<VertexFitter, VertexSeedFinder>;
+
+/// Event generation settings
+struct EventConfig {
+  /// mean number of pile-up vertices in addition to the hard scatter vertex
+  double pileup = 20.;
+  /// charged pions per hard scatter and per pile-up vertex
+  size_t hardScatterParticles = 50;
+  size_t pileupParticles = 10;
+  /// minimum transverse momentum and maximum absolute eta
+  double ptMin = 0.5_GeV;
+  double etaMax = 2.5;
+  /// longitudinal vertex spread
+  double sigmaZ = 50_mm;
+};
+
+/// Generate the input particles of one event
+std::vector<ActsFatras::Particle> generateEvent(const EventConfig& cfg,
+                                                Generator& rng) {
+  std::uniform_real_distribution<double> phiDist(-M_PI, M_PI);
+  std::uniform_real_distribution<double> etaDist(-cfg.etaMax, cfg.etaMax);
+  std::exponential_distribution<double> ptDist(1 / 1_GeV);
+  std::normal_distribution<double> zDist(0., cfg.sigmaZ);
+  std::poisson_distribution<size_t> nPileupDist(cfg.pileup);
+  std::bernoulli_distribution chargeDist(0.5);
+
+  std::vector<ActsFatras::Particle> particles;
+  const size_t nPileup = cfg.pileup > 0. ? nPileupDist(rng) : 0;
+  // the first vertex is the hard scatter one
+  for (size_t iv = 0; iv <= nPileup; ++iv) {
+    const double z = zDist(rng);
+    const size_t nParticles =
+        iv == 0 ? cfg.hardScatterParticles : cfg.pileupParticles;
+    for (size_t ip = 0; ip < nParticles; ++ip) {
+      const auto pid =
+          ActsFatras::Barcode().setVertexPrimary(iv + 1).setParticle(ip + 1);
+      const auto pdg = chargeDist(rng) ? Acts::PdgParticle::ePionPlus
+                                       : Acts::PdgParticle::ePionMinus;
+      const double eta = etaDist(rng);
+      const double pt = cfg.ptMin + ptDist(rng);
+      particles.push_back(
+          ActsFatras::Particle(pid, pdg)
+              .setPosition4(0., 0., z, 0.)
+              .setDirection(
+                  Acts::makeDirectionUnitFromPhiEta(phiDist(rng), eta))
+              .setAbsMomentum(pt * std::cosh(eta)));
+    }
+  }
+  return particles;
+}
+
+/// Readout of one sensitive surface
+struct Readout {
+  const Acts::Surface* surface = nullptr;
+  std::shared_ptr<const Acts::DigitizationModule> module;
+};
+
+/// Build the pixel readout for all sensitive surfaces of the geometry
+std::unordered_map<Acts::GeometryID, Readout> buildReadout(
+    const Acts::TrackingGeometry& geometry, double pitchX, double pitchY) {
+  // surfaces with the same bounds share their digitization module
+  std::map<const Acts::SurfaceBounds*,
+           std::shared_ptr<const Acts::DigitizationModule>>
+      modules;
+  std::unordered_map<Acts::GeometryID, Readout> readout;
+  geometry.visitSurfaces([&](const Acts::Surface* surface) {
+    const auto* bounds =
+        dynamic_cast<const Acts::RectangleBounds*>(&surface->bounds());
+    const auto* element = surface->associatedDetectorElement();
+    if (bounds == nullptr or element == nullptr) {
+      return;
+    }
+    auto& module = modules[bounds];
+    if (not module) {
+      auto segmentation = std::make_shared<const Acts::CartesianSegmentation>(
+          std::make_shared<const Acts::RectangleBounds>(bounds->halfLengthX(),
+                                                        bounds->halfLengthY()),
+          std::lround(2 * bounds->halfLengthX() / pitchX),
+          std::lround(2 * bounds->halfLengthY() / pitchY));
+      module = std::make_shared<const Acts::DigitizationModule>(
+          std::move(segmentation), 0.5 * element->thickness(), -1, 0.);
+    }
+    readout[surface->geoID()] = {surface, module};
+  });
+  return readout;
+}
+
+/// Reconstructed data of one event
+struct EventData {
+  std::vector<ActsFatras::Particle> initial;
+  std::vector<ActsFatras::Particle> final;
+  std::vector<ActsFatras::Hit> hits;
+  std::vector<Cluster> clusters;
+  /// generating particle and calibrated measurement for each cluster
+  std::vector<ActsFatras::Barcode> clusterParticles;
+  std::vector<Measurement> measurements;
+  std::vector<SpacePoint> spacePoints;
+  std::vector<Acts::Seed<SpacePoint>> seeds;
+  std::vector<Acts::BoundParameters> tracks;
+  std::vector<Acts::Vertex<Acts::BoundParameters>> vertices;
+};
+
+/// Digitize the simulated hits into pixel clusters
+void digitize(const Acts::GeometryContext& geoCtx,
+              const std::unordered_map<Acts::GeometryID, Readout>& readout,
+              const Acts::PlanarModuleStepper& moduleStepper,
+              EventData& event) {
+  using Cell = Acts::DigitizationCell;
+  using CellMap = std::unordered_map<size_t, std::pair<Cell, bool>>;
+
+  // collect the fired cells and their generating particle per module
+  std::map<Acts::GeometryID, CellMap> moduleCells;
+  std::map<Acts::GeometryID, std::unordered_map<size_t, ActsFatras::Barcode>>
+      moduleParticles;
+  for (const auto& hit : event.hits) {
+    auto it = readout.find(hit.geometryId());
+    if (it == readout.end()) {
+      continue;
+    }
+    const auto& surface = *it->second.surface;
+    const auto& module = *it->second.module;
+    // hit position and direction in the local module frame
+    const auto& transform = surface.transform(geoCtx);
+    const Acts::Vector3D pos = transform.inverse() * hit.position();
+    const Acts::Vector3D dir =
+        transform.linear().transpose() * hit.unitDirectionBefore();
+    if (std::abs(dir.z()) < 1e-6) {
+      continue;
+    }
+    const double halfThickness = module.halfThickness();
+    const Acts::Vector3D entry = pos - (pos.z() + halfThickness) / dir.z() * dir;
+    const Acts::Vector3D exit = pos - (pos.z() - halfThickness) / dir.z() * dir;
+
+    const size_t nBins0 = module.segmentation().binUtility().bins(0);
+    auto& cells = moduleCells[hit.geometryId()];
+    auto& particles = moduleParticles[hit.geometryId()];
+    for (const auto& step :
+         moduleStepper.cellSteps(geoCtx, module, entry, exit)) {
+      const size_t index =
+          step.stepCell.channel0 + nBins0 * step.stepCell.channel1;
+      const Cell cell(step.stepCell.channel0, step.stepCell.channel1,
+                      step.stepLength);
+      auto inserted = cells.emplace(index, std::make_pair(cell, false));
+      if (not inserted.second) {
+        inserted.first->second.first.addCell(cell, true);
+      }
+      particles.emplace(index, hit.particleId());
+    }
+  }
+
+  // merge neighbouring cells into clusters at the weighted cell position
+  for (auto& [geoId, cells] : moduleCells) {
+    const auto& surface = *readout.at(geoId).surface;
+    const auto& module = *readout.at(geoId).module;
+    const auto& segmentation = module.segmentation();
+    const size_t nBins0 = segmentation.binUtility().bins(0);
+    const auto& particles = moduleParticles[geoId];
+    for (auto& clusterCells : Acts::createClusters<Cell>(cells, nBins0)) {
+      Acts::Vector2D local(0., 0.);
+      double totalWeight = 0.;
+      for (const auto& cell : clusterCells) {
+        local += cell.data * segmentation.cellPosition(cell);
+        totalWeight += cell.data;
+      }
+      local /= totalWeight;
+      // single pixel resolution
+      const auto& first = clusterCells.front();
+      const Acts::Vector2D pitch =
+          segmentation.cellPosition(Cell(first.channel0 + 1, first.channel1)) -
+          segmentation.cellPosition(Cell(first.channel0, first.channel1 + 1));
+      Acts::ActsSymMatrixD<3> cov = Acts::ActsSymMatrixD<3>::Zero();
+      cov(0, 0) = pitch.x() * pitch.x() / 12;
+      cov(1, 1) = pitch.y() * pitch.y() / 12;
+      cov(2, 2) = 1_ns * 1_ns;
+
+      event.clusterParticles.push_back(
+          particles.at(first.channel0 + nBins0 * first.channel1));
+      event.measurements.push_back(
+          Acts::Measurement<SourceLink, Acts::eLOC_0, Acts::eLOC_1>(
+              surface.getSharedPtr(), {},
+              Acts::ActsSymMatrixD<2>(cov.topLeftCorner<2, 2>()), local.x(),
+              local.y()));
+      event.clusters.emplace_back(surface.getSharedPtr(), SourceLink{}, cov,
+                                  local.x(), local.y(), 0.,
+                                  std::move(clusterCells), &module);
+    }
+  }
+}
+
+/// Estimate the track parameters at the innermost space point of a seed.
+///
+/// The transverse momentum, the charge and the direction follow from the
+/// circle through the three space points, the polar angle from the straight
+/// line through the outer ones.
+Acts::CurvilinearParameters estimateParameters(
+    const Acts::Seed<SpacePoint>& seed, double Bz) {
+  const auto& sps = seed.sp();
+  const Acts::Vector2D p0(sps[0]->x(), sps[0]->y());
+  const Acts::Vector2D p1(sps[1]->x(), sps[1]->y());
+  const Acts::Vector2D p2(sps[2]->x(), sps[2]->y());
+  // circle center from the intersection of the perpendicular bisectors
+  const Acts::Vector2D d01 = p1 - p0;
+  const Acts::Vector2D d02 = p2 - p0;
+  const double det = 2 * (d01.x() * d02.y() - d01.y() * d02.x());
+  const Acts::Vector2D center =
+      p0 + Acts::Vector2D(d02.y() * d01.squaredNorm() -
+                              d01.y() * d02.squaredNorm(),
+                          d01.x() * d02.squaredNorm() -
+                              d02.x() * d01.squaredNorm()) /
+               det;
+  const double radius = (p0 - center).norm();
+  // positive particles bend clockwise in a positive Bz field
+  const double charge = (0 < det) == (0 < Bz) ? -1 : 1;
+  // tangent at the first space point, pointing towards the second one
+  Acts::Vector2D tangent(-(p0 - center).y(), (p0 - center).x());
+  tangent.normalize();
+  if (tangent.dot(d01) < 0) {
+    tangent = -tangent;
+  }
+  const double pt = std::abs(Bz) * radius;
+  const double pz = pt * (sps[2]->z() - sps[0]->z()) / d02.norm();
+  const Acts::Vector3D momentum(pt * tangent.x(), pt * tangent.y(), pz);
+  // start slightly before the first measurement
+  const Acts::Vector3D position =
+      sps[0]->vector - 5_mm * momentum.normalized();
+
+  Acts::BoundSymMatrix cov = Acts::BoundSymMatrix::Zero();
+  cov.diagonal() << 1_mm * 1_mm, 1_mm * 1_mm, 0.01, 0.01,
+      0.1 / (1_GeV * 1_GeV), 1_ns * 1_ns;
+  return Acts::CurvilinearParameters(cov, position, momentum, charge, 0.);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  size_t nEvents = 20;
+  size_t nThreads = std::max(1u, std::thread::hardware_concurrency());
+  double BzInT = 2;
+  double pitchXInUm = 50;
+  double pitchYInUm = 400;
+  unsigned int seed = 42;
+  unsigned int lvl = Acts::Logging::INFO;
+  EventConfig eventCfg;
+  double ptMinInGeV = eventCfg.ptMin / 1_GeV;
+
+  try {
+    po::options_description desc("Allowed options");
+    // clang-format off
+  desc.add_options()
+      ("help", "produce help message")
+      ("events",po::value<size_t>(&nEvents)->default_value(nEvents),"number of events")
+      ("threads",po::value<size_t>(&nThreads)->default_value(nThreads),"number of threads processing events in parallel")
+      ("pileup",po::value<double>(&eventCfg.pileup)->default_value(eventCfg.pileup),"mean number of pile-up vertices")
+      ("hs-particles",po::value<size_t>(&eventCfg.hardScatterParticles)->default_value(eventCfg.hardScatterParticles),"charged pions from the hard scatter vertex")
+      ("pileup-particles",po::value<size_t>(&eventCfg.pileupParticles)->default_value(eventCfg.pileupParticles),"charged pions per pile-up vertex")
+      ("pt-min",po::value<double>(&ptMinInGeV)->default_value(ptMinInGeV),"minimum transverse momentum in GeV")
+      ("eta",po::value<double>(&eventCfg.etaMax)->default_value(eventCfg.etaMax),"maximum absolute eta of the generated particles")
+      ("pitch-x",po::value<double>(&pitchXInUm)->default_value(pitchXInUm),"pixel pitch along the local x axis in um")
+      ("pitch-y",po::value<double>(&pitchYInUm)->default_value(pitchYInUm),"pixel pitch along the local y axis in um")
+      ("B",po::value<double>(&BzInT)->default_value(BzInT),"z-component of B-field in T")
+      ("seed",po::value<unsigned int>(&seed)->default_value(seed),"random seed")
+      ("verbose",po::value<unsigned int>(&lvl)->default_value(Acts::Logging::INFO),"logging level");
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help") != 0u) {
+      std::cout << desc << std::endl;
+      return 0;
+    }
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
+  }
+  eventCfg.ptMin = ptMinInGeV * 1_GeV;
+
+  auto myLogger =
+      Acts::getDefaultLogger("ReconstructionChain", Acts::Logging::Level(lvl));
+  ACTS_LOCAL_LOGGER(std::move(myLogger));
+
+  Acts::GeometryContext geoCtx;
+  Acts::MagneticFieldContext magCtx;
+  Acts::CalibrationContext calCtx;
+
+  // the detector, its readout and the simulator, shared by all threads
+  Acts::Test::CylindricalTrackingGeometry geoBuilder(geoCtx);
+  auto trackingGeometry = geoBuilder();
+  const auto readout =
+      buildReadout(*trackingGeometry, pitchXInUm * 1_um, pitchYInUm * 1_um);
+  const BField bField(0, 0, BzInT * 1_T);
+  Navigator navigator(trackingGeometry);
+  ChargedSimulator chargedSimulator(ChargedPropagator(Stepper(bField), navigator),
+                                    Acts::Logging::WARNING);
+  chargedSimulator.physics =
+      ActsFatras::makeChargedElectroMagneticPhysicsList(50_MeV);
+  NeutralSimulator neutralSimulator(
+      NeutralPropagator(Acts::StraightLineStepper(), navigator),
+      Acts::Logging::WARNING);
+  const Simulator simulator(std::move(chargedSimulator),
+                            std::move(neutralSimulator));
+  const auto perigee =
+      Acts::Surface::makeShared<Acts::PerigeeSurface>(Acts::Vector3D(0, 0, 0));
+
+  // the seed finder uses MeV, mm and kT
+  Acts::SeedfinderConfig<SpacePoint> seedCfg;
+  seedCfg.rMax = 200.;
+  seedCfg.deltaRMin = 5.;
+  seedCfg.deltaRMax = 150.;
+  seedCfg.collisionRegionMin = -250.;
+  seedCfg.collisionRegionMax = 250.;
+  seedCfg.zMin = -1100.;
+  seedCfg.zMax = 1100.;
+  seedCfg.maxSeedsPerSpM = 1;
+  seedCfg.cotThetaMax = std::sinh(eventCfg.etaMax);
+  seedCfg.sigmaScattering = 5.;
+  seedCfg.minPt = eventCfg.ptMin / 1_MeV;
+  seedCfg.bFieldInZ = BzInT * 1e-3;
+  seedCfg.impactMax = 10.;
+  seedCfg.seedFilter = std::make_shared<Acts::SeedFilter<SpacePoint>>(
+      Acts::SeedFilterConfig());
+  Acts::SpacePointGridConfig gridCfg;
+  gridCfg.bFieldInZ = seedCfg.bFieldInZ;
+  gridCfg.minPt = seedCfg.minPt;
+  gridCfg.rMax = seedCfg.rMax;
+  gridCfg.zMax = seedCfg.zMax;
+  gridCfg.zMin = seedCfg.zMin;
+  gridCfg.deltaRMax = seedCfg.deltaRMax;
+  gridCfg.cotThetaMax = seedCfg.cotThetaMax;
+  auto binFinder = std::make_shared<Acts::BinFinder<SpacePoint>>();
+
+  ACTS_INFO("reconstructing " << nEvents << " events with "
+                              << eventCfg.pileup << " pile-up vertices on "
+                              << nThreads << " thread(s) in a " << BzInT
+                              << "T B-field");
+
+  std::atomic<size_t> nextEvent{0};
+  Counters total;
+  std::mutex totalMutex;
+  auto work = [&]() {
+    t_counters = Counters();
+
+    // per-thread reconstruction tools
+    const Acts::PlanarModuleStepper moduleStepper(
+        Acts::getDefaultLogger("PlanarModuleStepper", Acts::Logging::WARNING));
+    const Acts::SpacePointBuilder<SpacePoint> spacePointBuilder;
+    const Acts::Seedfinder<SpacePoint> seedFinder(seedCfg);
+    const KalmanFitter fitter(ChargedPropagator(Stepper(bField), navigator),
+                              Acts::getDefaultLogger("KalmanFitter",
+                                                     Acts::Logging::WARNING));
+    Acts::KalmanFitterOptions<Acts::VoidOutlierFinder> fitterOptions(
+        geoCtx, magCtx, calCtx, Acts::VoidOutlierFinder(), perigee.get());
+    auto vertexPropagator =
+        std::make_shared<VertexPropagator>(Stepper(bField));
+    VertexFitter::Config vertexFitterCfg(
+        IP3dEstimator(IP3dEstimator::Config(bField, vertexPropagator)));
+    vertexFitterCfg.annealingTool =
+        Acts::AnnealingUtility(Acts::AnnealingUtility::Config(
+            {8.0, 4.0, 2.0, 1.4142136, 1.2247449, 1.0}));
+    VertexFinder::Config vertexFinderCfg(
+        VertexFitter(vertexFitterCfg), VertexSeedFinder(),
+        IPEstimator(IPEstimator::Config(vertexPropagator)),
+        Linearizer(Linearizer::Config(bField, vertexPropagator)));
+    const VertexFinder vertexFinder(vertexFinderCfg);
+    Acts::VertexingOptions<Acts::BoundParameters> vertexingOptions(geoCtx,
+                                                                  magCtx);
+    Acts::Vertex<Acts::BoundParameters> beamSpot(Acts::Vector3D(0, 0, 0));
+    Acts::ActsSymMatrixD<3> beamSpotCov = Acts::ActsSymMatrixD<3>::Zero();
+    beamSpotCov.diagonal() << 15_um * 15_um, 15_um * 15_um,
+        eventCfg.sigmaZ * eventCfg.sigmaZ;
+    beamSpot.setCovariance(beamSpotCov);
+    vertexingOptions.vertexConstraint = beamSpot;
+
+    for (size_t ie = nextEvent++; ie < nEvents; ie = nextEvent++) {
+      // seed per event, results do not depend on the number of threads
+      Generator rng(seed + ie);
+      const auto particles = generateEvent(eventCfg, rng);
+      EventData event;
+
+      runStage(eSimulation, [&]() {
+        auto result = simulator.simulate(geoCtx, magCtx, rng, particles,
+                                         event.initial, event.final,
+                                         event.hits);
+        if (not result.ok()) {
+          ACTS_ERROR("event " << ie << " failed: " << result.error());
+        }
+      });
+      runStage(eDigitization,
+               [&]() { digitize(geoCtx, readout, moduleStepper, event); });
+      runStage(eSpacePoints, [&]() {
+        std::vector<const Cluster*> clusters;
+        clusters.reserve(event.clusters.size());
+        for (const auto& cluster : event.clusters) {
+          clusters.push_back(&cluster);
+        }
+        spacePointBuilder.calculateSpacePoints(geoCtx, clusters,
+                                               event.spacePoints);
+      });
+      runStage(eSeeding, [&]() {
+        std::vector<const SpacePoint*> spacePoints;
+        spacePoints.reserve(event.spacePoints.size());
+        for (const auto& sp : event.spacePoints) {
+          spacePoints.push_back(&sp);
+        }
+        // the cluster covariance is given in the module frame, rotate it
+        // into the global frame and project it onto the radial direction
+        // of the space point and onto z
+        auto covariance = [&](const SpacePoint& sp, float, float, float) {
+          const auto& cluster = *sp.clusterModule.front();
+          const Acts::ActsMatrixD<3, 2> localAxes = cluster.referenceSurface()
+                                                        .transform(geoCtx)
+                                                        .rotation()
+                                                        .leftCols<2>();
+          const Acts::ActsSymMatrixD<3> globalCov =
+              localAxes * cluster.covariance().topLeftCorner<2, 2>() *
+              localAxes.transpose();
+          const Acts::Vector3D radial =
+              Acts::Vector3D(sp.x(), sp.y(), 0.).normalized();
+          return Acts::Vector2D(radial.dot(globalCov * radial),
+                                globalCov(2, 2));
+        };
+        auto groups = Acts::BinnedSPGroup<SpacePoint>(
+            spacePoints.begin(), spacePoints.end(), covariance, binFinder,
+            binFinder,
+            Acts::SpacePointGridCreator::createGrid<SpacePoint>(gridCfg),
+            seedCfg);
+        for (auto group = groups.begin(); !(group == groups.end()); ++group) {
+          auto seeds = seedFinder.createSeedsForGroup(
+              group.bottom(), group.middle(), group.top());
+          // Seed is copy-constructible but not copy-assignable
+          for (const auto& trackSeed : seeds) {
+            event.seeds.push_back(trackSeed);
+          }
+        }
+      });
+      runStage(eFitting, [&]() {
+        // fit the measurements of each particle with a truth-matched seed
+        std::map<ActsFatras::Barcode, std::vector<SourceLink>> sourceLinks;
+        for (size_t ic = 0; ic < event.clusters.size(); ++ic) {
+          sourceLinks[event.clusterParticles[ic]].push_back(
+              SourceLink{&event.measurements[ic]});
+        }
+        auto particleOf = [&](const SpacePoint* sp) {
+          return event.clusterParticles[sp->clusterModule.front() -
+                                        event.clusters.data()];
+        };
+        for (const auto& trackSeed : event.seeds) {
+          const auto& sps = trackSeed.sp();
+          const auto particle = particleOf(sps[0]);
+          auto links = sourceLinks.find(particle);
+          if (not(particleOf(sps[1]) == particle) or
+              not(particleOf(sps[2]) == particle) or
+              links == sourceLinks.end()) {
+            continue;
+          }
+          auto result =
+              fitter.fit(links->second,
+                         estimateParameters(trackSeed, BzInT * 1_T),
+                         fitterOptions);
+          t_counters.fits += 1;
+          if (result.ok() and result.value().fittedParameters) {
+            event.tracks.push_back(*result.value().fittedParameters);
+          } else {
+            t_counters.failedFits += 1;
+          }
+          // one fit per particle
+          sourceLinks.erase(links);
+        }
+      });
+      runStage(eVertexing, [&]() {
+        std::vector<const Acts::BoundParameters*> tracks;
+        for (const auto& track : event.tracks) {
+          tracks.push_back(&track);
+        }
+        auto result = vertexFinder.find(tracks, vertexingOptions);
+        if (result.ok()) {
+          event.vertices = std::move(result.value());
+        } else {
+          ACTS_WARNING("vertexing of event " << ie
+                                             << " failed: " << result.error());
+        }
+      });
+
+      t_counters.events += 1;
+      t_counters.particles += event.initial.size();
+      t_counters.hits += event.hits.size();
+      t_counters.clusters += event.clusters.size();
+      t_counters.spacePoints += event.spacePoints.size();
+      t_counters.seeds += event.seeds.size();
+      t_counters.vertices += event.vertices.size();
+    }
+    std::lock_guard<std::mutex> lock(totalMutex);
+    total += t_counters;
+  };
+
+  const auto start = Clock::now();
+  std::vector<std::thread> threads;
+  for (size_t it = 0; it < nThreads; ++it) {
+    threads.emplace_back(work);
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  const std::chrono::duration<double> wallTime = Clock::now() - start;
+  const double seconds = wallTime.count();
+  const double events = std::max<size_t>(1, total.events);
+
+  rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  ACTS_INFO(total.events << " events in " << seconds << "s, "
+                         << total.events / seconds << " events/s, peak RSS "
+                         << usage.ru_maxrss / 1024. << " MB");
+  ACTS_INFO("per event: " << total.particles / events << " particles, "
+                          << total.hits / events << " hits, "
+                          << total.clusters / events << " clusters, "
+                          << total.spacePoints / events << " space points, "
+                          << total.seeds / events << " seeds, "
+                          << total.fits / events << " fitted tracks, "
+                          << total.vertices / events << " vertices");
+  if (total.failedFits > 0) {
+    ACTS_WARNING(total.failedFits << " of " << total.fits
+                                  << " track fits failed");
+  }
+  Clock::duration chainTime{};
+  for (const auto& stage : total.stages) {
+    chainTime += stage.time;
+  }
+#ifndef ACTS_ENABLE_INSTRUMENTATION
+  ACTS_INFO("allocations are only counted with ACTS_ENABLE_INSTRUMENTATION");
+#endif
+  for (size_t is = 0; is < eNumStages; ++is) {
+    const auto& stage = total.stages[is];
+    const std::chrono::duration<double, std::milli> stageTime = stage.time;
+#ifdef ACTS_ENABLE_INSTRUMENTATION
+    ACTS_INFO("    " << s_stageNames[is] << ": " << stageTime.count() / events
+                     << "ms/event ("
+                     << 100. * stage.time.count() / chainTime.count()
+                     << "%), " << stage.allocations / events
+                     << " allocations/event, "
+                     << stage.allocatedBytes / events / 1024.
+                     << " kB allocated/event");
+#else
+    ACTS_INFO("    " << s_stageNames[is] << ": " << stageTime.count() / events
+                     << "ms/event ("
+                     << 100. * stage.time.count() / chainTime.count()
+                     << "%)");
+#endif
+  }
+
+  return 0;
+}
@@ -0,0 +1,137 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Surfaces/RectangleBounds.hpp"
+#include "Acts/Surfaces/SurfaceArray.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Utilities/Definitions.hpp"
+#include "Acts/Utilities/Helpers.hpp"
+#include "Acts/Utilities/detail/Axis.hpp"
+
+using namespace Acts;
+using Acts::VectorHelpers::phi;
+
+// The optional argument is a CSV or JSON file for the benchmark summaries
+int main(int argc, char* argv[]) {
+  // === PROBLEM DATA ===
+
+  GeometryContext gctx;
+
+  // Barrel of planar modules, 30 in phi and 7 in z, at radius R
+  constexpr size_t nPhi = 30;
+  constexpr size_t nZ = 7;
+  const double R = 10.;
+  const double halfZ = 2.;
+  std::vector<std::shared_ptr<const Surface>> surfaces;
+  for (size_t iz = 0; iz < nZ; ++iz) {
+    double z = (2. * iz + 1. - nZ) * halfZ;
+    for (size_t iphi = 0; iphi < nPhi; ++iphi) {
+      Transform3D trans = Transform3D::Identity();
+      trans.rotate(AngleAxis3D(2. * M_PI * iphi / nPhi, Vector3D(0, 0, 1)));
+      trans.translate(Vector3D(R, 0, z));
+      trans.rotate(AngleAxis3D(M_PI / 2., Vector3D(0, 1, 0)));
+      surfaces.push_back(Surface::makeShared<PlaneSurface>(
+          std::make_shared<const Transform3D>(trans),
+          std::make_shared<const RectangleBounds>(halfZ, 1.)));
+    }
+  }
+  std::vector<const Surface*> surfacesRaw = unpack_shared_vector(surfaces);
+
+  using PhiAxis = detail::Axis<detail::AxisType::Equidistant,
+                               detail::AxisBoundaryType::Closed>;
+  using ZAxis = detail::Axis<detail::AxisType::Equidistant,
+                             detail::AxisBoundaryType::Bound>;
+  auto axes = [&]() {
+    return std::make_tuple(PhiAxis(-M_PI, M_PI, nPhi),
+                           ZAxis(-halfZ * nZ, halfZ * nZ, nZ));
+  };
+
+  // The same (phi, z) coordinates, once type-erased and once static
+  Transform3D transform = Transform3D::Identity();
+  Transform3D itransform = transform.inverse();
+  auto functionLookup =
+      std::make_unique<SurfaceArray::SurfaceGridLookup<PhiAxis, ZAxis>>(
+          [transform](const Vector3D& pos) {
+            Vector3D loc = transform * pos;
+            return Vector2D(phi(loc), loc.z());
+          },
+          [itransform, R](const Vector2D& loc) {
+            return itransform *
+                   Vector3D(R * std::cos(loc[0]), R * std::sin(loc[0]), loc[1]);
+          },
+          axes());
+  functionLookup->fill(gctx, surfacesRaw);
+  auto staticLookup =
+      std::make_unique<SurfaceArray::CylinderSurfaceGridLookup<PhiAxis, ZAxis>>(
+          detail::CylinderGridTransform(transform, R), axes());
+  staticLookup->fill(gctx, surfacesRaw);
+
+  SurfaceArray functionArray(std::move(functionLookup), surfaces);
+  SurfaceArray staticArray(std::move(staticLookup), surfaces);
+
+  // Pre-rolled random lookup positions on the barrel
+  constexpr int NPOINTS = 1'000;
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> phiDist(-M_PI, M_PI);
+  std::uniform_real_distribution<double> zDist(-halfZ * nZ, halfZ * nZ);
+  std::vector<Vector3D> points;
+  points.reserve(NPOINTS);
+  for (int i = 0; i < NPOINTS; ++i) {
+    double p = phiDist(rng);
+    points.emplace_back(R * std::cos(p), R * std::sin(p), zDist(rng));
+  }
+
+  // === BENCHMARKS ===
+
+  // Benchmark output display and machine-readable summaries
+  std::vector<Acts::Test::MicroBenchmarkSummary> summaries;
+  auto run_bench_with_inputs = [&](auto&& iterationWithArg,
+                                   const std::string& bench_name) {
+    auto bench_result = Acts::Test::microBenchmark(iterationWithArg, points);
+    std::cout << "- " << bench_name << ": " << bench_result << std::endl;
+    summaries.emplace_back(bench_name, bench_result);
+  };
+
+  std::cout << "SurfaceArray lookup on a " << nPhi << " x " << nZ
+            << " barrel:" << std::endl;
+  run_bench_with_inputs(
+      [&](const Vector3D& pos) { return functionArray.at(pos).size(); },
+      "std::function/at");
+  run_bench_with_inputs(
+      [&](const Vector3D& pos) { return staticArray.at(pos).size(); },
+      "static/at");
+  run_bench_with_inputs(
+      [&](const Vector3D& pos) { return functionArray.neighbors(pos).size(); },
+      "std::function/neighbors");
+  run_bench_with_inputs(
+      [&](const Vector3D& pos) { return staticArray.neighbors(pos).size(); },
+      "static/neighbors");
+
+  if (argc > 1) {
+    const std::string path = argv[1];
+    std::ofstream file(path);
+    if (path.size() > 5 and path.substr(path.size() - 5) == ".json") {
+      Acts::Test::writeJson(file, summaries);
+    } else {
+      Acts::Test::writeCsv(file, summaries);
+    }
+    std::cout << "Wrote benchmark summaries to " << path << std::endl;
+  }
+
+  return 0;
+}
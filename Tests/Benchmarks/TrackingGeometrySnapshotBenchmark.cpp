@@ -0,0 +1,81 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Geometry/TrackingGeometrySnapshot.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Tests/CommonHelpers/CylindricalTrackingGeometry.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+using namespace Acts;
+
+// The optional argument is a CSV or JSON file for the benchmark summaries
+int main(int argc, char* argv[]) {
+  // === PROBLEM DATA ===
+
+  GeometryContext gctx;
+  const std::string fileName = "TrackingGeometrySnapshotBenchmark.bin";
+  {
+    Test::CylindricalTrackingGeometry cGeometry(gctx);
+    TrackingGeometrySnapshot::write(gctx, *cGeometry(), fileName);
+  }
+  const TrackingGeometrySnapshot::Config cfg("TrackingGeometrySnapshot",
+                                             Logging::WARNING);
+
+  // === BENCHMARKS ===
+
+  // Every run creates a full geometry, use few runs and a short warmup
+  constexpr size_t NRUNS = 200;
+  const std::chrono::milliseconds warmup(500);
+
+  // Benchmark output display and machine-readable summaries
+  std::vector<Acts::Test::MicroBenchmarkSummary> summaries;
+  auto run_bench = [&](auto&& iteration, const std::string& bench_name) {
+    auto bench_result =
+        Acts::Test::microBenchmark(iteration, 1, NRUNS, warmup);
+    std::cout << "- " << bench_name << ": " << bench_result << std::endl;
+    summaries.emplace_back(bench_name, bench_result);
+  };
+
+  std::cout << "Creation of the cylindrical test geometry:" << std::endl;
+  run_bench(
+      [&] {
+        // the builder owns the detector elements and must not be reused
+        Test::CylindricalTrackingGeometry cGeometry(gctx);
+        return cGeometry();
+      },
+      "build");
+  run_bench(
+      [&] {
+        return TrackingGeometrySnapshot(cfg, fileName).trackingGeometry();
+      },
+      "snapshot/map+decode");
+  TrackingGeometrySnapshot snapshot(cfg, fileName);
+  run_bench([&] { return snapshot.trackingGeometry(); }, "snapshot/decode");
+
+  if (argc > 1) {
+    const std::string path = argv[1];
+    std::ofstream file(path);
+    if (path.size() > 5 and path.substr(path.size() - 5) == ".json") {
+      Acts::Test::writeJson(file, summaries);
+    } else {
+      Acts::Test::writeCsv(file, summaries);
+    }
+    std::cout << "Wrote benchmark summaries to " << path << std::endl;
+  }
+
+  return 0;
+}
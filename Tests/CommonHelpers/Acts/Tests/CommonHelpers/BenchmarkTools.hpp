@@ -9,16 +9,33 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <chrono>
 #include <cmath>
+#include <cstdint>
+#include <cstdlib>
 #include <iomanip>
+#include <iostream>
+#include <istream>
 #include <numeric>
+#include <optional>
 #include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
 #include "Acts/Utilities/TypeTraits.hpp"
 
 namespace Acts {
@@ -173,6 +190,129 @@ inline void assumeWritten(T& clobber) {
 }
 //
 //
+// === HARDWARE COUNTERS ===
+//
+// On Linux, the microbenchmark harness can additionally record a few hardware
+// event counts for every benchmark run through the perf_event_open interface.
+// This is enabled by setting the ACTS_BENCHMARK_HW_COUNTERS environment
+// variable, which allows collecting counters from existing benchmark
+// executables without recompiling them.
+//
+// Counting requires a sufficiently permissive kernel.perf_event_paranoid
+// setting (at most 2 for user-space counting) and a CPU whose counters are
+// exposed to the current (virtual) machine. If the counters cannot be set up,
+// a warning is printed and only the timings are recorded.
+//
+// The counts include the small overhead of the clock measurement around each
+// run, which should be negligible for reasonably tuned `iters_per_run`.
+
+// Hardware event counts, either of one benchmark run or per iteration
+struct HardwareCounters {
+  double cycles = 0;
+  double instructions = 0;
+  double cache_misses = 0;
+  double branch_misses = 0;
+
+  // Instructions per cycle
+  double instructionsPerCycle() const {
+    return cycles > 0 ? instructions / cycles : 0.;
+  }
+};
+
+// Name of the environment variable that enables the hardware counters
+constexpr const char* kHardwareCountersEnv = "ACTS_BENCHMARK_HW_COUNTERS";
+
+namespace benchmark_tools_internal {
+
+#ifdef __linux__
+
+// A group of hardware event counters for the calling thread
+class HardwareCounterGroup {
+ public:
+  HardwareCounterGroup() {
+    const std::array<uint64_t, kNumEvents> events = {
+        PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+    m_fds.fill(-1);
+    for (size_t i = 0; i < kNumEvents; ++i) {
+      perf_event_attr attr;
+      std::memset(&attr, 0, sizeof(attr));
+      attr.size = sizeof(attr);
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.config = events[i];
+      // the whole group is enabled and disabled through its leader
+      attr.disabled = (i == 0) ? 1 : 0;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      attr.read_format = PERF_FORMAT_GROUP;
+      const int group_fd = (i == 0) ? -1 : m_fds[0];
+      m_fds[i] = static_cast<int>(
+          syscall(__NR_perf_event_open, &attr, 0, -1, group_fd, 0));
+      if (m_fds[i] < 0) {
+        closeAll();
+        return;
+      }
+    }
+  }
+  HardwareCounterGroup(const HardwareCounterGroup&) = delete;
+  HardwareCounterGroup& operator=(const HardwareCounterGroup&) = delete;
+  ~HardwareCounterGroup() { closeAll(); }
+
+  bool valid() const { return m_fds[0] >= 0; }
+
+  void start() {
+    ioctl(m_fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(m_fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+  }
+
+  HardwareCounters stop() {
+    ioctl(m_fds[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    // layout of a group read without additional read format flags
+    struct {
+      uint64_t nr;
+      uint64_t values[kNumEvents];
+    } data = {};
+    HardwareCounters counters;
+    if ((read(m_fds[0], &data, sizeof(data)) == sizeof(data)) and
+        (data.nr == kNumEvents)) {
+      counters.cycles = data.values[0];
+      counters.instructions = data.values[1];
+      counters.cache_misses = data.values[2];
+      counters.branch_misses = data.values[3];
+    }
+    return counters;
+  }
+
+ private:
+  static constexpr size_t kNumEvents = 4;
+
+  void closeAll() {
+    for (int& fd : m_fds) {
+      if (fd >= 0) {
+        close(fd);
+      }
+      fd = -1;
+    }
+  }
+
+  std::array<int, kNumEvents> m_fds;
+};
+
+#else
+
+// Hardware counters are not supported on this platform
+class HardwareCounterGroup {
+ public:
+  bool valid() const { return false; }
+  void start() {}
+  HardwareCounters stop() { return {}; }
+};
+
+#endif
+
+}  // namespace benchmark_tools_internal
+//
+//
 // === MICROBENCHMARK HARNESS ===
 
 // Results of a microbenchmark
@@ -185,6 +325,8 @@ struct MicroBenchmarkResult {
 
   size_t iters_per_run;
   std::vector<Duration> run_timings;
+  // Hardware event counts of each run, empty if they were not recorded
+  std::vector<HardwareCounters> run_counters;
 
   // Total benchmark running time
   //
@@ -289,6 +431,42 @@ struct MicroBenchmarkResult {
     return (thirdq - firstq) / (2. * std::sqrt(2.) * 0.4769362762044698733814);
   }
 
+  // Whether hardware event counts were recorded for every run
+  bool hasHardwareCounters() const {
+    return not run_counters.empty() and
+           (run_counters.size() == run_timings.size());
+  }
+
+  // Robust estimator of the hardware event counts per iteration
+  //
+  // Computed for each counter separately as the median count of all runs
+  // divided by the number of iterations per run.
+  //
+  HardwareCounters iterCountersMedian() const {
+    assert(iters_per_run > 0);
+    assert(hasHardwareCounters());
+    auto median = [&](double HardwareCounters::*counter) {
+      std::vector<double> counts;
+      counts.reserve(run_counters.size());
+      for (const auto& run : run_counters) {
+        counts.push_back(run.*counter);
+      }
+      std::sort(counts.begin(), counts.end());
+      const size_t midpoint = counts.size() / 2;
+      const double run_median =
+          (counts.size() % 2 == 0)
+              ? (counts[midpoint - 1] + counts[midpoint]) / 2
+              : counts[midpoint];
+      return run_median / iters_per_run;
+    };
+    HardwareCounters iter_counters;
+    iter_counters.cycles = median(&HardwareCounters::cycles);
+    iter_counters.instructions = median(&HardwareCounters::instructions);
+    iter_counters.cache_misses = median(&HardwareCounters::cache_misses);
+    iter_counters.branch_misses = median(&HardwareCounters::branch_misses);
+    return iter_counters;
+  }
+
   // Standardized display for benchmark statistics
   friend std::ostream& operator<<(std::ostream& os,
                                   const MicroBenchmarkResult& res) {
@@ -301,6 +479,14 @@ struct MicroBenchmarkResult {
        << res.runTimeRobustStddev().count() / 1'000 << "µs per run, "
        << std::setprecision(3) << res.iterTimeAverage().count() << "+/-"
        << res.iterTimeError().count() << "ns per iteration";
+    if (res.hasHardwareCounters()) {
+      const HardwareCounters iter_counters = res.iterCountersMedian();
+      os << ", " << std::setprecision(1) << iter_counters.cycles
+         << " cycles, " << iter_counters.instructions << " instructions, "
+         << std::setprecision(3) << iter_counters.cache_misses
+         << " cache misses, " << iter_counters.branch_misses
+         << " branch misses per iteration";
+    }
     os.precision(old_precision);
     os.flags(old_flags);
     return os;
@@ -399,15 +585,38 @@ MicroBenchmarkResult microBenchmarkImpl(Callable&& run, size_t iters_per_run,
   result.iters_per_run = iters_per_run;
   result.run_timings = std::vector(num_runs, MicroBenchmarkResult::Duration());
 
+  // Hardware counters are only set up on request
+  std::optional<HardwareCounterGroup> counters;
+  if (std::getenv(kHardwareCountersEnv) != nullptr) {
+    counters.emplace();
+    if (not counters->valid()) {
+      static bool warned = false;
+      if (not warned) {
+        std::cerr << "Hardware counters are not available, "
+                  << "only timings are recorded" << std::endl;
+        warned = true;
+      }
+      counters.reset();
+    } else {
+      result.run_counters.reserve(num_runs);
+    }
+  }
+
   const auto warmup_start = Clock::now();
   while (Clock::now() - warmup_start < warmup_time) {
     run();
   }
 
   for (size_t i = 0; i < num_runs; ++i) {
+    if (counters) {
+      counters->start();
+    }
     const auto start = Clock::now();
     run();
     result.run_timings[i] = Clock::now() - start;
+    if (counters) {
+      result.run_counters.push_back(counters->stop());
+    }
   }
 
   return result;
@@ -506,5 +715,276 @@ MicroBenchmarkResult microBenchmark(
       inputs.size(), num_runs, warmup_time);
 }
 
+//
+//
+// === MACHINE-READABLE OUTPUT ===
+//
+// For tracking benchmark numbers over time, e.g. in regression dashboards,
+// the statistics of a benchmark result can be condensed into a named summary,
+// which can be written as CSV or JSON. The CSV output can be read back in
+// order to compare new measurements against a stored baseline.
+
+// Named summary statistics of a microbenchmark result
+//
+// All times are given in nanoseconds. The hardware counters are per iteration
+// and only valid if `has_counters` is set.
+//
+struct MicroBenchmarkSummary {
+  std::string name;
+  size_t num_runs = 0;
+  size_t iters_per_run = 0;
+  double total_time = 0;
+  double run_time_median = 0;
+  double run_time_first_quartile = 0;
+  double run_time_third_quartile = 0;
+  double run_time_robust_stddev = 0;
+  double iter_time_average = 0;
+  double iter_time_error = 0;
+  bool has_counters = false;
+  HardwareCounters iter_counters;
+
+  MicroBenchmarkSummary() = default;
+  MicroBenchmarkSummary(std::string name_, const MicroBenchmarkResult& res)
+      : name(std::move(name_)),
+        num_runs(res.run_timings.size()),
+        iters_per_run(res.iters_per_run),
+        total_time(res.totalTime().count()),
+        run_time_median(res.runTimeMedian().count()),
+        run_time_robust_stddev(res.runTimeRobustStddev().count()),
+        iter_time_average(res.iterTimeAverage().count()),
+        iter_time_error(res.iterTimeError().count()),
+        has_counters(res.hasHardwareCounters()) {
+    auto [firstq, thirdq] = res.runTimeQuartiles();
+    run_time_first_quartile = firstq.count();
+    run_time_third_quartile = thirdq.count();
+    if (has_counters) {
+      iter_counters = res.iterCountersMedian();
+    }
+  }
+
+  // Standard error of the robust iteration time estimator
+  //
+  // The iteration time is derived from the median run time, whose standard
+  // error for (mostly) normal run time distributions is sqrt(pi/2) times the
+  // standard error of the mean, here computed from the robust stddev.
+  //
+  double iterTimeAverageError() const {
+    if ((num_runs == 0) or (iters_per_run == 0)) {
+      return 0.;
+    }
+    return 1.2533141373155002 * run_time_robust_stddev /
+           std::sqrt(num_runs) / iters_per_run;
+  }
+
+  // Write the CSV column names
+  static void writeCsvHeader(std::ostream& os) {
+    os << "name,num_runs,iters_per_run,total_time_ns,run_time_median_ns,"
+          "run_time_first_quartile_ns,run_time_third_quartile_ns,"
+          "run_time_robust_stddev_ns,iter_time_average_ns,"
+          "iter_time_error_ns,iter_cycles,iter_instructions,"
+          "iter_cache_misses,iter_branch_misses\n";
+  }
+
+  // Write the summary as one CSV row, counters are empty if not recorded
+  void writeCsv(std::ostream& os) const {
+    auto old_precision = os.precision();
+    os << std::setprecision(17) << quoted(name, '"') << ',' << num_runs << ','
+       << iters_per_run << ',' << total_time << ',' << run_time_median << ','
+       << run_time_first_quartile << ',' << run_time_third_quartile << ','
+       << run_time_robust_stddev << ',' << iter_time_average << ','
+       << iter_time_error;
+    if (has_counters) {
+      os << ',' << iter_counters.cycles << ',' << iter_counters.instructions
+         << ',' << iter_counters.cache_misses << ','
+         << iter_counters.branch_misses << '\n';
+    } else {
+      os << ",,,,\n";
+    }
+    os.precision(old_precision);
+  }
+
+  // Write the summary as one JSON object, counters are null if not recorded
+  void writeJson(std::ostream& os) const {
+    auto old_precision = os.precision();
+    auto counter = [&](double value) -> std::ostream& {
+      if (has_counters) {
+        return os << value;
+      } else {
+        return os << "null";
+      }
+    };
+    os << std::setprecision(17) << "{\"name\": " << quoted(name, '\\')
+       << ", \"num_runs\": " << num_runs
+       << ", \"iters_per_run\": " << iters_per_run
+       << ", \"total_time_ns\": " << total_time
+       << ", \"run_time_median_ns\": " << run_time_median
+       << ", \"run_time_first_quartile_ns\": " << run_time_first_quartile
+       << ", \"run_time_third_quartile_ns\": " << run_time_third_quartile
+       << ", \"run_time_robust_stddev_ns\": " << run_time_robust_stddev
+       << ", \"iter_time_average_ns\": " << iter_time_average
+       << ", \"iter_time_error_ns\": " << iter_time_error
+       << ", \"iter_cycles\": ";
+    counter(iter_counters.cycles) << ", \"iter_instructions\": ";
+    counter(iter_counters.instructions) << ", \"iter_cache_misses\": ";
+    counter(iter_counters.cache_misses) << ", \"iter_branch_misses\": ";
+    counter(iter_counters.branch_misses) << "}";
+    os.precision(old_precision);
+  }
+
+  // Read all summaries from CSV written with writeCsvHeader/writeCsv
+  //
+  // Throws std::runtime_error on malformed input.
+  //
+  static std::vector<MicroBenchmarkSummary> readCsv(std::istream& is) {
+    std::vector<MicroBenchmarkSummary> summaries;
+    std::string line;
+    // skip the header
+    std::getline(is, line);
+    while (std::getline(is, line)) {
+      if (line.empty()) {
+        continue;
+      }
+      const std::vector<std::string> fields = splitCsv(line);
+      if (fields.size() != 14) {
+        throw std::runtime_error("Invalid benchmark summary CSV row '" + line +
+                                 "'");
+      }
+      try {
+        MicroBenchmarkSummary summary;
+        summary.name = fields[0];
+        summary.num_runs = std::stoul(fields[1]);
+        summary.iters_per_run = std::stoul(fields[2]);
+        summary.total_time = std::stod(fields[3]);
+        summary.run_time_median = std::stod(fields[4]);
+        summary.run_time_first_quartile = std::stod(fields[5]);
+        summary.run_time_third_quartile = std::stod(fields[6]);
+        summary.run_time_robust_stddev = std::stod(fields[7]);
+        summary.iter_time_average = std::stod(fields[8]);
+        summary.iter_time_error = std::stod(fields[9]);
+        summary.has_counters = not fields[10].empty();
+        if (summary.has_counters) {
+          summary.iter_counters.cycles = std::stod(fields[10]);
+          summary.iter_counters.instructions = std::stod(fields[11]);
+          summary.iter_counters.cache_misses = std::stod(fields[12]);
+          summary.iter_counters.branch_misses = std::stod(fields[13]);
+        }
+        summaries.push_back(std::move(summary));
+      } catch (const std::logic_error&) {
+        throw std::runtime_error("Invalid benchmark summary CSV row '" + line +
+                                 "'");
+      }
+    }
+    return summaries;
+  }
+
+ private:
+  // Quote a string, escaping embedded quotes with the given character
+  static std::string quoted(const std::string& str, char escape) {
+    std::string out = "\"";
+    for (char c : str) {
+      if (c == '"' or c == escape) {
+        out += escape;
+      }
+      out += c;
+    }
+    return out += '"';
+  }
+
+  // Split a CSV line into fields, handling quoted fields
+  static std::vector<std::string> splitCsv(const std::string& line) {
+    std::vector<std::string> fields(1);
+    bool in_quotes = false;
+    for (size_t i = 0; i < line.size(); ++i) {
+      const char c = line[i];
+      if (in_quotes) {
+        if (c == '"' and (i + 1) < line.size() and line[i + 1] == '"') {
+          fields.back() += c;
+          ++i;
+        } else if (c == '"') {
+          in_quotes = false;
+        } else {
+          fields.back() += c;
+        }
+      } else if (c == '"') {
+        in_quotes = true;
+      } else if (c == ',') {
+        fields.emplace_back();
+      } else if (c != '\r') {
+        fields.back() += c;
+      }
+    }
+    return fields;
+  }
+};
+
+// Write a set of benchmark summaries as CSV
+inline void writeCsv(std::ostream& os,
+                     const std::vector<MicroBenchmarkSummary>& summaries) {
+  MicroBenchmarkSummary::writeCsvHeader(os);
+  for (const auto& summary : summaries) {
+    summary.writeCsv(os);
+  }
+}
+
+// Write a set of benchmark summaries as a JSON array
+inline void writeJson(std::ostream& os,
+                      const std::vector<MicroBenchmarkSummary>& summaries) {
+  os << "[";
+  for (size_t i = 0; i < summaries.size(); ++i) {
+    os << ((i == 0) ? "\n  " : ",\n  ");
+    summaries[i].writeJson(os);
+  }
+  os << "\n]\n";
+}
+//
+//
+// === REGRESSION CHECKS ===
+
+// Comparison of a benchmark measurement against its baseline
+struct MicroBenchmarkComparison {
+  std::string name;
+  // Iteration times in nanoseconds
+  double baseline_time = 0;
+  double current_time = 0;
+  // Relative change of the iteration time, positive means slower
+  double relative_change = 0;
+  // Change of the iteration time in units of the combined robust error
+  double significance = 0;
+  // Whether the change is both large and significant enough to be flagged
+  bool is_regression = false;
+};
+
+// Compare a benchmark measurement against its baseline
+//
+// The iteration times are compared using the robust iteration time estimator
+// and its standard error. A slowdown is flagged as a regression only if it is
+// larger than `max_relative_slowdown` and at the same time exceeds
+// `min_significance` times the combined error of both measurements, so that
+// neither tiny systematic shifts nor large but noisy fluctuations are flagged.
+//
+inline MicroBenchmarkComparison compareToBaseline(
+    const MicroBenchmarkSummary& baseline, const MicroBenchmarkSummary& current,
+    double max_relative_slowdown = 0.05, double min_significance = 3.) {
+  MicroBenchmarkComparison comparison;
+  comparison.name = current.name;
+  comparison.baseline_time = baseline.iter_time_average;
+  comparison.current_time = current.iter_time_average;
+  const double change = current.iter_time_average - baseline.iter_time_average;
+  const double error = std::hypot(baseline.iterTimeAverageError(),
+                                  current.iterTimeAverageError());
+  if (baseline.iter_time_average > 0) {
+    comparison.relative_change = change / baseline.iter_time_average;
+  }
+  if (error > 0) {
+    comparison.significance = change / error;
+  } else if (change != 0) {
+    comparison.significance = std::copysign(INFINITY, change);
+  }
+  comparison.is_regression =
+      (comparison.relative_change > max_relative_slowdown) and
+      (comparison.significance > min_significance);
+  return comparison;
+}
+
 }  // namespace Test
 }  // namespace Acts
@@ -0,0 +1,100 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+/// @brief compare the sequential and the concurrent DD4hep conversion
+///
+/// Usage: ActsCompareDD4hepConversion <compact.xml> [<compact.xml> ...]
+///
+/// The detector is converted with a task pool and sequentially. The sensitive
+/// surfaces of both tracking geometries must have the same GeometryIDs and
+/// transforms. The exit code is non-zero if they differ.
+
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+
+#include <DD4hep/Detector.h>
+#include <TROOT.h>
+
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/GeometryID.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Plugins/DD4hep/ConvertDD4hepDetector.hpp"
+#include "Acts/Surfaces/Surface.hpp"
+#include "Acts/Utilities/TaskPool.hpp"
+
+/// Collect the sensitive surfaces by their GeometryID.
+static std::map<Acts::GeometryID, const Acts::Surface*> collectSurfaces(
+    const Acts::TrackingGeometry& trackingGeometry, bool& unique) {
+  std::map<Acts::GeometryID, const Acts::Surface*> surfaces;
+  trackingGeometry.visitSurfaces([&](const Acts::Surface* surface) {
+    if (not surfaces.emplace(surface->geoID(), surface).second) {
+      std::cerr << "Duplicate GeometryID " << surface->geoID() << '\n';
+      unique = false;
+    }
+  });
+  return surfaces;
+}
+
+int main(int argc, char* argv[]) {
+  if (argc < 2) {
+    std::cerr << "Usage: " << argv[0] << " <compact.xml> [<compact.xml> ...]\n";
+    return EXIT_FAILURE;
+  }
+
+  // the concurrent conversion requires a thread-safe ROOT
+  ROOT::EnableThreadSafety();
+  dd4hep::Detector& detector = dd4hep::Detector::getInstance();
+  for (int i = 1; i < argc; ++i) {
+    detector.fromCompact(argv[i]);
+  }
+  detector.volumeManager();
+  detector.apply("DD4hepVolumeManager", 0, nullptr);
+
+  Acts::GeometryContext gctx;
+  // the concurrent conversion runs first, it has to fill the lazily
+  // evaluated DD4hep caches itself
+  auto concurrent = Acts::convertDD4hepDetector(
+      detector.world(), Acts::Logging::WARNING, Acts::equidistant,
+      Acts::equidistant, Acts::equidistant, Acts::UnitConstants::mm,
+      Acts::UnitConstants::mm, Acts::UnitConstants::fm,
+      Acts::sortDetElementsByID, gctx, nullptr,
+      std::make_shared<Acts::TaskPool>());
+  auto sequential = Acts::convertDD4hepDetector(detector.world(),
+                                                Acts::Logging::WARNING);
+
+  bool unique = true;
+  const auto concurrentSurfaces = collectSurfaces(*concurrent, unique);
+  const auto sequentialSurfaces = collectSurfaces(*sequential, unique);
+
+  size_t nMismatches = 0;
+  if (concurrentSurfaces.size() != sequentialSurfaces.size()) {
+    std::cerr << "Number of sensitive surfaces differs: "
+              << concurrentSurfaces.size() << " concurrent vs. "
+              << sequentialSurfaces.size() << " sequential\n";
+    ++nMismatches;
+  }
+  for (const auto& [geoID, surface] : sequentialSurfaces) {
+    auto it = concurrentSurfaces.find(geoID);
+    if (it == concurrentSurfaces.end()) {
+      std::cerr << "GeometryID " << geoID
+                << " is missing in the concurrent conversion\n";
+      ++nMismatches;
+    } else if (it->second->transform(gctx).matrix() !=
+               surface->transform(gctx).matrix()) {
+      std::cerr << "Transform of GeometryID " << geoID << " differs\n";
+      ++nMismatches;
+    }
+  }
+
+  std::cout << "Compared " << sequentialSurfaces.size()
+            << " sensitive surfaces, " << nMismatches << " mismatches\n";
+  return (unique and nMismatches == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
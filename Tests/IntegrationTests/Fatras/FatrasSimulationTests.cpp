@@ -19,6 +19,8 @@
 #include "Acts/Propagator/StraightLineStepper.hpp"
 #include "Acts/Tests/CommonHelpers/CylindricalTrackingGeometry.hpp"
 #include "Acts/Utilities/UnitVectors.hpp"
+#include "ActsFatras/EventData/HitContainer.hpp"
+#include "ActsFatras/EventData/ParticleContainer.hpp"
 #include "ActsFatras/Kernel/PhysicsList.hpp"
 #include "ActsFatras/Kernel/Simulator.hpp"
 #include "ActsFatras/Physics/StandardPhysicsLists.hpp"
@@ -193,6 +195,25 @@ BOOST_DATA_TEST_CASE(FatrasSimulation, dataset, pdg, phi, eta, p,
   // should always succeed
   BOOST_TEST(result.ok());
 
+  // the same simulation with struct-of-arrays outputs gives the same results
+  {
+    Generator soaGenerator;
+    std::vector<ActsFatras::Particle> soaInitial;
+    ActsFatras::ParticleContainer soaFinal;
+    ActsFatras::HitContainer<float> soaHits;
+    auto soaResult = simulator.simulate(geoCtx, magCtx, soaGenerator, input,
+                                        soaInitial, soaFinal, soaHits);
+    BOOST_TEST(soaResult.ok());
+    BOOST_TEST(soaInitial.size() == simulatedInitial.size());
+    BOOST_TEST(soaFinal.size() == simulatedFinal.size());
+    BOOST_TEST(soaHits.size() == hits.size());
+    for (std::size_t i = 0; i < std::min(soaHits.size(), hits.size()); ++i) {
+      BOOST_TEST(soaHits.particleId(i) == hits[i].particleId());
+      BOOST_TEST(soaHits.geometryId(i) == hits[i].geometryId());
+      BOOST_TEST(soaHits.index(i) == hits[i].index());
+    }
+  }
+
   // ensure simulated particle containers have consistent content
   BOOST_TEST(simulatedInitial.size() == simulatedFinal.size());
   for (std::size_t i = 0; i < simulatedInitial.size(); ++i) {
@@ -96,6 +96,135 @@ BOOST_AUTO_TEST_CASE(micro_benchmark_result) {
                     "8000.000+/-240780.940ns per iteration");
 }
 
+BOOST_AUTO_TEST_CASE(micro_benchmark_result_counters) {
+  MicroBenchmarkResult res;
+  res.iters_per_run = 10;
+  res.run_timings = {std::chrono::microseconds(10),
+                     std::chrono::microseconds(30),
+                     std::chrono::microseconds(20)};
+  BOOST_CHECK(not res.hasHardwareCounters());
+
+  res.run_counters.resize(3);
+  res.run_counters[0].cycles = 1000;
+  res.run_counters[1].cycles = 3000;
+  res.run_counters[2].cycles = 2000;
+  for (auto& run : res.run_counters) {
+    run.instructions = 2 * run.cycles;
+    run.cache_misses = 10;
+    run.branch_misses = 5;
+  }
+  BOOST_CHECK(res.hasHardwareCounters());
+  const auto iter_counters = res.iterCountersMedian();
+  CHECK_CLOSE_REL(iter_counters.cycles, 200., 1e-12);
+  CHECK_CLOSE_REL(iter_counters.instructions, 400., 1e-12);
+  CHECK_CLOSE_REL(iter_counters.cache_misses, 1., 1e-12);
+  CHECK_CLOSE_REL(iter_counters.branch_misses, 0.5, 1e-12);
+  CHECK_CLOSE_REL(iter_counters.instructionsPerCycle(), 2., 1e-12);
+
+  std::ostringstream os;
+  os << res;
+  BOOST_CHECK_NE(os.str().find("200.0 cycles, 400.0 instructions, "
+                               "1.000 cache misses, 0.500 branch misses"),
+                 std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(micro_benchmark_summary_csv_json) {
+  MicroBenchmarkResult res;
+  res.iters_per_run = 4;
+  res.run_timings = {
+      std::chrono::microseconds(12), std::chrono::microseconds(8),
+      std::chrono::microseconds(10), std::chrono::microseconds(11)};
+  MicroBenchmarkSummary timings("plain, \"quoted\"", res);
+  res.run_counters.resize(4);
+  for (auto& run : res.run_counters) {
+    run.cycles = 40;
+    run.instructions = 100;
+  }
+  MicroBenchmarkSummary counters("counters", res);
+
+  BOOST_CHECK_EQUAL(timings.num_runs, 4u);
+  BOOST_CHECK_EQUAL(timings.iters_per_run, 4u);
+  CHECK_CLOSE_REL(timings.iter_time_average, res.iterTimeAverage().count(),
+                  1e-12);
+  CHECK_CLOSE_REL(timings.run_time_first_quartile,
+                  res.runTimeQuartiles().first.count(), 1e-12);
+  BOOST_CHECK(not timings.has_counters);
+  BOOST_CHECK(counters.has_counters);
+  CHECK_CLOSE_REL(counters.iter_counters.cycles, 10., 1e-12);
+
+  // csv round trip
+  std::stringstream csv;
+  writeCsv(csv, {timings, counters});
+  const auto read = MicroBenchmarkSummary::readCsv(csv);
+  BOOST_CHECK_EQUAL(read.size(), 2u);
+  BOOST_CHECK_EQUAL(read[0].name, timings.name);
+  BOOST_CHECK_EQUAL(read[0].num_runs, timings.num_runs);
+  BOOST_CHECK_EQUAL(read[0].run_time_median, timings.run_time_median);
+  BOOST_CHECK_EQUAL(read[0].iter_time_error, timings.iter_time_error);
+  BOOST_CHECK(not read[0].has_counters);
+  BOOST_CHECK_EQUAL(read[1].name, "counters");
+  BOOST_CHECK(read[1].has_counters);
+  BOOST_CHECK_EQUAL(read[1].iter_counters.instructions, 25.);
+
+  std::istringstream invalid("header\nname,1,2\n");
+  BOOST_CHECK_THROW(MicroBenchmarkSummary::readCsv(invalid),
+                    std::runtime_error);
+
+  // json
+  std::ostringstream json;
+  writeJson(json, {timings, counters});
+  const std::string str = json.str();
+  BOOST_CHECK_EQUAL(str.front(), '[');
+  BOOST_CHECK_NE(str.find("\"name\": \"plain, \\\"quoted\\\"\""),
+                 std::string::npos);
+  BOOST_CHECK_NE(str.find("\"iter_cycles\": null"), std::string::npos);
+  BOOST_CHECK_NE(str.find("\"iter_cycles\": 10"), std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(micro_benchmark_compare_to_baseline) {
+  MicroBenchmarkSummary baseline;
+  baseline.name = "bench";
+  baseline.num_runs = 100;
+  baseline.iters_per_run = 10;
+  baseline.iter_time_average = 100.;
+  // gives an error of about 1ns on the iteration time
+  baseline.run_time_robust_stddev = 80.;
+  MicroBenchmarkSummary current = baseline;
+  CHECK_CLOSE_REL(baseline.iterTimeAverageError(), 1.0026, 1e-4);
+
+  // no change
+  auto same = compareToBaseline(baseline, current);
+  BOOST_CHECK_EQUAL(same.relative_change, 0.);
+  BOOST_CHECK(not same.is_regression);
+
+  // large and significant slowdown
+  current.iter_time_average = 110.;
+  auto slower = compareToBaseline(baseline, current);
+  CHECK_CLOSE_REL(slower.relative_change, 0.1, 1e-12);
+  CHECK_CLOSE_REL(slower.significance,
+                  10. / (std::sqrt(2.) * baseline.iterTimeAverageError()),
+                  1e-12);
+  BOOST_CHECK(slower.is_regression);
+  // ... but below a looser threshold
+  BOOST_CHECK(not compareToBaseline(baseline, current, 0.2).is_regression);
+
+  // large but insignificant slowdown
+  current.run_time_robust_stddev = 800.;
+  BOOST_CHECK(not compareToBaseline(baseline, current).is_regression);
+
+  // significant but small slowdown
+  current.iter_time_average = 102.;
+  current.run_time_robust_stddev = 8.;
+  baseline.run_time_robust_stddev = 8.;
+  BOOST_CHECK(not compareToBaseline(baseline, current).is_regression);
+
+  // speedups are never regressions
+  current.iter_time_average = 50.;
+  auto faster = compareToBaseline(baseline, current);
+  BOOST_CHECK_LT(faster.relative_change, 0.);
+  BOOST_CHECK(not faster.is_regression);
+}
+
 BOOST_AUTO_TEST_CASE(micro_benchmark) {
   int counter = 0;
   microBenchmark([&] { ++counter; }, 15, 7, std::chrono::milliseconds(0));
@@ -10,12 +10,16 @@
 
 #include "Acts/Geometry/CylinderVolumeBuilder.hpp"
 #include "Acts/Geometry/CylinderVolumeHelper.hpp"
+#include "Acts/Geometry/Layer.hpp"
 #include "Acts/Geometry/LayerArrayCreator.hpp"
 #include "Acts/Geometry/LayerCreator.hpp"
 #include "Acts/Geometry/PassiveLayerBuilder.hpp"
 #include "Acts/Geometry/TrackingGeometry.hpp"
 #include "Acts/Geometry/TrackingGeometryBuilder.hpp"
+#include "Acts/Geometry/TrackingVolume.hpp"
 #include "Acts/Geometry/TrackingVolumeArrayCreator.hpp"
+#include "Acts/Geometry/VolumeBounds.hpp"
+#include "Acts/Utilities/TaskPool.hpp"
 #include "Acts/Utilities/Units.hpp"
 
 using namespace Acts::UnitLiterals;
@@ -26,6 +30,21 @@ namespace Test {
 // Create a test context
 GeometryContext tgContext = GeometryContext();
 
+// Collect the identifiers of all layers in the volume hierarchy
+void collectLayerIds(const TrackingVolume& volume,
+                     std::vector<GeometryID>& geoIds) {
+  if (volume.confinedLayers() != nullptr) {
+    for (const auto& layer : volume.confinedLayers()->arrayObjects()) {
+      geoIds.push_back(layer->geoID());
+    }
+  }
+  if (volume.confinedVolumes() != nullptr) {
+    for (const auto& subVolume : volume.confinedVolumes()->arrayObjects()) {
+      collectLayerIds(*subVolume, geoIds);
+    }
+  }
+}
+
 /// @brief Unit test for a three layer detector parameters
 /// Testing the Tool chain in the geometry building process
 ///
@@ -113,6 +132,39 @@ BOOST_AUTO_TEST_CASE(SimpleGeometryTest) {
   auto tGeometry = tgBuilder.trackingGeometry(tgContext);
 
   BOOST_CHECK(tGeometry != nullptr);
+
+  // Build the same geometry with the layers built concurrently
+  TrackingGeometryBuilder::Config stagedConfig;
+  for (const auto& volumeBuilder :
+       {beamPipeVolumeBuilder, centralVolumeBuilder}) {
+    stagedConfig.stagedVolumeBuilders.push_back(
+        [=](const auto& context) -> TrackingGeometryBuilder::VolumeBuilder {
+          auto content = volumeBuilder->buildContent(context);
+          return [=](const auto& vcontext, const auto& inner, const auto&) {
+            return volumeBuilder->trackingVolume(vcontext, content, inner);
+          };
+        });
+  }
+  stagedConfig.trackingVolumeHelper = cylinderVolumeHelper;
+  stagedConfig.taskPool = std::make_shared<TaskPool>(2);
+
+  TrackingGeometryBuilder stagedBuilder(stagedConfig);
+  auto stagedGeometry = stagedBuilder.trackingGeometry(tgContext);
+  BOOST_CHECK(stagedGeometry != nullptr);
+
+  BOOST_CHECK(stagedGeometry->highestTrackingVolume()->volumeBounds() ==
+              tGeometry->highestTrackingVolume()->volumeBounds());
+  std::vector<GeometryID> geoIds;
+  collectLayerIds(*tGeometry->highestTrackingVolume(), geoIds);
+  std::vector<GeometryID> stagedGeoIds;
+  collectLayerIds(*stagedGeometry->highestTrackingVolume(), stagedGeoIds);
+  BOOST_CHECK(not geoIds.empty());
+  BOOST_CHECK(geoIds == stagedGeoIds);
+
+  // Plain and staged builders can not be mixed
+  stagedConfig.trackingVolumeBuilders = tgbConfig.trackingVolumeBuilders;
+  BOOST_CHECK_THROW(TrackingGeometryBuilder{stagedConfig},
+                    std::invalid_argument);
 }
 }  // namespace Test
 }  // namespace Acts
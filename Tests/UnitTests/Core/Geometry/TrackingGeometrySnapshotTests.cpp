@@ -0,0 +1,138 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Geometry/Layer.hpp"
+#include "Acts/Geometry/TrackingGeometry.hpp"
+#include "Acts/Geometry/TrackingGeometrySnapshot.hpp"
+#include "Acts/Geometry/TrackingVolume.hpp"
+#include "Acts/Surfaces/SurfaceArray.hpp"
+#include "Acts/Tests/CommonHelpers/CubicTrackingGeometry.hpp"
+#include "Acts/Tests/CommonHelpers/CylindricalTrackingGeometry.hpp"
+
+namespace Acts {
+namespace Test {
+
+namespace {
+GeometryContext tgContext = GeometryContext();
+
+std::vector<char> readFile(const std::string& fileName) {
+  std::ifstream file(fileName, std::ios::binary);
+  return std::vector<char>(std::istreambuf_iterator<char>(file),
+                           std::istreambuf_iterator<char>());
+}
+
+/// Write a snapshot, read it back and write the recreated geometry again
+void checkRoundTrip(const TrackingGeometry& tGeometry,
+                    const std::string& fileName, bool exact) {
+  TrackingGeometrySnapshot::write(tgContext, tGeometry, fileName);
+  TrackingGeometrySnapshot snapshot(
+      TrackingGeometrySnapshot::Config("TrackingGeometrySnapshot",
+                                       Logging::WARNING),
+      fileName);
+  auto recreated = snapshot.trackingGeometry();
+  BOOST_REQUIRE(recreated != nullptr);
+
+  // the recreated geometry has the same content, the reference radius of
+  // cylindrical surface grids is recomputed from the bin centers and is only
+  // reproduced up to rounding
+  const std::string copyName = "copy_" + fileName;
+  TrackingGeometrySnapshot::write(tgContext, *recreated, copyName);
+  auto original = readFile(fileName);
+  auto copy = readFile(copyName);
+  BOOST_CHECK(not original.empty());
+  BOOST_CHECK_EQUAL(original.size(), copy.size());
+  if (exact) {
+    BOOST_CHECK(original == copy);
+  }
+
+  // and resolves the same surfaces
+  std::vector<const Surface*> sensitive;
+  tGeometry.visitSurfaces(
+      [&](const Surface* surface) { sensitive.push_back(surface); });
+  size_t nSensitive = 0;
+  recreated->visitSurfaces([&](const Surface*) { ++nSensitive; });
+  BOOST_CHECK_EQUAL(sensitive.size(), nSensitive);
+  for (const auto* surface : sensitive) {
+    Vector3D center = surface->center(tgContext);
+    const auto* volume = recreated->lowestTrackingVolume(tgContext, center);
+    BOOST_REQUIRE(volume != nullptr);
+    BOOST_CHECK(volume->geoID() ==
+                tGeometry.lowestTrackingVolume(tgContext, center)->geoID());
+    const auto* layer = volume->associatedLayer(tgContext, center);
+    BOOST_REQUIRE(layer != nullptr);
+    BOOST_CHECK(layer->geoID() == surface->associatedLayer()->geoID());
+    if (layer->surfaceArray() == nullptr) {
+      continue;
+    }
+    bool found = false;
+    for (const auto* candidate : layer->surfaceArray()->at(center)) {
+      if (candidate->geoID() == surface->geoID()) {
+        found = true;
+        BOOST_CHECK(candidate->bounds() == surface->bounds());
+        BOOST_CHECK(candidate->transform(tgContext).isApprox(
+            surface->transform(tgContext)));
+        BOOST_CHECK_EQUAL(candidate->surfaceMaterial() != nullptr,
+                          surface->surfaceMaterial() != nullptr);
+      }
+    }
+    BOOST_CHECK(found);
+  }
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(Geometry)
+
+BOOST_AUTO_TEST_CASE(TrackingGeometrySnapshot_cylindrical) {
+  CylindricalTrackingGeometry cGeometry(tgContext);
+  auto tGeometry = cGeometry();
+  checkRoundTrip(*tGeometry, "CylindricalTrackingGeometry.snapshot", false);
+}
+
+BOOST_AUTO_TEST_CASE(TrackingGeometrySnapshot_cubic) {
+  CubicTrackingGeometry cGeometry(tgContext);
+  auto tGeometry = cGeometry();
+  checkRoundTrip(*tGeometry, "CubicTrackingGeometry.snapshot", true);
+}
+
+BOOST_AUTO_TEST_CASE(TrackingGeometrySnapshot_invalid) {
+  TrackingGeometrySnapshot::Config cfg;
+  BOOST_CHECK_THROW(TrackingGeometrySnapshot(cfg, "missing.snapshot"),
+                    std::invalid_argument);
+
+  const std::string fileName = "invalid.snapshot";
+  {
+    std::ofstream file(fileName, std::ios::binary);
+    file << "not a tracking geometry snapshot";
+  }
+  BOOST_CHECK_THROW(TrackingGeometrySnapshot(cfg, fileName),
+                    std::invalid_argument);
+
+  // a truncated snapshot is detected when it is decoded
+  CylindricalTrackingGeometry cGeometry(tgContext);
+  TrackingGeometrySnapshot::write(tgContext, *cGeometry(), fileName);
+  auto content = readFile(fileName);
+  {
+    std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+    file.write(content.data(), content.size() / 2);
+  }
+  TrackingGeometrySnapshot snapshot(cfg, fileName);
+  BOOST_CHECK_THROW(snapshot.trackingGeometry(), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Test
+}  // namespace Acts
@@ -10,6 +10,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include "Acts/Material/Interactions.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
 #include "Acts/Tests/CommonHelpers/PredefinedMaterials.hpp"
 #include "Acts/Utilities/PdgParticle.hpp"
 #include "Acts/Utilities/Units.hpp"
@@ -105,4 +106,55 @@ BOOST_DATA_TEST_CASE(vacuum, thickness* particle* momentum, x, i, m, q, p) {
   BOOST_TEST(computeMultipleScatteringTheta0(vacuum, i, m, qOverP, q) == 0);
 }
 
+// batched computations must agree with the scalar ones
+BOOST_AUTO_TEST_CASE(batch_consistency) {
+  Acts::MaterialPropertiesBatch slabs;
+  Acts::ParticleKinematicsBatch particles;
+  std::vector<Acts::MaterialProperties> slabsAoS;
+  for (double x : valuesThickness) {
+    for (size_t j = 0; j < 4; ++j) {
+      for (double p : {100_MeV, 1_GeV, 10_GeV, 100_GeV, 1_TeV, 10_TeV}) {
+        // alternate between material and vacuum
+        slabsAoS.emplace_back(material, x);
+        slabsAoS.emplace_back(Acts::Material(), x);
+        for (size_t k = 0; k < 2; ++k) {
+          particles.push_back(pdg[j], mass[j], charge[j] / p, charge[j]);
+        }
+      }
+    }
+  }
+  for (const auto& slab : slabsAoS) {
+    slabs.push_back(slab);
+  }
+  BOOST_TEST(slabs.size() == particles.size());
+
+  Acts::InteractionsBatchResult result;
+  computeInteractions(slabs, particles, result);
+  BOOST_TEST(result.energyLossBethe.size() == particles.size());
+
+  for (size_t k = 0; k < particles.size(); ++k) {
+    const auto& slab = slabsAoS[k];
+    const auto i = particles.pdg[k];
+    const auto m = particles.mass[k];
+    const auto qOverP = particles.qOverP[k];
+    const auto q = particles.charge[k];
+    // small threshold is only relevant for the vacuum entries
+    CHECK_CLOSE_OR_SMALL(result.energyLossBethe[k],
+                         computeEnergyLossBethe(slab, i, m, qOverP, q), 1e-5,
+                         1e-12);
+    CHECK_CLOSE_OR_SMALL(result.energyLossLandau[k],
+                         computeEnergyLossLandau(slab, i, m, qOverP, q), 1e-5,
+                         1e-12);
+    CHECK_CLOSE_OR_SMALL(result.energyLossLandauSigma[k],
+                         computeEnergyLossLandauSigma(slab, i, m, qOverP, q),
+                         1e-5, 1e-12);
+    CHECK_CLOSE_OR_SMALL(
+        result.energyLossLandauSigmaQOverP[k],
+        computeEnergyLossLandauSigmaQOverP(slab, i, m, qOverP, q), 1e-5, 1e-12);
+    CHECK_CLOSE_OR_SMALL(result.multipleScatteringTheta0[k],
+                         computeMultipleScatteringTheta0(slab, i, m, qOverP, q),
+                         1e-5, 1e-12);
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,123 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/data/test_case.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/MagneticField/SolenoidBField.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/StepperConcept.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "Acts/Utilities/Units.hpp"
+
+namespace bdata = boost::unit_test::data;
+using namespace Acts::UnitLiterals;
+
+namespace Acts {
+namespace Test {
+
+using Covariance = BoundSymMatrix;
+template <typename bfield_t, typename scalar_t>
+using Stepper = EigenStepper<bfield_t, StepperExtensionList<DefaultExtension>,
+                             detail::VoidAuctioneer, scalar_t>;
+
+// Create a test context
+GeometryContext tgContext = GeometryContext();
+MagneticFieldContext mfContext = MagneticFieldContext();
+
+static_assert(StepperConcept<Stepper<ConstantBField, float>>,
+              "Single precision EigenStepper does not fulfill the stepper "
+              "concept.");
+
+/// Start parameters with some major correlations
+CurvilinearParameters startParameters(double phi, double theta, double p,
+                                      double q) {
+  Covariance cov;
+  // clang-format off
+  cov <<
+   10_mm, 0, 0.123, 0, 0.5, 0,
+   0, 10_mm, 0, 0.162, 0, 0,
+   0.123, 0, 0.1, 0, 0, 0,
+   0, 0.162, 0, 0.1, 0, 0,
+   0.5, 0, 0, 0, 1_e / 10_GeV, 0,
+   0, 0, 0, 0, 0, 1_us;
+  // clang-format on
+  Vector3D mom(p * std::sin(theta) * std::cos(phi),
+               p * std::sin(theta) * std::sin(phi), p * std::cos(theta));
+  return CurvilinearParameters(cov, Vector3D(0., 0., 0.), mom, q, 0.);
+}
+
+/// Propagate with single and double precision stages and compare the
+/// curvilinear and the bound end parameters
+template <typename bfield_t>
+void comparePrecision(const bfield_t& bField,
+                      const CurvilinearParameters& start) {
+  Propagator<Stepper<bfield_t, double>> dPropagator(
+      Stepper<bfield_t, double>{bField});
+  Propagator<Stepper<bfield_t, float>> fPropagator(
+      Stepper<bfield_t, float>{bField});
+
+  PropagatorOptions<> options(tgContext, mfContext);
+  options.pathLimit = 1_m;
+
+  const auto dResult = dPropagator.propagate(start, options).value();
+  const auto fResult = fPropagator.propagate(start, options).value();
+  CHECK_CLOSE_ABS(fResult.endParameters->position(),
+                  dResult.endParameters->position(), 1_um);
+  CHECK_CLOSE_ABS(fResult.endParameters->momentum(),
+                  dResult.endParameters->momentum(), 1_keV);
+  CHECK_CLOSE_COVARIANCE(*fResult.endParameters->covariance(),
+                         *dResult.endParameters->covariance(), 1e-4);
+
+  // bound end parameters on a tilted plane
+  Vector3D normal = dResult.endParameters->momentum().normalized();
+  normal += Vector3D(0.1, 0.2, -0.1);
+  auto target = Surface::makeShared<PlaneSurface>(
+      dResult.endParameters->position(), normal.normalized());
+  options.pathLimit *= 2;
+  const auto dBound = dPropagator.propagate(start, *target, options).value();
+  const auto fBound = fPropagator.propagate(start, *target, options).value();
+  CHECK_CLOSE_ABS(fBound.endParameters->parameters(),
+                  dBound.endParameters->parameters(), 0.1_um);
+  CHECK_CLOSE_COVARIANCE(*fBound.endParameters->covariance(),
+                         *dBound.endParameters->covariance(), 1e-4);
+}
+
+BOOST_DATA_TEST_CASE(eigen_stepper_precision_constant_field,
+                     bdata::make({-1.5, -0.3, 0.8, 2.5}) ^
+                         bdata::make({0.4, 1.2, 1.8, 2.6}) ^
+                         bdata::make({0.5_GeV, 1_GeV, 2_GeV, 10_GeV}) ^
+                         bdata::make({1_e, -1_e, 1_e, -1_e}),
+                     phi, theta, p, q) {
+  ConstantBField bField(0.1_T, -0.3_T, 2_T);
+  comparePrecision(bField, startParameters(phi, theta, p, q));
+}
+
+BOOST_DATA_TEST_CASE(eigen_stepper_precision_solenoid_field,
+                     bdata::make({-1.5, -0.3, 0.8, 2.5}) ^
+                         bdata::make({0.4, 1.2, 1.8, 2.6}) ^
+                         bdata::make({0.5_GeV, 1_GeV, 2_GeV, 10_GeV}) ^
+                         bdata::make({1_e, -1_e, 1_e, -1_e}),
+                     phi, theta, p, q) {
+  SolenoidBField::Config cfg;
+  cfg.length = 5.8_m;
+  cfg.radius = (2.56 + 2.46) * 0.5 * 0.5_m;
+  cfg.nCoils = 1154;
+  cfg.bMagCenter = 2_T;
+  SolenoidBField bField(cfg);
+  comparePrecision(bField, startParameters(phi, theta, p, q));
+}
+
+}  // namespace Test
+}  // namespace Acts
@@ -0,0 +1,116 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/data/test_case.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/HelixStepper.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/StepperConcept.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "Acts/Utilities/Units.hpp"
+
+namespace bdata = boost::unit_test::data;
+using namespace Acts::UnitLiterals;
+
+namespace Acts {
+namespace Test {
+
+using Covariance = BoundSymMatrix;
+using EigenStepperType = EigenStepper<ConstantBField>;
+
+// Create a test context
+GeometryContext tgContext = GeometryContext();
+MagneticFieldContext mfContext = MagneticFieldContext();
+
+static_assert(StepperConcept<HelixStepper>,
+              "HelixStepper does not fulfill the stepper concept.");
+
+/// Start parameters with some major correlations
+CurvilinearParameters startParameters(double phi, double theta, double p,
+                                      double q) {
+  Covariance cov;
+  // clang-format off
+  cov <<
+   10_mm, 0, 0.123, 0, 0.5, 0,
+   0, 10_mm, 0, 0.162, 0, 0,
+   0.123, 0, 0.1, 0, 0, 0,
+   0, 0.162, 0, 0.1, 0, 0,
+   0.5, 0, 0, 0, 1_e / 10_GeV, 0,
+   0, 0, 0, 0, 0, 1_us;
+  // clang-format on
+  Vector3D mom(p * std::sin(theta) * std::cos(phi),
+               p * std::sin(theta) * std::sin(phi), p * std::cos(theta));
+  return CurvilinearParameters(cov, Vector3D(0., 0., 0.), mom, q, 0.);
+}
+
+BOOST_AUTO_TEST_CASE(helix_stepper_closed_circle) {
+  ConstantBField bField(0, 0, 2_T);
+  Propagator<HelixStepper> propagator(HelixStepper{bField});
+
+  // a transverse track returns to its start point after a full turn
+  const double p = 1_GeV;
+  const double radius = p / (1_e * 2_T);
+  PropagatorOptions<> options(tgContext, mfContext);
+  options.pathLimit = 2 * M_PI * radius;
+  options.maxStepSize = 10_cm;
+  options.loopProtection = false;
+  auto start = startParameters(0.3, 0.5 * M_PI, p, 1_e);
+  const auto result = propagator.propagate(start, options).value();
+  CHECK_SMALL(result.endParameters->position(), 1e-6_mm);
+  CHECK_CLOSE_ABS(result.endParameters->momentum(), start.momentum(), 1e-9);
+  CHECK_CLOSE_ABS(result.pathLength, options.pathLimit, 1e-9);
+}
+
+BOOST_DATA_TEST_CASE(helix_stepper_vs_eigen_stepper,
+                     bdata::make({-1.5, -0.3, 0.8, 2.5}) ^
+                         bdata::make({0.4, 1.2, 1.8, 2.6}) ^
+                         bdata::make({0.5_GeV, 1_GeV, 2_GeV, 10_GeV}) ^
+                         bdata::make({1_e, -1_e, 1_e, -1_e}),
+                     phi, theta, p, q) {
+  ConstantBField bField(0.1_T, -0.3_T, 2_T);
+  Propagator<HelixStepper> hPropagator(HelixStepper{bField});
+  Propagator<EigenStepperType> ePropagator(EigenStepperType{bField});
+
+  PropagatorOptions<> options(tgContext, mfContext);
+  options.pathLimit = 1_m;
+  options.maxStepSize = 1_cm;
+  auto start = startParameters(phi, theta, p, q);
+
+  // curvilinear end parameters after a fixed path length
+  const auto hResult = hPropagator.propagate(start, options).value();
+  const auto eResult = ePropagator.propagate(start, options).value();
+  CHECK_CLOSE_ABS(hResult.endParameters->position(),
+                  eResult.endParameters->position(), 1_um);
+  CHECK_CLOSE_ABS(hResult.endParameters->momentum(),
+                  eResult.endParameters->momentum(), 1_keV);
+  CHECK_CLOSE_COVARIANCE(*hResult.endParameters->covariance(),
+                         *eResult.endParameters->covariance(), 1e-4);
+
+  // bound end parameters on a tilted plane
+  Vector3D normal = eResult.endParameters->momentum().normalized();
+  normal += Vector3D(0.1, 0.2, -0.1);
+  auto target = Surface::makeShared<PlaneSurface>(
+      eResult.endParameters->position(), normal.normalized());
+  options.pathLimit *= 2;
+  const auto hBound = hPropagator.propagate(start, *target, options).value();
+  const auto eBound = ePropagator.propagate(start, *target, options).value();
+  CHECK_CLOSE_ABS(hBound.endParameters->parameters(),
+                  eBound.endParameters->parameters(), 1e-6);
+  CHECK_CLOSE_COVARIANCE(*hBound.endParameters->covariance(),
+                         *eBound.endParameters->covariance(), 1e-4);
+}
+
+}  // namespace Test
+}  // namespace Acts
@@ -0,0 +1,154 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/ConstantBField.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/PropagatorError.hpp"
+#include "Acts/Propagator/RiddersPropagator.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Utilities/TaskPool.hpp"
+#include "Acts/Utilities/Units.hpp"
+
+using namespace Acts::UnitLiterals;
+
+namespace Acts {
+namespace Test {
+
+using BFieldType = ConstantBField;
+using EigenStepperType = EigenStepper<BFieldType>;
+using EigenPropagatorType = Propagator<EigenStepperType>;
+using RiddersPropagatorType = RiddersPropagator<EigenPropagatorType>;
+using Covariance = BoundSymMatrix;
+
+// Create a test context
+GeometryContext tgContext = GeometryContext();
+MagneticFieldContext mfContext = MagneticFieldContext();
+
+/// Start parameters with some major correlations
+CurvilinearParameters startParameters(double phi, double charge) {
+  Covariance cov;
+  // clang-format off
+  cov <<
+   10_mm, 0, 0.123, 0, 0.5, 0,
+   0, 10_mm, 0, 0.162, 0, 0,
+   0.123, 0, 0.1, 0, 0, 0,
+   0, 0.162, 0, 0.1, 0, 0,
+   0.5, 0, 0, 0, 1_e / 10_GeV, 0,
+   0, 0, 0, 0, 0, 1_us;
+  // clang-format on
+  Vector3D pos(0., 0., 0.);
+  Vector3D mom(1_GeV * std::cos(phi), 1_GeV * std::sin(phi), 0.5_GeV);
+  return CurvilinearParameters(cov, pos, mom, charge, 0.);
+}
+
+BOOST_AUTO_TEST_CASE(ridders_task_pool) {
+  BFieldType bField(0, 0, 2_T);
+  EigenStepperType stepper(bField);
+  EigenPropagatorType propagator(std::move(stepper));
+  RiddersPropagatorType serial(propagator);
+  RiddersPropagatorType parallel(propagator, std::make_shared<TaskPool>(3));
+
+  PropagatorOptions<> options(tgContext, mfContext);
+  options.pathLimit = 2_m;
+  auto target = Surface::makeShared<PlaneSurface>(Vector3D(0.5_m, 0., 0.),
+                                                  Vector3D(1., 0., 0.));
+
+  std::vector<CurvilinearParameters> starts;
+  for (double phi : {-0.4, -0.2, 0., 0.2, 0.4}) {
+    starts.push_back(startParameters(phi, phi < 0. ? -1_e : 1_e));
+  }
+
+  auto batch = parallel.propagate(starts, *target, options);
+  BOOST_CHECK_EQUAL(batch.size(), starts.size());
+  for (size_t is = 0; is < starts.size(); ++is) {
+    // the propagations are independent, the results must be identical
+    auto sResult = serial.propagate(starts[is], *target, options).value();
+    auto pResult = parallel.propagate(starts[is], *target, options).value();
+    BOOST_CHECK(batch[is].ok());
+    const auto& bResult = *batch[is];
+    const Covariance& sCov = *sResult.endParameters->covariance();
+    BOOST_CHECK(sCov != Covariance::Zero());
+    BOOST_CHECK(sCov == *pResult.endParameters->covariance());
+    BOOST_CHECK(sCov == *bResult.endParameters->covariance());
+    BOOST_CHECK(sResult.endParameters->parameters() ==
+                bResult.endParameters->parameters());
+
+    // curvilinear target
+    auto sCurvilinear = serial.propagate(starts[is], options).value();
+    auto pCurvilinear = parallel.propagate(starts[is], options).value();
+    BOOST_CHECK(*sCurvilinear.endParameters->covariance() ==
+                *pCurvilinear.endParameters->covariance());
+  }
+}
+
+/// Propagator which fails for the deviated start parameters of one track
+struct WiggleFailingPropagator {
+  const EigenPropagatorType& propagator;
+  // nominal phi of the track with the failing deviations
+  double failPhi;
+
+  template <typename parameters_t, typename options_t>
+  auto propagate(const parameters_t& start, const Surface& target,
+                 const options_t& options) const {
+    auto result = propagator.propagate(start, target, options);
+    const double phi = start.template get<ePHI>();
+    if (phi != failPhi and std::abs(phi - failPhi) < 1e-2) {
+      return decltype(result)(PropagatorError::Failure);
+    }
+    return result;
+  }
+};
+
+BOOST_AUTO_TEST_CASE(ridders_failed_deviation) {
+  BFieldType bField(0, 0, 2_T);
+  EigenStepperType stepper(bField);
+  EigenPropagatorType propagator(std::move(stepper));
+
+  PropagatorOptions<> options(tgContext, mfContext);
+  options.pathLimit = 2_m;
+  auto target = Surface::makeShared<PlaneSurface>(Vector3D(0.5_m, 0., 0.),
+                                                  Vector3D(1., 0., 0.));
+
+  std::vector<CurvilinearParameters> starts;
+  for (double phi : {-0.2, 0., 0.2}) {
+    starts.push_back(startParameters(phi, 1_e));
+  }
+  WiggleFailingPropagator failing{propagator, starts[1].get<ePHI>()};
+  RiddersPropagator<WiggleFailingPropagator> ridders(
+      failing, std::make_shared<TaskPool>(3));
+  RiddersPropagatorType reference(propagator);
+
+  // only the track with the failed deviations reports the error
+  auto batch = ridders.propagate(starts, *target, options);
+  BOOST_CHECK_EQUAL(batch.size(), starts.size());
+  BOOST_CHECK(not batch[1].ok());
+  BOOST_CHECK(batch[1].error() == PropagatorError::Failure);
+  for (size_t is : {0u, 2u}) {
+    BOOST_CHECK(batch[is].ok());
+    auto expected = reference.propagate(starts[is], *target, options).value();
+    BOOST_CHECK(*expected.endParameters->covariance() ==
+                *(*batch[is]).endParameters->covariance());
+  }
+
+  // the single propagation reports the error instead of throwing
+  auto single = ridders.propagate(starts[1], *target, options);
+  BOOST_CHECK(not single.ok());
+}
+
+}  // namespace Test
+}  // namespace Acts
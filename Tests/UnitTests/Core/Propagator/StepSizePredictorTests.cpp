@@ -0,0 +1,126 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/MagneticField/SolenoidBField.hpp"
+#include "Acts/Propagator/EigenStepper.hpp"
+#include "Acts/Propagator/Propagator.hpp"
+#include "Acts/Propagator/StepSizePredictor.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "Acts/Utilities/Units.hpp"
+
+using namespace Acts::UnitLiterals;
+
+namespace Acts {
+namespace Test {
+
+// Create a test context
+GeometryContext tgContext = GeometryContext();
+MagneticFieldContext mfContext = MagneticFieldContext();
+
+BOOST_AUTO_TEST_CASE(step_size_predictor_binning) {
+  StepSizePredictor::Config cfg;
+  cfg.nQopBins = 4;
+  cfg.maxAbsQop = 1 / 1_GeV;
+  cfg.nEtaBins = 2;
+  StepSizePredictor predictor(cfg);
+
+  const Vector3D forward = Vector3D(1., 0., 2.).normalized();
+  const Vector3D backward = Vector3D(1., 0., -2.).normalized();
+  BOOST_CHECK_EQUAL(predictor.predict(nullptr, 1 / 2_GeV, forward), 0.);
+
+  // the sign of the step size and of the charge do not matter
+  predictor.accept(nullptr, 1 / 2_GeV, forward, -10_cm);
+  CHECK_CLOSE_REL(predictor.predict(nullptr, -1 / 2_GeV, forward), 10_cm,
+                  1e-12);
+  // same |q/p| bin
+  CHECK_CLOSE_REL(predictor.predict(nullptr, 1 / 1.8_GeV, forward), 10_cm,
+                  1e-12);
+  // different |q/p| and eta bins
+  BOOST_CHECK_EQUAL(predictor.predict(nullptr, 1 / 1_GeV, forward), 0.);
+  BOOST_CHECK_EQUAL(predictor.predict(nullptr, 1 / 2_GeV, backward), 0.);
+  // overflow goes into the last bin
+  predictor.accept(nullptr, 1 / 10_MeV, forward, 1_mm);
+  CHECK_CLOSE_REL(predictor.predict(nullptr, 1 / 200_MeV, forward), 1_mm,
+                  1e-12);
+  // different volume
+  auto volume = reinterpret_cast<const TrackingVolume*>(&predictor);
+  BOOST_CHECK_EQUAL(predictor.predict(volume, 1 / 2_GeV, forward), 0.);
+  BOOST_CHECK_EQUAL(predictor.size(), 2u);
+  BOOST_CHECK_EQUAL(predictor.statistics().nPredictions, 3u);
+
+  predictor.clear();
+  BOOST_CHECK_EQUAL(predictor.predict(nullptr, 1 / 2_GeV, forward), 0.);
+
+  // invalid configurations
+  cfg.nEtaBins = 0;
+  BOOST_CHECK_THROW(StepSizePredictor{cfg}, std::invalid_argument);
+  cfg.nEtaBins = 2;
+  cfg.maxAbsQop = 0.;
+  BOOST_CHECK_THROW(StepSizePredictor{cfg}, std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(step_size_predictor_propagation) {
+  SolenoidBField::Config bFieldCfg;
+  bFieldCfg.length = 5.8_m;
+  bFieldCfg.radius = (2.56 + 2.46) * 0.5 * 0.5_m;
+  bFieldCfg.nCoils = 1154;
+  bFieldCfg.bMagCenter = 2_T;
+  SolenoidBField bField(bFieldCfg);
+  using Stepper = EigenStepper<SolenoidBField>;
+  Propagator<Stepper> propagator(Stepper{bField});
+
+  // statistics only vs. prediction
+  StepSizePredictor::Config cfg;
+  cfg.predict = false;
+  StepSizePredictor reference(cfg);
+  StepSizePredictor predictor;
+
+  PropagatorOptions<> options(tgContext, mfContext);
+  options.pathLimit = 2_m;
+  auto propagate = [&](StepSizePredictor& stepSizePredictor, double eta,
+                       double p) {
+    options.stepSizePredictor = &stepSizePredictor;
+    const double theta = 2 * std::atan(std::exp(-eta));
+    Vector3D mom = p * Vector3D(std::sin(theta), 0., std::cos(theta));
+    CurvilinearParameters start(std::nullopt, Vector3D(0., 0., 0.), mom, 1_e,
+                                0.);
+    return *propagator.propagate(start, options).value().endParameters;
+  };
+
+  for (size_t itrack = 0; itrack < 100; ++itrack) {
+    const double eta = 2.5 + 0.005 * itrack;
+    const double p = 1_GeV + 0.01_GeV * itrack;
+    auto refParameters = propagate(reference, eta, p);
+    auto parameters = propagate(predictor, eta, p);
+    CHECK_CLOSE_ABS(parameters.position(), refParameters.position(), 10_um);
+    CHECK_CLOSE_ABS(parameters.momentum(), refParameters.momentum(), 10_keV);
+  }
+
+  const auto& refStatistics = reference.statistics();
+  const auto& statistics = predictor.statistics();
+  BOOST_CHECK_EQUAL(reference.size(), 0u);
+  BOOST_CHECK_EQUAL(refStatistics.nPredictions, 0u);
+  BOOST_CHECK_GT(predictor.size(), 0u);
+  BOOST_CHECK_GT(statistics.nPredictions, 0u);
+  BOOST_CHECK_EQUAL(statistics.nTrials,
+                    statistics.nSteps + statistics.nRejected);
+  BOOST_CHECK_GT(refStatistics.nRejected, 0u);
+  BOOST_CHECK_LT(statistics.rejectionFraction(),
+                 refStatistics.rejectionFraction());
+  BOOST_TEST_MESSAGE("Rejected trial steps: "
+                     << refStatistics.rejectionFraction() << " without, "
+                     << statistics.rejectionFraction() << " with prediction");
+}
+
+}  // namespace Test
+}  // namespace Acts
@@ -240,6 +240,54 @@ BOOST_FIXTURE_TEST_CASE(SurfaceArray_create, SurfaceArrayFixture) {
   }
 }
 
+BOOST_FIXTURE_TEST_CASE(SurfaceArray_staticTransform, SurfaceArrayFixture) {
+  SrfVec brl = makeBarrel(30, 7, 2, 1);
+  std::vector<const Surface*> brlRaw = unpack_shared_vector(brl);
+
+  using PhiAxis = detail::Axis<detail::AxisType::Equidistant,
+                               detail::AxisBoundaryType::Closed>;
+  using ZAxis = detail::Axis<detail::AxisType::Equidistant,
+                             detail::AxisBoundaryType::Bound>;
+
+  Transform3D transform = Transform3D::Identity();
+  transform.translate(Vector3D(0, 0, 1));
+  Transform3D itransform = transform.inverse();
+  double R = 10;
+  auto globalToLocal = [transform](const Vector3D& pos) {
+    Vector3D loc = transform * pos;
+    return Vector2D(phi(loc), loc.z());
+  };
+  auto localToGlobal = [itransform, R](const Vector2D& loc) {
+    return itransform *
+           Vector3D(R * std::cos(loc[0]), R * std::sin(loc[0]), loc[1]);
+  };
+
+  auto sl = std::make_unique<SurfaceArray::SurfaceGridLookup<PhiAxis, ZAxis>>(
+      globalToLocal, localToGlobal,
+      std::make_tuple(PhiAxis(-M_PI, M_PI, 30u), ZAxis(-14, 14, 7u)));
+  sl->fill(tgContext, brlRaw);
+  auto slStatic =
+      std::make_unique<SurfaceArray::CylinderSurfaceGridLookup<PhiAxis, ZAxis>>(
+          detail::CylinderGridTransform(transform, R),
+          std::make_tuple(PhiAxis(-M_PI, M_PI, 30u), ZAxis(-14, 14, 7u)));
+  slStatic->fill(tgContext, brlRaw);
+
+  SurfaceArray sa(std::move(sl), brl);
+  SurfaceArray saStatic(std::move(slStatic), brl);
+  BOOST_CHECK_EQUAL(sa.size(), saStatic.size());
+
+  // both lookups have to agree in every bin and for every surface
+  for (size_t bin = 0; bin < sa.size(); ++bin) {
+    BOOST_CHECK(sa.at(bin) == saStatic.at(bin));
+    BOOST_CHECK(sa.getBinCenter(bin).isApprox(saStatic.getBinCenter(bin)));
+  }
+  for (const auto& srf : brl) {
+    Vector3D ctr = srf->binningPosition(tgContext, binR);
+    BOOST_CHECK(sa.at(ctr) == saStatic.at(ctr));
+    BOOST_CHECK(sa.neighbors(ctr) == saStatic.neighbors(ctr));
+  }
+}
+
 BOOST_AUTO_TEST_CASE(SurfaceArray_singleElement) {
   double w = 3, h = 4;
   auto bounds = std::make_shared<const RectangleBounds>(w, h);
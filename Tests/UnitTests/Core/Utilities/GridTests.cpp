@@ -12,6 +12,7 @@
 #include <random>
 
 #include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "Acts/Utilities/Definitions.hpp"
 #include "Acts/Utilities/detail/Axis.hpp"
 #include "Acts/Utilities/detail/Grid.hpp"
 
@@ -1002,6 +1003,52 @@ BOOST_AUTO_TEST_CASE(grid_interpolation) {
   CHECK_CLOSE_REL(g.interpolate(Point({{2., 3., 4.}})), 80., 1e-6);
 }
 
+BOOST_AUTO_TEST_CASE(grid_interpolation_batch) {
+  using Point = std::array<double, 3>;
+  EquidistantAxis a(1.0, 3.0, 4u);
+  EquidistantAxis b(1.0, 5.0, 3u);
+  EquidistantAxis c(1.0, 7.0, 5u);
+  Grid<double, EquidistantAxis, EquidistantAxis, EquidistantAxis> g(
+      std::make_tuple(a, b, c));
+  Grid<Vector3D, EquidistantAxis, EquidistantAxis, EquidistantAxis> gv(
+      std::make_tuple(a, b, c));
+  Grid<ActsVectorF<5>, EquidistantAxis, EquidistantAxis, EquidistantAxis> gm(
+      std::make_tuple(a, b, c));
+
+  for (size_t bin = 0; bin < g.size(); ++bin) {
+    g.at(bin) = 0.5 * bin;
+    gv.at(bin) = Vector3D(bin, -2. * bin, 0.1 * bin * bin);
+    gm.at(bin) << 1. + bin, 2. + bin, 3. + bin, 4. + bin, 0.1 * bin;
+  }
+
+  // random positions inside the grid with several positions per cell
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> x(1.0, 3.0), y(1.0, 5.0), z(1.0, 7.0);
+  std::vector<Point> points;
+  for (size_t i = 0; i < 500; ++i) {
+    points.push_back({{x(gen), y(gen), z(gen)}});
+  }
+  // duplicated and bin edge positions
+  points.push_back(points.front());
+  points.push_back({{1., 1., 1.}});
+  points.push_back({{2.5, 1., 2.2}});
+
+  const auto values = g.interpolate(points);
+  const auto vectors = gv.interpolate(points);
+  const auto materials = gm.interpolate(points);
+  BOOST_CHECK_EQUAL(values.size(), points.size());
+  BOOST_CHECK_EQUAL(vectors.size(), points.size());
+  BOOST_CHECK_EQUAL(materials.size(), points.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    CHECK_CLOSE_REL(values[i], g.interpolate(points[i]), 1e-12);
+    CHECK_CLOSE_REL(vectors[i], gv.interpolate(points[i]), 1e-12);
+    CHECK_CLOSE_REL(materials[i], gm.interpolate(points[i]), 1e-6);
+  }
+
+  // empty batch
+  BOOST_CHECK(g.interpolate(std::vector<Point>()).empty());
+}
+
 BOOST_AUTO_TEST_CASE(neighborhood) {
   using bins_t = std::vector<size_t>;
   using EAxis = EquidistantAxis;
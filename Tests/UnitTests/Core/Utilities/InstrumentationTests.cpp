@@ -0,0 +1,142 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "Acts/Utilities/Instrumentation.hpp"
+
+namespace Acts {
+namespace Test {
+
+using namespace Acts::Instrumentation;
+
+namespace {
+// keeps the compiler from eliding the allocations
+double* volatile s_sink = nullptr;
+
+void allocate(size_t n) {
+  for (size_t i = 0; i < n; ++i) {
+    s_sink = new double(1.);
+    delete s_sink;
+  }
+}
+
+// over-aligned type that is allocated with the aligned operator new
+struct alignas(64) Aligned {
+  double value = 1.;
+};
+Aligned* volatile s_alignedSink = nullptr;
+
+void instrumentedAllocate(size_t n) {
+  ACTS_INSTRUMENT_SCOPE("InstrumentationTests::instrumentedAllocate");
+  allocate(n);
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(Utilities)
+
+BOOST_AUTO_TEST_CASE(instrumentation_registry) {
+  auto& registry = Registry::instance();
+  auto& entry = registry.entry("InstrumentationTests::registry");
+  // the same name always returns the same entry
+  BOOST_CHECK_EQUAL(&entry, &registry.entry("InstrumentationTests::registry"));
+
+  // unknown entries read as zero
+  auto missing = registry.counters("InstrumentationTests::missing");
+  BOOST_CHECK_EQUAL(missing.calls, 0u);
+  BOOST_CHECK_EQUAL(missing.allocations, 0u);
+  BOOST_CHECK(missing.time.count() == 0);
+
+  entry.add({2, 16}, std::chrono::nanoseconds(100));
+  entry.add({1, 8}, std::chrono::nanoseconds(50));
+  auto counters = registry.counters("InstrumentationTests::registry");
+  BOOST_CHECK_EQUAL(counters.calls, 2u);
+  BOOST_CHECK_EQUAL(counters.allocations, 3u);
+  BOOST_CHECK_EQUAL(counters.allocatedBytes, 24u);
+  BOOST_CHECK(counters.time.count() == 150);
+  BOOST_CHECK_EQUAL(registry.counters().count("InstrumentationTests::registry"),
+                    1u);
+
+  // reset keeps the entries but zeroes the counters
+  registry.reset();
+  BOOST_CHECK_EQUAL(&entry, &registry.entry("InstrumentationTests::registry"));
+  BOOST_CHECK_EQUAL(
+      registry.counters("InstrumentationTests::registry").calls, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(instrumentation_scoped_counter) {
+  auto& entry = Registry::instance().entry("InstrumentationTests::scoped");
+  entry.reset();
+
+  // the scopes may be used from multiple threads concurrently
+  std::vector<std::thread> threads;
+  for (size_t it = 0; it < 4; ++it) {
+    threads.emplace_back([&]() {
+      for (size_t ic = 0; ic < 10; ++ic) {
+        ScopedCounter scope(entry);
+        allocate(5);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  auto counters = entry.counters();
+  BOOST_CHECK_EQUAL(counters.calls, 40u);
+  BOOST_CHECK(counters.time.count() > 0);
+#ifdef ACTS_ENABLE_INSTRUMENTATION
+  BOOST_CHECK_EQUAL(counters.allocations, 200u);
+  BOOST_CHECK_EQUAL(counters.allocatedBytes, 200u * sizeof(double));
+#else
+  BOOST_CHECK_EQUAL(counters.allocations, 0u);
+#endif
+}
+
+BOOST_AUTO_TEST_CASE(instrumentation_scope_macro) {
+  Registry::instance().reset();
+  instrumentedAllocate(3);
+  instrumentedAllocate(3);
+
+  auto counters = Registry::instance().counters(
+      "InstrumentationTests::instrumentedAllocate");
+#ifdef ACTS_ENABLE_INSTRUMENTATION
+  BOOST_CHECK_EQUAL(counters.calls, 2u);
+  BOOST_CHECK_EQUAL(counters.allocations, 6u);
+#else
+  // compiled out, the scope is never registered
+  BOOST_CHECK_EQUAL(counters.calls, 0u);
+#endif
+}
+
+BOOST_AUTO_TEST_CASE(instrumentation_aligned_allocations) {
+  const auto before = threadAllocations();
+  s_alignedSink = new Aligned();
+  BOOST_CHECK_EQUAL(reinterpret_cast<uintptr_t>(s_alignedSink) % 64, 0u);
+  delete s_alignedSink;
+  s_alignedSink = new Aligned[3];
+  delete[] s_alignedSink;
+  const auto after = threadAllocations();
+
+#ifdef ACTS_ENABLE_INSTRUMENTATION
+  BOOST_CHECK_EQUAL(after.allocations - before.allocations, 2u);
+  BOOST_CHECK_GE(after.allocatedBytes - before.allocatedBytes,
+                 4 * sizeof(Aligned));
+#else
+  BOOST_CHECK_EQUAL(after.allocations, before.allocations);
+#endif
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Test
+}  // namespace Acts
@@ -10,8 +10,12 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
+#include <chrono>
 #include <fstream>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "Acts/Utilities/Logger.hpp"
 
@@ -32,6 +36,24 @@ std::unique_ptr<const Logger> create_logger(const std::string& logger_name,
   return std::make_unique<const Logger>(std::move(output), std::move(print));
 }
 
+/// print policy collecting all messages, optionally slowed down
+class CollectingPrintPolicy final : public OutputPrintPolicy {
+ public:
+  CollectingPrintPolicy(std::vector<std::string>& lines,
+                        std::chrono::microseconds delay =
+                            std::chrono::microseconds(0))
+      : m_lines(lines), m_delay(delay) {}
+
+  void flush(const Level& /*lvl*/, const std::ostringstream& input) final {
+    std::this_thread::sleep_for(m_delay);
+    m_lines.push_back(input.str());
+  }
+
+ private:
+  std::vector<std::string>& m_lines;
+  std::chrono::microseconds m_delay;
+};
+
 std::string failure_msg(const std::string& expected, const std::string& found) {
   return std::string("'") + expected + "' != '" + found + "'";
 }
@@ -226,5 +248,75 @@ BOOST_AUTO_TEST_CASE(VERBOSE_test) {
     BOOST_TEST(line == lines.at(i), detail::failure_msg(line, lines.at(i)));
   }
 }
+
+/// @brief unit test for the asynchronous print policy
+///
+/// This test checks that messages from several threads are all written by the
+/// asynchronous print policy, even with a buffer much smaller than the number
+/// of messages.
+BOOST_AUTO_TEST_CASE(async_print_policy_test) {
+  std::vector<std::string> lines;
+  {
+    auto output = std::make_unique<LevelOutputDecorator>(
+        std::make_unique<AsyncPrintPolicy>(
+            std::make_unique<detail::CollectingPrintPolicy>(lines), 8));
+    auto filter = std::make_unique<DefaultFilterPolicy>(DEBUG);
+    auto log = std::make_unique<const Logger>(std::move(output),
+                                              std::move(filter));
+    ACTS_LOCAL_LOGGER(log);
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < 4; ++t) {
+      threads.emplace_back([&logger, t]() {
+        for (size_t i = 0; i < 100; ++i) {
+          ACTS_DEBUG("thread " << t << " message " << i);
+          ACTS_VERBOSE("filtered");
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+
+  BOOST_CHECK_EQUAL(lines.size(), 400u);
+  for (size_t t = 0; t < 4; ++t) {
+    // messages of a single thread must keep their order
+    auto it = lines.begin();
+    for (size_t i = 0; i < 100; ++i) {
+      std::string expected = "DEBUG     thread " + std::to_string(t) +
+                             " message " + std::to_string(i);
+      it = std::find(it, lines.end(), expected);
+      BOOST_CHECK(it != lines.end());
+    }
+  }
+}
+
+/// @brief unit test for the asynchronous print policy dropping messages
+///
+/// This test checks that messages are dropped and counted when the buffer is
+/// full and the print policy is configured to not wait for free space.
+BOOST_AUTO_TEST_CASE(async_print_policy_drop_test) {
+  std::vector<std::string> lines;
+  size_t dropped = 0;
+  {
+    AsyncPrintPolicy async(std::make_unique<detail::CollectingPrintPolicy>(
+                               lines, std::chrono::microseconds(1000)),
+                           2, true);
+    std::ostringstream os;
+    os << "message";
+    for (size_t i = 0; i < 100; ++i) {
+      async.flush(INFO, os);
+    }
+    dropped = async.droppedMessages();
+  }
+
+  BOOST_CHECK_GT(dropped, 0u);
+  // all messages not dropped plus the final drop report
+  BOOST_CHECK_EQUAL(lines.size(), 100u - dropped + 1u);
+  BOOST_CHECK_EQUAL(lines.back(), "AsyncPrintPolicy dropped " +
+                                      std::to_string(dropped) +
+                                      " message(s) due to a full buffer");
+}
 }  // namespace Test
 }  // namespace Acts
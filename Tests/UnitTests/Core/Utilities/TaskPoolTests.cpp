@@ -0,0 +1,74 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include "Acts/Utilities/TaskPool.hpp"
+
+namespace Acts {
+namespace Test {
+
+BOOST_AUTO_TEST_SUITE(Utilities)
+
+BOOST_AUTO_TEST_CASE(task_pool_parallel_for) {
+  for (size_t nThreads : {0u, 1u, 4u}) {
+    TaskPool pool(nThreads);
+    BOOST_CHECK_EQUAL(pool.size(), nThreads);
+
+    // every index is processed exactly once
+    std::vector<std::atomic<int>> calls(1000);
+    pool.parallelFor(calls.size(), [&](size_t i) { ++calls[i]; });
+    for (const auto& c : calls) {
+      BOOST_CHECK_EQUAL(c.load(), 1);
+    }
+
+    // empty and single item loops
+    std::atomic<int> nCalls{0};
+    pool.parallelFor(0, [&](size_t) { ++nCalls; });
+    BOOST_CHECK_EQUAL(nCalls.load(), 0);
+    pool.parallelFor(1, [&](size_t) { ++nCalls; });
+    BOOST_CHECK_EQUAL(nCalls.load(), 1);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(task_pool_nested) {
+  // nested loops must not dead-lock even if all workers are busy
+  TaskPool pool(2);
+  std::atomic<int> nCalls{0};
+  pool.parallelFor(8, [&](size_t) {
+    pool.parallelFor(8, [&](size_t) { ++nCalls; });
+  });
+  BOOST_CHECK_EQUAL(nCalls.load(), 64);
+}
+
+BOOST_AUTO_TEST_CASE(task_pool_exception) {
+  TaskPool pool(3);
+  std::atomic<int> nCalls{0};
+  BOOST_CHECK_THROW(pool.parallelFor(100,
+                                     [&](size_t i) {
+                                       ++nCalls;
+                                       if (i == 42) {
+                                         throw std::runtime_error("failed");
+                                       }
+                                     }),
+                    std::runtime_error);
+  // the remaining items are still processed
+  BOOST_CHECK_EQUAL(nCalls.load(), 100);
+  // the pool remains usable
+  pool.parallelFor(10, [&](size_t) { ++nCalls; });
+  BOOST_CHECK_EQUAL(nCalls.load(), 110);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Test
+}  // namespace Acts
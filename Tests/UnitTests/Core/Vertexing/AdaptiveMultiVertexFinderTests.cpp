@@ -17,6 +17,7 @@
 #include "Acts/Propagator/Propagator.hpp"
 #include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
 #include "Acts/Utilities/Definitions.hpp"
+#include "Acts/Utilities/TaskPool.hpp"
 #include "Acts/Utilities/Units.hpp"
 #include "Acts/Vertexing/AdaptiveMultiVertexFitter.hpp"
 #include "Acts/Vertexing/HelicalTrackLinearizer.hpp"
@@ -460,5 +461,115 @@ BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_finder_usertype_test) {
   }
 }
 
+/// @brief Unit test for the independent finding in clusters separated in z
+BOOST_AUTO_TEST_CASE(adaptive_multi_vertex_finder_cluster_test) {
+  // Set up constant B-Field
+  ConstantBField bField(Vector3D(0., 0., 2_T));
+
+  // Set up EigenStepper
+  EigenStepper<ConstantBField> stepper(bField);
+
+  // Set up propagator with void navigator
+  auto propagator = std::make_shared<Propagator>(stepper);
+
+  using IPEstimator = ImpactPoint3dEstimator<BoundParameters, Propagator>;
+  using Fitter = AdaptiveMultiVertexFitter<BoundParameters, Linearizer>;
+  using SeedFinder = TrackDensityVertexFinder<Fitter, GaussianTrackDensity>;
+  using IPEstimater = TrackToVertexIPEstimator<BoundParameters, Propagator>;
+  using Finder = AdaptiveMultiVertexFinder<Fitter, SeedFinder>;
+
+  auto makeFinder = [&](double clusterMinZGap,
+                        std::shared_ptr<TaskPool> taskPool) {
+    IPEstimator::Config ip3dEstCfg(bField, propagator);
+    IPEstimator ip3dEst(ip3dEstCfg);
+
+    std::vector<double> temperatures{8.0,       4.0,       2.0,
+                                     1.4142136, 1.2247449, 1.0};
+    AnnealingUtility::Config annealingConfig(temperatures);
+    AnnealingUtility annealingUtility(annealingConfig);
+
+    Fitter::Config fitterCfg(ip3dEst);
+    fitterCfg.annealingTool = annealingUtility;
+    fitterCfg.doSmoothing = true;
+    Fitter fitter(fitterCfg);
+
+    Linearizer::Config ltConfig(bField, propagator);
+    Linearizer linearizer(ltConfig);
+
+    IPEstimater::Config ipEstCfg(propagator);
+    IPEstimater ipEst(ipEstCfg);
+
+    Finder::Config finderConfig(std::move(fitter), SeedFinder(),
+                                std::move(ipEst), std::move(linearizer));
+    finderConfig.clusterMinZGap = clusterMinZGap;
+    finderConfig.taskPool = std::move(taskPool);
+    return Finder(finderConfig);
+  };
+
+  // The same event a second time, shifted far away in z
+  const double zShift = 200_mm;
+  auto tracks = getAthenaTracks();
+  std::vector<BoundParameters> shiftedTracks;
+  for (const auto& trk : tracks) {
+    BoundVector params = trk.parameters();
+    params[ParID_t::eLOC_Z0] += zShift;
+    shiftedTracks.push_back(
+        BoundParameters(geoContext, *trk.covariance(), params,
+                        trk.referenceSurface().getSharedPtr()));
+  }
+
+  std::vector<const BoundParameters*> tracksPtr;
+  std::vector<const BoundParameters*> shiftedTracksPtr;
+  for (size_t it = 0; it < tracks.size(); ++it) {
+    tracksPtr.push_back(&tracks[it]);
+    shiftedTracksPtr.push_back(&shiftedTracks[it]);
+  }
+  // Both events mixed
+  std::vector<const BoundParameters*> allTracksPtr;
+  for (size_t it = 0; it < tracks.size(); ++it) {
+    allTracksPtr.push_back(shiftedTracksPtr[it]);
+    allTracksPtr.push_back(tracksPtr[it]);
+  }
+
+  VertexingOptions<BoundParameters> vertexingOptions(geoContext,
+                                                     magFieldContext);
+  ActsSymMatrixD<3> constraintCov;
+  constraintCov << 0.000196000008145347238, 0, 0, 0, 0.000196000008145347238, 0,
+      0, 0, 2809;
+  Vertex<BoundParameters> constraintVtx;
+  constraintVtx.setPosition(Vector3D(0., 0., 0.));
+  constraintVtx.setCovariance(constraintCov);
+  vertexingOptions.vertexConstraint = constraintVtx;
+
+  // Reference: each event on its own
+  Finder finder = makeFinder(0., nullptr);
+  auto vertices = finder.find(tracksPtr, vertexingOptions);
+  auto shiftedVertices = finder.find(shiftedTracksPtr, vertexingOptions);
+  BOOST_CHECK(vertices.ok());
+  BOOST_CHECK(shiftedVertices.ok());
+  std::vector<Vertex<BoundParameters>> expected = *vertices;
+  for (const auto& vtx : *shiftedVertices) {
+    expected.push_back(vtx);
+  }
+
+  for (size_t nThreads : {0u, 2u}) {
+    Finder clusterFinder = makeFinder(
+        50_mm, nThreads > 0 ? std::make_shared<TaskPool>(nThreads) : nullptr);
+    auto findResult = clusterFinder.find(allTracksPtr, vertexingOptions);
+    BOOST_CHECK(findResult.ok());
+
+    // Clusters are ordered in z, the original event comes first
+    const auto& allVertices = *findResult;
+    BOOST_CHECK_EQUAL(allVertices.size(), expected.size());
+    for (size_t iv = 0; iv < std::min(allVertices.size(), expected.size());
+         ++iv) {
+      CHECK_CLOSE_ABS(allVertices[iv].position()[2],
+                      expected[iv].position()[2], 1e-6_mm);
+      BOOST_CHECK_EQUAL(allVertices[iv].tracks().size(),
+                        expected[iv].tracks().size());
+    }
+  }
+}
+
 }  // namespace Test
 }  // namespace Acts
@@ -17,6 +17,7 @@
 #include "Acts/Surfaces/PerigeeSurface.hpp"
 #include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
 #include "Acts/Utilities/Definitions.hpp"
+#include "Acts/Utilities/TaskPool.hpp"
 #include "Acts/Utilities/Units.hpp"
 #include "Acts/Vertexing/FullBilloirVertexFitter.hpp"
 #include "Acts/Vertexing/HelicalTrackLinearizer.hpp"
@@ -369,5 +370,117 @@ BOOST_AUTO_TEST_CASE(billoir_vertex_fitter_usertrack_test) {
   }
 }
 
+///
+/// @brief Unit test for FullBilloirVertexFitter with a reused fit state and
+/// threaded per-track computations
+///
+BOOST_AUTO_TEST_CASE(billoir_vertex_fitter_state_test) {
+  // Set up RNG
+  int mySeed = 31415;
+  std::mt19937 gen(mySeed);
+
+  // Set up constant B-Field
+  ConstantBField bField(0.0, 0.0, 1_T);
+
+  // Set up Eigenstepper
+  EigenStepper<ConstantBField> stepper(bField);
+
+  // Set up propagator with void navigator
+  auto propagator =
+      std::make_shared<Propagator<EigenStepper<ConstantBField>>>(stepper);
+
+  Linearizer::Config ltConfig(bField, propagator);
+  Linearizer linearizer(ltConfig);
+
+  using BilloirFitter = FullBilloirVertexFitter<BoundParameters, Linearizer>;
+
+  BilloirFitter::Config vertexFitterCfg;
+  BilloirFitter billoirFitter(vertexFitterCfg);
+
+  BilloirFitter::Config threadedFitterCfg;
+  threadedFitterCfg.taskPool = std::make_shared<TaskPool>(2);
+  BilloirFitter threadedFitter(threadedFitterCfg);
+
+  VertexingOptions<BoundParameters> vfOptions(geoContext, magFieldContext);
+
+  // The state is reused for all events
+  BilloirFitter::State state;
+
+  const int nEvents = 5;
+  for (int eventIdx = 0; eventIdx < nEvents; ++eventIdx) {
+    unsigned int nTracks = nTracksDist(gen);
+
+    // Create position of vertex and perigee surface
+    double x = vXYDist(gen);
+    double y = vXYDist(gen);
+    double z = vZDist(gen);
+
+    std::shared_ptr<PerigeeSurface> perigeeSurface =
+        Surface::makeShared<PerigeeSurface>(Vector3D(0., 0., 0.));
+
+    // Construct random tracks emerging from vicinity of vertex position
+    std::vector<BoundParameters> tracks;
+    for (unsigned int iTrack = 0; iTrack < nTracks; iTrack++) {
+      double q = qDist(gen) < 0 ? -1. : 1.;
+
+      BoundVector paramVec;
+      paramVec << std::sqrt(x * x + y * y) + d0Dist(gen), z + z0Dist(gen),
+          phiDist(gen), thetaDist(gen), q / pTDist(gen), 0.;
+
+      double resD0 = resIPDist(gen);
+      double resZ0 = resIPDist(gen);
+      double resPh = resAngDist(gen);
+      double resTh = resAngDist(gen);
+      double resQp = resQoPDist(gen);
+
+      Covariance covMat = Covariance::Zero();
+      covMat.diagonal() << resD0 * resD0, resZ0 * resZ0, resPh * resPh,
+          resTh * resTh, resQp * resQp, 1.;
+      tracks.push_back(BoundParameters(geoContext, std::move(covMat), paramVec,
+                                       perigeeSurface));
+    }
+
+    std::vector<const BoundParameters*> tracksPtr;
+    for (const auto& trk : tracks) {
+      tracksPtr.push_back(&trk);
+    }
+
+    auto reference = billoirFitter.fit(tracksPtr, linearizer, vfOptions);
+    BOOST_CHECK(reference.ok());
+    auto reused = billoirFitter.fit(tracksPtr, linearizer, vfOptions, state);
+    BOOST_CHECK(reused.ok());
+    auto threaded = threadedFitter.fit(tracksPtr, linearizer, vfOptions);
+    BOOST_CHECK(threaded.ok());
+
+    // All fits must give the same result
+    for (auto* result : {&reused, &threaded}) {
+      const auto& refVtx = *reference;
+      const auto& vtx = **result;
+      for (unsigned int i = 0; i < 4; ++i) {
+        CHECK_CLOSE_ABS(vtx.fullPosition()[i], refVtx.fullPosition()[i],
+                        1e-10);
+        for (unsigned int j = 0; j < 4; ++j) {
+          CHECK_CLOSE_ABS(vtx.fullCovariance()(i, j),
+                          refVtx.fullCovariance()(i, j), 1e-10);
+        }
+      }
+      CHECK_CLOSE_ABS(vtx.fitQuality().first, refVtx.fitQuality().first,
+                      1e-8);
+
+      BOOST_CHECK_EQUAL(vtx.tracks().size(), refVtx.tracks().size());
+      for (unsigned int iTrack = 0; iTrack < vtx.tracks().size(); ++iTrack) {
+        const auto& trk = vtx.tracks()[iTrack];
+        const auto& refTrk = refVtx.tracks()[iTrack];
+        BOOST_CHECK_EQUAL(trk.originalParams, refTrk.originalParams);
+        CHECK_CLOSE_ABS(trk.chi2Track, refTrk.chi2Track, 1e-8);
+        for (unsigned int i = 0; i < eBoundParametersSize; ++i) {
+          CHECK_CLOSE_ABS(trk.fittedParams.parameters()[i],
+                          refTrk.fittedParams.parameters()[i], 1e-10);
+        }
+      }
+    }
+  }
+}
+
 }  // namespace Test
 }  // namespace Acts
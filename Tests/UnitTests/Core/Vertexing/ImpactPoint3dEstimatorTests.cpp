@@ -345,5 +345,79 @@ BOOST_AUTO_TEST_CASE(impactpoint_3d_estimator_athena_test) {
   BOOST_CHECK_EQUAL(surfaceCenter, vtxPos);
 }
 
+/// @brief Unit test comparing the single helix step to the point of closest
+/// approach with the propagation in a homogeneous field
+BOOST_AUTO_TEST_CASE(impactpoint_3d_estimator_analytic_test) {
+  // Number of tests
+  unsigned int nTests = 10;
+
+  // Set up RNG
+  int mySeed = 31415;
+  std::mt19937 gen(mySeed);
+
+  // Set up constant B-Field
+  ConstantBField bField(Vector3D(0., 0., 2._T));
+
+  // Set up Eigenstepper
+  EigenStepper<ConstantBField> stepper(bField);
+
+  // Set up propagator with void navigator
+  auto propagator = std::make_shared<Propagator>(stepper);
+
+  // Set up the ImpactPoint3dEstimators, with and without analytic region
+  ImpactPoint3dEstimator<BoundParameters, Propagator>::Config ipEstCfg(
+      bField, propagator);
+  ImpactPoint3dEstimator<BoundParameters, Propagator> ipEstimator(ipEstCfg);
+  ipEstCfg.analyticRMax = 10_mm;
+  ipEstCfg.analyticZMax = 100_mm;
+  ImpactPoint3dEstimator<BoundParameters, Propagator> ipEstimatorAnalytic(
+      ipEstCfg);
+
+  // Reference position
+  Vector3D refPosition(0.1_mm, -0.2_mm, 1_mm);
+
+  for (unsigned int i = 0; i < nTests; i++) {
+    // Covariance matrix
+    double resD0 = resIPDist(gen);
+    double resZ0 = resIPDist(gen);
+    double resPh = resAngDist(gen);
+    double resTh = resAngDist(gen);
+    double resQp = resQoPDist(gen);
+    Covariance covMat;
+    covMat << resD0 * resD0, 0., 0., 0., 0., 0., 0., resZ0 * resZ0, 0., 0., 0.,
+        0., 0., 0., resPh * resPh, 0., 0., 0., 0., 0., 0., resTh * resTh, 0.,
+        0., 0., 0., 0., 0., resQp * resQp, 0., 0., 0., 0., 0., 0., 1.;
+
+    // The track parameters
+    double q = qDist(gen) < 0 ? -1. : 1.;
+    BoundParameters::ParVector_t paramVec;
+    paramVec << d0Dist(gen), z0Dist(gen), phiDist(gen), thetaDist(gen),
+        q / pTDist(gen), 0.;
+
+    std::shared_ptr<PerigeeSurface> perigeeSurface =
+        Surface::makeShared<PerigeeSurface>(Vector3D(0., 0., 0.));
+    BoundParameters myTrack(geoContext, std::move(covMat), paramVec,
+                            perigeeSurface);
+
+    auto res = ipEstimator.getParamsAtClosestApproach(
+        geoContext, magFieldContext, myTrack, refPosition);
+    auto resAnalytic = ipEstimatorAnalytic.getParamsAtClosestApproach(
+        geoContext, magFieldContext, myTrack, refPosition);
+    BOOST_CHECK(res.ok());
+    BOOST_CHECK(resAnalytic.ok());
+
+    const auto& params = **res;
+    const auto& paramsAnalytic = **resAnalytic;
+    for (unsigned int ip = 0; ip < eBoundParametersSize; ++ip) {
+      CHECK_CLOSE_ABS(params.parameters()[ip], paramsAnalytic.parameters()[ip],
+                      1e-6);
+      for (unsigned int jp = 0; jp < eBoundParametersSize; ++jp) {
+        CHECK_CLOSE_ABS((*params.covariance())(ip, jp),
+                        (*paramsAnalytic.covariance())(ip, jp), 1e-8);
+      }
+    }
+  }
+}
+
 }  // namespace Test
 }  // namespace Acts
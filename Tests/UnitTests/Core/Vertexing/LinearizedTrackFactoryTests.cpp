@@ -18,6 +18,7 @@
 #include "Acts/Surfaces/PerigeeSurface.hpp"
 #include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
 #include "Acts/Utilities/Definitions.hpp"
+#include "Acts/Utilities/TaskPool.hpp"
 #include "Acts/Utilities/Units.hpp"
 #include "Acts/Vertexing/HelicalTrackLinearizer.hpp"
 
@@ -240,5 +241,184 @@ BOOST_AUTO_TEST_CASE(linearized_track_factory_straightline_test) {
   }
 }
 
+///
+/// @brief Unit test for the batched HelicalTrackLinearizer interface
+///
+BOOST_AUTO_TEST_CASE(linearized_track_factory_batch_test) {
+  // Number of tracks
+  unsigned int nTracks = 20;
+
+  // Set up RNG
+  int mySeed = 31415;
+  std::mt19937 gen(mySeed);
+
+  // Set up propagator with constant B-Field and void navigator
+  ConstantBField bField(0.0, 0.0, 1_T);
+  EigenStepper<ConstantBField> stepper(bField);
+  auto propagator =
+      std::make_shared<Propagator<EigenStepper<ConstantBField>>>(stepper);
+
+  std::shared_ptr<PerigeeSurface> perigeeSurface =
+      Surface::makeShared<PerigeeSurface>(Vector3D(0., 0., 0.));
+
+  // Tracks from two vertices, linearized at their own vertex position
+  std::vector<SpacePointVector> vertices(2, SpacePointVector::Zero());
+  for (auto& vertex : vertices) {
+    vertex[0] = vXYDist(gen);
+    vertex[1] = vXYDist(gen);
+    vertex[2] = vZDist(gen);
+  }
+  std::vector<BoundParameters> tracks;
+  std::vector<SpacePointVector> linPoints;
+  for (unsigned int iTrack = 0; iTrack < nTracks; iTrack++) {
+    const auto& vertex = vertices[iTrack % vertices.size()];
+    double q = qDist(gen) < 0 ? -1. : 1.;
+    BoundVector paramVec;
+    paramVec << std::hypot(vertex[0], vertex[1]) + d0Dist(gen),
+        vertex[2] + z0Dist(gen), phiDist(gen), thetaDist(gen),
+        q / pTDist(gen), 0.;
+    Covariance covMat = Covariance::Identity();
+    covMat(0, 0) = covMat(1, 1) = 30_um * 30_um;
+    covMat(2, 2) = covMat(3, 3) = 0.01 * 0.01;
+    covMat(4, 4) = 0.01 * 0.01;
+    tracks.push_back(BoundParameters(geoContext, std::move(covMat), paramVec,
+                                     perigeeSurface));
+    linPoints.push_back(vertex);
+  }
+  std::vector<const BoundParameters*> trackPtrs;
+  for (const auto& track : tracks) {
+    trackPtrs.push_back(&track);
+  }
+
+  for (size_t nThreads : {0u, 4u}) {
+    Linearizer::Config ltConfig(bField, propagator);
+    if (nThreads > 0) {
+      ltConfig.taskPool = std::make_shared<TaskPool>(nThreads);
+    }
+    Linearizer linFactory(ltConfig);
+
+    // the batched results are identical to the single track ones
+    auto linTracks = linFactory.linearizeTracks(trackPtrs, linPoints,
+                                                geoContext, magFieldContext);
+    BOOST_CHECK_EQUAL(linTracks.size(), tracks.size());
+    for (size_t iTrack = 0; iTrack < tracks.size(); ++iTrack) {
+      LinearizedTrack expected =
+          linFactory
+              .linearizeTrack(tracks[iTrack], linPoints[iTrack], geoContext,
+                              magFieldContext)
+              .value();
+      const LinearizedTrack& linTrack = linTracks[iTrack].value();
+      BOOST_CHECK_EQUAL(linTrack.linearizationPoint, linPoints[iTrack]);
+      BOOST_CHECK_EQUAL(linTrack.parametersAtPCA, expected.parametersAtPCA);
+      BOOST_CHECK_EQUAL(linTrack.positionJacobian, expected.positionJacobian);
+      BOOST_CHECK_EQUAL(linTrack.momentumJacobian, expected.momentumJacobian);
+      BOOST_CHECK_EQUAL(linTrack.constantTerm, expected.constantTerm);
+    }
+
+    // all tracks at a common linearization point
+    auto commonLinTracks = linFactory.linearizeTracks(
+        trackPtrs, vertices[0], geoContext, magFieldContext);
+    BOOST_CHECK_EQUAL(commonLinTracks.size(), tracks.size());
+    for (auto& linTrack : commonLinTracks) {
+      BOOST_CHECK_EQUAL(linTrack.value().linearizationPoint, vertices[0]);
+    }
+  }
+}
+
+///
+/// @brief Unit test comparing the analytic transport in a homogeneous
+/// field to the propagation
+///
+BOOST_AUTO_TEST_CASE(linearized_track_factory_analytic_test) {
+  // Number of tracks
+  unsigned int nTracks = 10;
+
+  // Set up RNG
+  int mySeed = 31415;
+  std::mt19937 gen(mySeed);
+
+  // Set up propagator with constant B-Field and void navigator
+  ConstantBField bField(0.0, 0.0, 2_T);
+  EigenStepper<ConstantBField> stepper(bField);
+  auto propagator =
+      std::make_shared<Propagator<EigenStepper<ConstantBField>>>(stepper);
+
+  Linearizer::Config ltConfig(bField, propagator);
+  Linearizer linFactory(ltConfig);
+  ltConfig.analyticRMax = 10_mm;
+  ltConfig.analyticZMax = 100_mm;
+  Linearizer linFactoryAnalytic(ltConfig);
+
+  std::shared_ptr<PerigeeSurface> perigeeSurface =
+      Surface::makeShared<PerigeeSurface>(Vector3D(0., 0., 0.));
+
+  // The last tracks are placed at the phi = +-pi branch cut, with both
+  // charges, to check the phi wrapping of the expansion
+  unsigned int nEdgeTracks = 4;
+  for (unsigned int iTrack = 0; iTrack < nTracks + nEdgeTracks; iTrack++) {
+    SpacePointVector linPoint = SpacePointVector::Zero();
+    linPoint[0] = vXYDist(gen);
+    linPoint[1] = vXYDist(gen);
+    linPoint[2] = vZDist(gen);
+
+    double q = qDist(gen) < 0 ? -1. : 1.;
+    BoundVector paramVec;
+    paramVec << d0Dist(gen), linPoint[2] + z0Dist(gen), phiDist(gen),
+        thetaDist(gen), q / pTDist(gen), 0.;
+    if (iTrack >= nTracks) {
+      double sgn = (iTrack % 2 == 0) ? -1. : 1.;
+      paramVec[ParID_t::ePHI] = sgn * (M_PI - 1e-5);
+      paramVec[ParID_t::eQOP] = sgn * std::abs(paramVec[ParID_t::eQOP]);
+      if (iTrack >= nTracks + 2) {
+        paramVec[ParID_t::eQOP] *= -1.;
+      }
+    }
+
+    double resD0 = resIPDist(gen);
+    double resZ0 = resIPDist(gen);
+    double resPh = resAngDist(gen);
+    double resTh = resAngDist(gen);
+    double resQp = resQoPDist(gen);
+    Covariance covMat = Covariance::Identity();
+    covMat(0, 0) = resD0 * resD0;
+    covMat(1, 1) = resZ0 * resZ0;
+    covMat(2, 2) = resPh * resPh;
+    covMat(3, 3) = resTh * resTh;
+    covMat(4, 4) = resQp * resQp;
+    BoundParameters track(geoContext, std::move(covMat), paramVec,
+                          perigeeSurface);
+
+    LinearizedTrack expected =
+        linFactory.linearizeTrack(track, linPoint, geoContext, magFieldContext)
+            .value();
+    LinearizedTrack linTrack =
+        linFactoryAnalytic
+            .linearizeTrack(track, linPoint, geoContext, magFieldContext)
+            .value();
+
+    // The propagation stops within the surface tolerance
+    for (unsigned int ip = 0; ip < eBoundParametersSize; ++ip) {
+      CHECK_CLOSE_OR_SMALL(linTrack.parametersAtPCA[ip],
+                           expected.parametersAtPCA[ip], 1e-3, 1e-5);
+      CHECK_CLOSE_OR_SMALL(linTrack.constantTerm[ip], expected.constantTerm[ip],
+                           1e-3, 1e-5);
+      for (unsigned int jp = 0; jp < 4; ++jp) {
+        CHECK_CLOSE_OR_SMALL(linTrack.positionJacobian(ip, jp),
+                             expected.positionJacobian(ip, jp), 1e-3, 1e-5);
+      }
+      for (unsigned int jp = 0; jp < 3; ++jp) {
+        CHECK_CLOSE_OR_SMALL(linTrack.momentumJacobian(ip, jp),
+                             expected.momentumJacobian(ip, jp), 1e-3, 1e-5);
+      }
+    }
+    for (unsigned int ip = 0; ip < 5; ++ip) {
+      for (unsigned int jp = 0; jp < 5; ++jp) {
+        CHECK_CLOSE_OR_SMALL(linTrack.covarianceAtPCA(ip, jp),
+                             expected.covarianceAtPCA(ip, jp), 1e-3, 1e-10);
+      }
+    }
+  }
+}
+
 }  // namespace Test
 }  // namespace Acts
@@ -233,6 +233,80 @@ BOOST_AUTO_TEST_CASE(track_density_finder_random_test) {
   }
 }
 
+///
+/// @brief Unit test for TrackDensityVertexFinder with a state kept while
+/// tracks are removed and added, as in iterative vertex finding
+///
+BOOST_AUTO_TEST_CASE(track_density_finder_state_test) {
+  Covariance covMat = Covariance::Identity();
+
+  // Perigee surface for track parameters
+  Vector3D pos0{0, 0, 0};
+  std::shared_ptr<PerigeeSurface> perigeeSurface =
+      Surface::makeShared<PerigeeSurface>(pos0);
+
+  VertexingOptions<BoundParameters> vertexingOptions(geoContext,
+                                                     magFieldContext);
+
+  using Finder =
+      TrackDensityVertexFinder<DummyVertexFitter<>, GaussianTrackDensity>;
+  Finder finder;
+  Finder::State state;
+
+  int mySeed = 31415;
+  std::mt19937 gen(mySeed);
+  unsigned int nTracks = 200;
+
+  std::vector<BoundParameters> trackVec;
+  trackVec.reserve(nTracks);
+  for (unsigned int i = 0; i < nTracks; i++) {
+    Vector3D pos(xdist(gen), ydist(gen), 0);
+    if ((i % 4) == 0) {
+      pos[eZ] = z2dist(gen);
+    } else {
+      pos[eZ] = z1dist(gen);
+    }
+    double pt = pTDist(gen);
+    double phi = phiDist(gen);
+    double eta = etaDist(gen);
+    Vector3D mom(pt * std::cos(phi), pt * std::sin(phi), pt * std::sinh(eta));
+    double charge = etaDist(gen) > 0 ? 1 : -1;
+    trackVec.push_back(BoundParameters(geoContext, covMat, pos, mom, charge, 0,
+                                       perigeeSurface));
+  }
+
+  std::vector<const BoundParameters*> trackPtrVec;
+  for (const auto& trk : trackVec) {
+    trackPtrVec.push_back(&trk);
+  }
+
+  std::vector<const BoundParameters*> removedTracks;
+  for (unsigned int iteration = 0; iteration < 5; iteration++) {
+    // The seed with the kept state is identical to a seed from scratch
+    auto res = finder.find(trackPtrVec, vertexingOptions, state);
+    auto expected = finder.find(trackPtrVec, vertexingOptions);
+    BOOST_CHECK(res.ok());
+    BOOST_CHECK(expected.ok());
+    double zSeed = (*res).back().position()[eZ];
+    BOOST_CHECK_EQUAL(zSeed, (*expected).back().position()[eZ]);
+    BOOST_CHECK_EQUAL(state.tracks.size(), trackPtrVec.size());
+
+    // Remove the tracks near the seed, add some of them back in between
+    if (iteration == 2) {
+      trackPtrVec.insert(trackPtrVec.end(), removedTracks.begin(),
+                         removedTracks.begin() + removedTracks.size() / 2);
+      continue;
+    }
+    auto removed = std::partition(
+        trackPtrVec.begin(), trackPtrVec.end(),
+        [zSeed](const BoundParameters* trk) {
+          return std::abs(trk->position()[eZ] - zSeed) > 2_mm;
+        });
+    removedTracks.insert(removedTracks.end(), removed, trackPtrVec.end());
+    trackPtrVec.erase(removed, trackPtrVec.end());
+  }
+}
+
 // Dummy user-defined InputTrack type
 struct InputTrack {
   InputTrack(const BoundParameters& params) : m_parameters(params) {}
@@ -312,5 +386,59 @@ BOOST_AUTO_TEST_CASE(track_density_finder_usertrack_test) {
   }
 }
 
+///
+/// @brief Unit test for the track density with tracks which have the same z0
+///
+BOOST_AUTO_TEST_CASE(track_density_same_z0_test) {
+  Covariance covMat = Covariance::Identity();
+  std::shared_ptr<PerigeeSurface> perigeeSurface =
+      Surface::makeShared<PerigeeSurface>(Vector3D(0, 0, 0));
+
+  auto makeTrack = [&](double d0, double z0) {
+    BoundVector paramVec;
+    paramVec << d0, z0, 0.5, M_PI / 3., 1. / 1_GeV, 0.;
+    return BoundParameters(geoContext, covMat, paramVec, perigeeSurface);
+  };
+  // Two different tracks at the same z0 and a third one nearby
+  const BoundParameters trackA = makeTrack(0.1_mm, -1_mm);
+  const BoundParameters trackB = makeTrack(-0.2_mm, -1_mm);
+  const BoundParameters trackC = makeTrack(0., 1.5_mm);
+
+  GaussianTrackDensity density;
+  auto densityAt = [](GaussianTrackDensity::State& state, double z) {
+    return state.trackDensity.trackDensity(state.trackDensityState, z);
+  };
+  auto fromScratch = [&](const std::vector<BoundParameters>& tracks) {
+    GaussianTrackDensity::State state;
+    return density.globalMaximumWithWidth(tracks, state);
+  };
+
+  // Both tracks with the same z0 contribute
+  GaussianTrackDensity::State state;
+  density.addTrack(trackA, state);
+  const double singleDensity = densityAt(state, -1_mm);
+  density.addTrack(trackB, state);
+  density.addTrack(trackC, state);
+  BOOST_CHECK_EQUAL(state.trackDensityState.trackMap.size(), 3u);
+  BOOST_CHECK_GT(densityAt(state, -1_mm), singleDensity);
+  BOOST_CHECK(density.globalMaximumWithWidth(state) ==
+              fromScratch({trackA, trackB, trackC}));
+
+  // Removing one of them keeps the other one and the shared maximum search
+  density.removeTrack(trackA, state);
+  BOOST_CHECK_EQUAL(state.trackDensityState.trackMap.size(), 2u);
+  BOOST_CHECK_EQUAL(state.trackDensityState.lowerMap.size(), 2u);
+  BOOST_CHECK_EQUAL(state.trackDensityState.upperMap.size(), 2u);
+  BOOST_CHECK_EQUAL(state.trackDensityState.maximumSearches.count(-1_mm), 1u);
+  BOOST_CHECK(density.globalMaximumWithWidth(state) ==
+              fromScratch({trackB, trackC}));
+
+  // Removing the second one removes the search as well
+  density.removeTrack(trackB, state);
+  BOOST_CHECK_EQUAL(state.trackDensityState.maximumSearches.count(-1_mm), 0u);
+  BOOST_CHECK(density.globalMaximumWithWidth(state) ==
+              fromScratch({trackC}));
+}
+
 }  // namespace Test
 }  // namespace Acts
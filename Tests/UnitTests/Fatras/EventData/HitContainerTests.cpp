@@ -0,0 +1,117 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include <limits>
+#include <vector>
+
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "ActsFatras/EventData/HitContainer.hpp"
+
+using namespace ActsFatras;
+
+namespace {
+constexpr auto eps = std::numeric_limits<Hit::Scalar>::epsilon();
+constexpr auto epsFloat = std::numeric_limits<float>::epsilon();
+const auto pid = Barcode().setVertexPrimary(12).setParticle(23);
+const auto gid = Acts::GeometryID().setVolume(1).setLayer(2).setSensitive(3);
+
+std::vector<Hit> makeHits(size_t n) {
+  std::vector<Hit> hits;
+  for (size_t i = 0; i < n; ++i) {
+    Hit::Vector4 p4 = Hit::Vector4(1, 2, 3, 4) * (i + 1);
+    Hit::Vector4 m40(2, 0, 2, 5);
+    Hit::Vector4 m41(0, -2, 2, 5 - 0.1 * i);
+    hits.emplace_back(gid, pid.makeDescendant(i), p4, m40, m41, i);
+  }
+  return hits;
+}
+
+template <typename Container>
+void checkHits(const Container& container, const std::vector<Hit>& hits,
+               double tol) {
+  BOOST_TEST(container.size() == hits.size());
+  for (size_t i = 0; i < hits.size(); ++i) {
+    const Hit h = container[i];
+    BOOST_TEST(h.geometryId() == hits[i].geometryId());
+    BOOST_TEST(h.particleId() == hits[i].particleId());
+    BOOST_TEST(h.index() == hits[i].index());
+    CHECK_CLOSE_REL(h.position4(), hits[i].position4(), tol);
+    CHECK_CLOSE_OR_SMALL(h.momentum4Before(), hits[i].momentum4Before(), tol,
+                         tol);
+    CHECK_CLOSE_OR_SMALL(h.momentum4After(), hits[i].momentum4After(), tol,
+                         tol);
+  }
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(FatrasHitContainer)
+
+BOOST_AUTO_TEST_CASE(Empty) {
+  HitContainer<> container;
+  BOOST_TEST(container.empty());
+  BOOST_TEST(container.size() == 0u);
+  container.resize(2);
+  BOOST_TEST(container.size() == 2u);
+  BOOST_TEST(container.index(1) == -1);
+  BOOST_TEST(container.positions4().size() == 2u);
+  container.clear();
+  BOOST_TEST(container.empty());
+}
+
+BOOST_AUTO_TEST_CASE(DoublePrecision) {
+  const auto hits = makeHits(5);
+  HitContainer<> container;
+  container.append(hits.begin(), hits.end());
+  checkHits(container, hits, eps);
+  // column access matches element access
+  BOOST_TEST(container.geometryId(3) == gid);
+  BOOST_TEST(container.particleId(3) == pid.makeDescendant(3));
+  BOOST_TEST(container.index(3) == 3);
+  CHECK_CLOSE_REL(container.position4(3), hits[3].position4(), eps);
+  BOOST_TEST(container.momenta4After().size() == 5u);
+
+  // emplacement with the hit constructor arguments
+  container.emplace_back(gid, pid, Hit::Vector4(1, 1, 1, 1),
+                         Hit::Vector4(1, 0, 0, 2), Hit::Vector4(1, 0, 0, 1), 7);
+  BOOST_TEST(container.size() == 6u);
+  CHECK_CLOSE_REL(container[5].depositedEnergy(), 1, eps);
+  BOOST_TEST(container[5].index() == 7);
+}
+
+BOOST_AUTO_TEST_CASE(SinglePrecision) {
+  const auto hits = makeHits(5);
+  HitContainer<float> container;
+  for (const auto& hit : hits) {
+    container.push_back(hit);
+  }
+  checkHits(container, hits, epsFloat);
+}
+
+BOOST_AUTO_TEST_CASE(BulkAppend) {
+  const auto hits = makeHits(6);
+  HitContainer<> first;
+  HitContainer<> second;
+  HitContainer<float> third;
+  first.append(hits.begin(), hits.begin() + 2);
+  second.append(hits.begin() + 2, hits.begin() + 4);
+  third.append(hits.begin() + 4, hits.end());
+
+  HitContainer<> merged;
+  merged.append(first);
+  merged.append(second);
+  merged.append(third);
+  checkHits(merged, hits, epsFloat);
+
+  HitContainer<float> mergedFloat;
+  mergedFloat.append(merged);
+  checkHits(mergedFloat, hits, epsFloat);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,95 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2020 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include <limits>
+#include <vector>
+
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "Acts/Utilities/Units.hpp"
+#include "ActsFatras/EventData/ParticleContainer.hpp"
+
+using Acts::PdgParticle;
+using ActsFatras::Barcode;
+using ActsFatras::Particle;
+using ActsFatras::ParticleContainer;
+using ActsFatras::ProcessType;
+using namespace Acts::UnitLiterals;
+
+namespace {
+constexpr auto eps = std::numeric_limits<Particle::Scalar>::epsilon();
+
+std::vector<Particle> makeParticles(size_t n) {
+  std::vector<Particle> particles;
+  for (size_t i = 0; i < n; ++i) {
+    const auto pid = Barcode().setVertexPrimary(1).setParticle(i + 1);
+    particles.push_back(Particle(pid, PdgParticle::eProton, 1_e, 938_MeV)
+                            .setProcess(ProcessType::eUndefined)
+                            .setPosition4(1_mm * i, 2_mm, 3_mm, 4_ns)
+                            .setDirection(1, 2, i)
+                            .setAbsMomentum(1_GeV * (i + 1))
+                            .setMaterialPassed(0.1 * i, 0.01 * i)
+                            .setMaterialLimits(1, 0.1 * (i + 1)));
+  }
+  return particles;
+}
+
+void checkParticles(const ParticleContainer& container,
+                    const std::vector<Particle>& particles) {
+  BOOST_TEST(container.size() == particles.size());
+  for (size_t i = 0; i < particles.size(); ++i) {
+    const Particle particle = container[i];
+    const Particle& ref = particles[i];
+    BOOST_TEST(particle.particleId() == ref.particleId());
+    BOOST_TEST(particle.process() == ref.process());
+    BOOST_TEST(particle.pdg() == ref.pdg());
+    BOOST_TEST(particle.charge() == ref.charge());
+    BOOST_TEST(particle.mass() == ref.mass());
+    BOOST_TEST(particle.position4() == ref.position4());
+    // the direction is normalized again on reconstruction
+    CHECK_CLOSE_OR_SMALL(particle.unitDirection(), ref.unitDirection(), eps,
+                         eps);
+    BOOST_TEST(particle.absMomentum() == ref.absMomentum());
+    BOOST_TEST(particle.pathInX0() == ref.pathInX0());
+    BOOST_TEST(particle.pathInL0() == ref.pathInL0());
+    BOOST_TEST(particle.pathLimitX0() == ref.pathLimitX0());
+    BOOST_TEST(particle.pathLimitL0() == ref.pathLimitL0());
+  }
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(FatrasParticleContainer)
+
+BOOST_AUTO_TEST_CASE(PushBack) {
+  const auto particles = makeParticles(4);
+  ParticleContainer container;
+  BOOST_TEST(container.empty());
+  for (const auto& particle : particles) {
+    container.push_back(particle);
+  }
+  checkParticles(container, particles);
+  BOOST_TEST(container.absMomenta().size() == 4u);
+  BOOST_TEST(container.absMomenta()[2] == 3_GeV);
+  BOOST_TEST(container.particleIds()[3] == particles[3].particleId());
+
+  container.clear();
+  BOOST_TEST(container.empty());
+}
+
+BOOST_AUTO_TEST_CASE(BulkAppend) {
+  const auto particles = makeParticles(5);
+  ParticleContainer first;
+  ParticleContainer second;
+  first.append(particles.begin(), particles.begin() + 3);
+  second.append(particles.begin() + 3, particles.end());
+  first.append(second);
+  checkParticles(first, particles);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -13,21 +13,26 @@
 #include <ios>
 #include <iostream>
 #include <stdexcept>
+#include <thread>
+#include <vector>
 
 #include "Acts/Geometry/GeometryID.hpp"
 #include "Acts/Material/BinnedSurfaceMaterial.hpp"
+#include "Acts/Plugins/Json/BinaryMaterialMap.hpp"
 #include "Acts/Plugins/Json/JsonGeometryConverter.hpp"
+#include "Acts/Plugins/Json/JsonMaterialDecorator.hpp"
+#include "Acts/Plugins/Json/LazySurfaceMaterial.hpp"
+#include "Acts/Surfaces/CylinderSurface.hpp"
 
 using json = nlohmann::json;
 
 namespace Acts {
 namespace Test {
 
-BOOST_AUTO_TEST_CASE(Json_conversion) {
+/// Material map with two binned representing layer surfaces
+json testMaterialMap() {
   std::stringstream ifj;
 
-  Acts::JsonGeometryConverter::Config cfg;
-
   ifj << "{";
   ifj << "    \"volumes\": {";
   ifj << "        \"2\": {";
@@ -113,6 +118,13 @@ BOOST_AUTO_TEST_CASE(Json_conversion) {
 
   json jin;
   ifj >> jin;
+  return jin;
+}
+
+BOOST_AUTO_TEST_CASE(Json_conversion) {
+  Acts::JsonGeometryConverter::Config cfg;
+
+  json jin = testMaterialMap();
 
   Acts::JsonGeometryConverter jmConverter(cfg);
 
@@ -122,5 +134,123 @@ BOOST_AUTO_TEST_CASE(Json_conversion) {
   BOOST_CHECK_EQUAL(jin, jint);
 }
 
+BOOST_AUTO_TEST_CASE(Binary_conversion) {
+  Acts::JsonGeometryConverter::Config cfg;
+
+  json jin = testMaterialMap();
+  {
+    std::ofstream ofj("binary_conversion.json");
+    ofj << jin;
+  }
+
+  // convert json -> binary and read it back
+  Acts::BinaryMaterialMap::convertJson(cfg, "binary_conversion.json",
+                                       "binary_conversion.acm");
+  BOOST_CHECK(
+      not BinaryMaterialMap::isBinaryMaterialMap("binary_conversion.json"));
+  BOOST_CHECK(BinaryMaterialMap::isBinaryMaterialMap("binary_conversion.acm"));
+
+  Acts::BinaryMaterialMap bmMap(Acts::BinaryMaterialMap::Config(),
+                                "binary_conversion.acm");
+  BOOST_CHECK_EQUAL(bmMap.index().size(), 2u);
+
+  // the round trip must reproduce the json input
+  Acts::JsonGeometryConverter jmConverter(cfg);
+  auto maps = jmConverter.jsonToMaterialMaps(jin);
+  auto bMaps = maps;
+  bMaps.first = bmMap.surfaceMaterialMap();
+  BOOST_CHECK_EQUAL(jin, jmConverter.materialMapsToJson(bMaps));
+
+  // single entry access
+  GeometryID layerID;
+  layerID.setVolume(2);
+  layerID.setLayer(4);
+  auto sMaterial = bmMap.surfaceMaterial(layerID);
+  BOOST_CHECK(sMaterial != nullptr);
+  auto bsMaterial =
+      dynamic_cast<const Acts::BinnedSurfaceMaterial*>(sMaterial.get());
+  BOOST_CHECK(bsMaterial != nullptr);
+  BOOST_CHECK(bsMaterial->fullMaterial() ==
+              dynamic_cast<const Acts::BinnedSurfaceMaterial*>(
+                  maps.first.at(layerID).get())
+                  ->fullMaterial());
+  layerID.setLayer(6);
+  BOOST_CHECK(bmMap.surfaceMaterial(layerID) == nullptr);
+
+  // the decorator must read both formats
+  layerID.setLayer(2);
+  auto surface = Surface::makeShared<CylinderSurface>(nullptr, 30., 100.);
+  surface->assignGeoID(layerID);
+  Acts::JsonMaterialDecorator jDecorator(cfg, "binary_conversion.json");
+  jDecorator.decorate(*surface);
+  auto jMaterial = dynamic_cast<const Acts::BinnedSurfaceMaterial*>(
+      surface->surfaceMaterial());
+  Acts::JsonMaterialDecorator bDecorator(cfg, "binary_conversion.acm");
+  bDecorator.decorate(*surface);
+  auto bMaterial = dynamic_cast<const Acts::BinnedSurfaceMaterial*>(
+      surface->surfaceMaterial());
+  BOOST_CHECK(jMaterial != nullptr);
+  BOOST_CHECK(bMaterial != nullptr);
+  BOOST_CHECK(jMaterial != bMaterial);
+  BOOST_CHECK(jMaterial->fullMaterial() == bMaterial->fullMaterial());
+}
+
+BOOST_AUTO_TEST_CASE(Lazy_decoration) {
+  Acts::JsonGeometryConverter::Config cfg;
+  {
+    std::ofstream ofj("lazy_decoration.json");
+    ofj << testMaterialMap();
+  }
+  Acts::BinaryMaterialMap::convertJson(cfg, "lazy_decoration.json",
+                                       "lazy_decoration.acm");
+
+  GeometryID layerID;
+  layerID.setVolume(2);
+  layerID.setLayer(4);
+  auto eagerSurface = Surface::makeShared<CylinderSurface>(nullptr, 30., 100.);
+  eagerSurface->assignGeoID(layerID);
+  auto lazySurface = Surface::makeShared<CylinderSurface>(nullptr, 30., 100.);
+  lazySurface->assignGeoID(layerID);
+  layerID.setLayer(6);
+  auto emptySurface = Surface::makeShared<CylinderSurface>(nullptr, 30., 100.);
+  emptySurface->assignGeoID(layerID);
+
+  Acts::JsonMaterialDecorator eDecorator(cfg, "lazy_decoration.acm");
+  eDecorator.decorate(*eagerSurface);
+  Acts::JsonMaterialDecorator lDecorator(cfg, "lazy_decoration.acm", true,
+                                         true, true);
+  lDecorator.decorate(*lazySurface);
+  lDecorator.decorate(*emptySurface);
+  BOOST_CHECK(emptySurface->surfaceMaterial() == nullptr);
+
+  // decoration only assigns the proxy, nothing is read yet
+  auto lMaterial =
+      dynamic_cast<const LazySurfaceMaterial*>(lazySurface->surfaceMaterial());
+  BOOST_CHECK(lMaterial != nullptr);
+  BOOST_CHECK(not lMaterial->isLoaded());
+
+  // concurrent first access must load the material exactly once
+  auto eMaterial = dynamic_cast<const BinnedSurfaceMaterial*>(
+      eagerSurface->surfaceMaterial());
+  BOOST_CHECK(eMaterial != nullptr);
+  std::vector<const MaterialProperties*> accessed(8, nullptr);
+  std::vector<std::thread> threads;
+  for (size_t it = 0; it < accessed.size(); ++it) {
+    threads.emplace_back(
+        [&, it]() { accessed[it] = &lMaterial->materialProperties(0, 0); });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  BOOST_CHECK(lMaterial->isLoaded());
+  for (const auto* mp : accessed) {
+    BOOST_CHECK_EQUAL(mp, accessed.front());
+  }
+  auto bMaterial =
+      dynamic_cast<const BinnedSurfaceMaterial*>(&lMaterial->material());
+  BOOST_CHECK(bMaterial != nullptr);
+  BOOST_CHECK(bMaterial->fullMaterial() == eMaterial->fullMaterial());
+}
+
 }  // namespace Test
 }  // namespace Acts